@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * Vector with inline storage for at most N elements, i.e. it never allocates on the heap.
+ * It provides the part of the std::vector interface which is needed for the descriptions.
+ * Operations exceeding the capacity throw std::length_error.
+ */
+template <typename T, std::size_t N>
+class FixedCapacityVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = T const&;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    FixedCapacityVector() = default;
+    FixedCapacityVector(std::initializer_list<T> values)
+    {
+        checkCapacity(values.size());
+        std::copy(values.begin(), values.end(), _elements.begin());
+        _size = values.size();
+    }
+
+    size_type size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    static constexpr size_type capacity() { return N; }
+    static constexpr size_type max_size() { return N; }
+
+    T* data() { return _elements.data(); }
+    T const* data() const { return _elements.data(); }
+
+    iterator begin() { return _elements.data(); }
+    iterator end() { return _elements.data() + _size; }
+    const_iterator begin() const { return _elements.data(); }
+    const_iterator end() const { return _elements.data() + _size; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    T& operator[](size_type index) { return _elements[index]; }
+    T const& operator[](size_type index) const { return _elements[index]; }
+    T& at(size_type index)
+    {
+        checkIndex(index);
+        return _elements[index];
+    }
+    T const& at(size_type index) const
+    {
+        checkIndex(index);
+        return _elements[index];
+    }
+    T& front() { return _elements[0]; }
+    T const& front() const { return _elements[0]; }
+    T& back() { return _elements[_size - 1]; }
+    T const& back() const { return _elements[_size - 1]; }
+
+    void reserve(size_type size) const { checkCapacity(size); }
+    void clear() { resize(0); }
+    void resize(size_type size)
+    {
+        checkCapacity(size);
+        for (auto i = size; i < _size; ++i) {
+            _elements[i] = T();
+        }
+        _size = size;
+    }
+
+    void push_back(T const& value) { emplace_back(value); }
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        checkCapacity(_size + 1);
+        _elements[_size] = T(std::forward<Args>(args)...);
+        return _elements[_size++];
+    }
+    void pop_back() { _elements[--_size] = T(); }
+
+    iterator insert(const_iterator pos, T const& value)
+    {
+        checkCapacity(_size + 1);
+        auto index = pos - begin();
+        std::move_backward(begin() + index, end(), end() + 1);
+        _elements[index] = value;
+        ++_size;
+        return begin() + index;
+    }
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto firstIndex = first - begin();
+        auto lastIndex = last - begin();
+        std::move(begin() + lastIndex, end(), begin() + firstIndex);
+        resize(_size - (lastIndex - firstIndex));
+        return begin() + firstIndex;
+    }
+
+    friend bool operator==(FixedCapacityVector const& left, FixedCapacityVector const& right)
+    {
+        return std::equal(left.begin(), left.end(), right.begin(), right.end());
+    }
+    friend auto operator<=>(FixedCapacityVector const& left, FixedCapacityVector const& right)
+    {
+        return std::lexicographical_compare_three_way(left.begin(), left.end(), right.begin(), right.end());
+    }
+
+private:
+    static void checkCapacity(size_type size)
+    {
+        if (size > N) {
+            throw std::length_error("FixedCapacityVector: capacity exceeded.");
+        }
+    }
+    void checkIndex(size_type index) const
+    {
+        if (index >= _size) {
+            throw std::out_of_range("FixedCapacityVector: index out of range.");
+        }
+    }
+
+    std::array<T, N> _elements = {};
+    size_type _size = 0;
+};
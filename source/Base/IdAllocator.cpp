@@ -0,0 +1,68 @@
+#include "IdAllocator.h"
+
+#include <algorithm>
+
+namespace
+{
+    auto constexpr HostIdFlag = static_cast<uint64_t>(1) << 48;
+    auto constexpr IdBlockSize = 1024;
+
+    struct IdBlock
+    {
+        IdAllocator const* allocator = nullptr;
+        uint64_t nextNumber = 0;
+        uint64_t endNumber = 0;
+    };
+    thread_local IdBlock idBlock;
+}
+
+IdAllocator& IdAllocator::getInstance()
+{
+    static IdAllocator instance;
+    return instance;
+}
+
+uint64_t IdAllocator::getId()
+{
+    while (true) {
+        if (idBlock.allocator != this || idBlock.nextNumber == idBlock.endNumber) {
+            idBlock.allocator = this;
+            idBlock.nextNumber = _runningNumber.fetch_add(IdBlockSize) + 1;
+            idBlock.endNumber = idBlock.nextNumber + IdBlockSize;
+        }
+
+        //skip ids of the block which may have been taken by resynced data
+        auto resyncedNumber = _resyncedNumber.load(std::memory_order_acquire);
+        if (idBlock.nextNumber > resyncedNumber) {
+            break;
+        }
+        idBlock.nextNumber = std::min(resyncedNumber + 1, idBlock.endNumber);
+    }
+    return HostIdFlag | idBlock.nextNumber++;
+}
+
+uint64_t IdAllocator::reserveIds(uint64_t numIds)
+{
+    return HostIdFlag | (_runningNumber.fetch_add(numIds) + 1);
+}
+
+void IdAllocator::resync(uint64_t id)
+{
+    if (!isHostId(id)) {
+        return;
+    }
+    auto number = id & (HostIdFlag - 1);
+    auto runningNumber = _runningNumber.load();
+    while (runningNumber < number && !_runningNumber.compare_exchange_weak(runningNumber, number)) {
+    }
+
+    //blocks reserved before may contain the given id
+    auto resyncedNumber = _resyncedNumber.load();
+    while (resyncedNumber < number && !_resyncedNumber.compare_exchange_weak(resyncedNumber, number, std::memory_order_release)) {
+    }
+}
+
+bool IdAllocator::isHostId(uint64_t id)
+{
+    return (id & HostIdFlag) != 0;
+}
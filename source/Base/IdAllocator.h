@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+
+#include "Definitions.h"
+
+/**
+ * Thread-safe allocation of ids for entities created on the host. Each thread reserves contiguous blocks of ids from an
+ * atomic counter and hands them out without locking. Host ids carry a flag bit to avoid collisions with GPU-generated ids.
+ */
+class IdAllocator
+{
+public:
+    static IdAllocator& getInstance();
+
+    IdAllocator() = default;
+    IdAllocator(IdAllocator const&) = delete;
+    void operator=(IdAllocator const&) = delete;
+
+    uint64_t getId();
+
+    //returns the first id of numIds contiguous ids
+    uint64_t reserveIds(uint64_t numIds);
+
+    //ids allocated afterwards are greater than the given id (e.g. the maximum id of loaded data), also from blocks reserved before
+    void resync(uint64_t id);
+
+    static bool isHostId(uint64_t id);
+
+private:
+    std::atomic<uint64_t> _runningNumber{0};
+    std::atomic<uint64_t> _resyncedNumber{0};  //ids up to this number are skipped in blocks reserved before
+};
@@ -0,0 +1,101 @@
+#include "MappedFile.h"
+
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(std::string const& filename)
+{
+    _fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_fileHandle == INVALID_HANDLE_VALUE) {
+        _fileHandle = nullptr;
+        throw std::runtime_error("File could not be opened.");
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_fileHandle, &size)) {
+        CloseHandle(_fileHandle);
+        throw std::runtime_error("File size could not be determined.");
+    }
+    _size = static_cast<uint64_t>(size.QuadPart);
+    if (_size == 0) {
+        return;
+    }
+    _mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!_mappingHandle) {
+        CloseHandle(_fileHandle);
+        throw std::runtime_error("File could not be mapped.");
+    }
+    _data = static_cast<uint8_t const*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!_data) {
+        CloseHandle(_mappingHandle);
+        CloseHandle(_fileHandle);
+        throw std::runtime_error("File could not be mapped.");
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data) {
+        UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle) {
+        CloseHandle(_mappingHandle);
+    }
+    if (_fileHandle) {
+        CloseHandle(_fileHandle);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(std::string const& filename)
+{
+    auto fileDescriptor = open(filename.c_str(), O_RDONLY);
+    if (fileDescriptor == -1) {
+        throw std::runtime_error("File could not be opened.");
+    }
+    struct stat fileStat;
+    if (fstat(fileDescriptor, &fileStat) == -1) {
+        close(fileDescriptor);
+        throw std::runtime_error("File size could not be determined.");
+    }
+    _size = static_cast<uint64_t>(fileStat.st_size);
+    if (_size == 0) {
+        close(fileDescriptor);
+        return;
+    }
+    auto data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("File could not be mapped.");
+    }
+    _data = static_cast<uint8_t const*>(data);
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data) {
+        munmap(const_cast<uint8_t*>(_data), _size);
+    }
+}
+
+#endif
+
+uint8_t const* MappedFile::getData() const
+{
+    return _data;
+}
+
+uint64_t MappedFile::getSize() const
+{
+    return _size;
+}
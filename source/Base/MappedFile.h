@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+#include "Definitions.h"
+
+//read-only memory mapping of an entire file
+class MappedFile
+{
+public:
+    explicit MappedFile(std::string const& filename);  //throws std::runtime_error if file cannot be mapped
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    void operator=(MappedFile const&) = delete;
+
+    uint8_t const* getData() const;
+    uint64_t getSize() const;
+
+private:
+    uint8_t const* _data = nullptr;
+    uint64_t _size = 0;
+
+#if defined(_WIN32)
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
@@ -7,7 +7,6 @@
 NumberGenerator::NumberGenerator()
 {
     _arrayOfRandomNumbers.reserve(1323781);
-    _runningNumber = 0;
     std::random_device rd;   //Will be used to obtain a seed for the random number engine
     std::mt19937 gen(rd());  //Standard mersenne_twister_engine seeded with rd()
     std::uniform_int_distribution<> distrib(0);
@@ -63,11 +62,6 @@ double NumberGenerator::getRandomReal()
     return static_cast<double>(getNumberFromArray()) / static_cast<double>(std::numeric_limits<int>::max());
 }
 
-uint64_t NumberGenerator::getId()
-{
-    return (static_cast<uint64_t>(1) << 48) | ++_runningNumber; //first term is to avoid collisions with GPU-generated ids
-}
-
 uint32_t NumberGenerator::getNumberFromArray()
 {
 	_index = (_index + 1) % _arrayOfRandomNumbers.size();
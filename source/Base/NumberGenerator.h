@@ -14,8 +14,6 @@ public:
     double getRandomReal(double min, double max);
     float getRandomFloat(float min, float max);
 
-	uint64_t getId();
-
 public:
     NumberGenerator(NumberGenerator const&) = delete;
     void operator=(NumberGenerator const&) = delete;
@@ -29,6 +27,5 @@ private:
 
 	int _index = 0;
 	std::vector<uint32_t> _arrayOfRandomNumbers;
-	uint64_t _runningNumber = 0;
 };
 
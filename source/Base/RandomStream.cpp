@@ -0,0 +1,102 @@
+#include "RandomStream.h"
+
+#include <random>
+
+namespace
+{
+    uint64_t splitMix64(uint64_t& state)
+    {
+        auto result = (state += 0x9e3779b97f4a7c15ull);
+        result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+        result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+        return result ^ (result >> 31);
+    }
+
+    uint64_t rotateLeft(uint64_t value, int shift)
+    {
+        return (value << shift) | (value >> (64 - shift));
+    }
+}
+
+RandomStream::RandomStream(uint64_t seed, uint64_t streamKey)
+{
+    auto keyState = streamKey;
+    auto state = seed ^ splitMix64(keyState);
+    for (auto& word : _state) {
+        word = splitMix64(state);
+    }
+}
+
+RandomStream& RandomStream::getThreadInstance()
+{
+    thread_local RandomStream instance(getRandomSeed());
+    return instance;
+}
+
+uint64_t RandomStream::getRandomSeed()
+{
+    std::random_device randomDevice;
+    return (static_cast<uint64_t>(randomDevice()) << 32) | randomDevice();
+}
+
+uint64_t RandomStream::getNext()
+{
+    auto result = rotateLeft(_state[1] * 5, 7) * 9;
+    auto t = _state[1] << 17;
+    _state[2] ^= _state[0];
+    _state[3] ^= _state[1];
+    _state[1] ^= _state[2];
+    _state[0] ^= _state[3];
+    _state[2] ^= t;
+    _state[3] = rotateLeft(_state[3], 45);
+    return result;
+}
+
+uint32_t RandomStream::getRandomInt(uint32_t range)
+{
+    return static_cast<uint32_t>(((getNext() >> 32) * range) >> 32);
+}
+
+int RandomStream::getRandomInt(int min, int max)
+{
+    auto range = static_cast<uint64_t>(static_cast<int64_t>(max) - min + 1);
+    return static_cast<int>(min + static_cast<int64_t>(((getNext() >> 32) * range) >> 32));
+}
+
+float RandomStream::getRandomFloat(float min, float max)
+{
+    return min + (max - min) * (toFloat(getNext() >> 40) / toFloat(1 << 24));
+}
+
+double RandomStream::getRandomReal(double min, double max)
+{
+    return min + (max - min) * (toDouble(getNext() >> 11) / toDouble(1ull << 53));
+}
+
+void RandomStream::fill(std::span<uint32_t> values)
+{
+    auto size = values.size();
+    size_t i = 0;
+    for (; i + 1 < size; i += 2) {
+        auto number = getNext();
+        values[i] = static_cast<uint32_t>(number);
+        values[i + 1] = static_cast<uint32_t>(number >> 32);
+    }
+    if (i < size) {
+        values[i] = static_cast<uint32_t>(getNext() >> 32);
+    }
+}
+
+void RandomStream::fill(std::span<int> values, int min, int max)
+{
+    for (auto& value : values) {
+        value = getRandomInt(min, max);
+    }
+}
+
+void RandomStream::fill(std::span<float> values, float min, float max)
+{
+    for (auto& value : values) {
+        value = getRandomFloat(min, max);
+    }
+}
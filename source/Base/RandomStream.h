@@ -0,0 +1,41 @@
+#pragma once
+
+#include <limits>
+#include <span>
+
+#include "Definitions.h"
+
+/**
+ * Fast random number stream based on xoshiro256**. Streams created with the same seed but different stream keys are
+ * independent, hence parallel work can be randomized reproducibly by deriving one stream per task (e.g. per item index).
+ * A stream itself must not be shared between threads.
+ */
+class RandomStream
+{
+public:
+    using result_type = uint64_t;
+
+    explicit RandomStream(uint64_t seed, uint64_t streamKey = 0);
+
+    static RandomStream& getThreadInstance();  //non-reproducible stream of the calling thread
+    static uint64_t getRandomSeed();
+
+    uint64_t getNext();
+    uint32_t getRandomInt(uint32_t range);    //in [0, range)
+    int getRandomInt(int min, int max);        //in [min, max]
+    float getRandomFloat(float min, float max);
+    double getRandomReal(double min, double max);
+
+    //bulk generation
+    void fill(std::span<uint32_t> values);
+    void fill(std::span<int> values, int min, int max);
+    void fill(std::span<float> values, float min, float max);
+
+    //UniformRandomBitGenerator interface for <random> distributions and algorithms
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()() { return getNext(); }
+
+private:
+    uint64_t _state[4];
+};
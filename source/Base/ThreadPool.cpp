@@ -0,0 +1,132 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+
+ThreadPool& ThreadPool::getInstance()
+{
+    static ThreadPool instance;
+    return instance;
+}
+
+ThreadPool::ThreadPool(int numThreads)
+{
+    if (numThreads <= 0) {
+        numThreads = std::max(1, toInt(std::thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        _threads.emplace_back(&ThreadPool::runWorker, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _condition.notify_all();
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+int ThreadPool::getNumThreads() const
+{
+    return toInt(_threads.size());
+}
+
+namespace
+{
+    struct ParallelForState
+    {
+        std::atomic<int> nextBlock{0};
+        int numBlocks = 0;
+        int blockSize = 0;
+        int numItems = 0;
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        int numFinishedBlocks = 0;
+        std::exception_ptr exception;
+    };
+
+    void processBlocks(ParallelForState& state, std::function<void(int, int)> const& func)
+    {
+        while (true) {
+            auto block = state.nextBlock.fetch_add(1);
+            if (block >= state.numBlocks) {
+                return;
+            }
+            std::exception_ptr exception;
+            try {
+                auto begin = block * state.blockSize;
+                func(begin, std::min(begin + state.blockSize, state.numItems));
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (exception && !state.exception) {
+                state.exception = exception;
+            }
+            if (++state.numFinishedBlocks == state.numBlocks) {
+                state.condition.notify_all();
+            }
+        }
+    }
+}
+
+void ThreadPool::parallelFor(int numItems, std::function<void(int, int)> const& func, int minBlockSize)
+{
+    if (numItems <= 0) {
+        return;
+    }
+    auto numThreads = getNumThreads() + 1;
+    auto blockSize = std::max(std::max(1, minBlockSize), (numItems + numThreads * 4 - 1) / (numThreads * 4));
+    auto numBlocks = (numItems + blockSize - 1) / blockSize;
+    if (numBlocks == 1) {
+        func(0, numItems);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->numBlocks = numBlocks;
+    state->blockSize = blockSize;
+    state->numItems = numItems;
+
+    //helpers which start after all blocks have been taken return immediately => state is shared
+    auto funcCopy = std::make_shared<std::function<void(int, int)>>(func);
+    auto numHelpers = std::min(numBlocks - 1, getNumThreads());
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (int i = 0; i < numHelpers; ++i) {
+            _tasks.emplace([state, funcCopy] { processBlocks(*state, *funcCopy); });
+        }
+    }
+    _condition.notify_all();
+
+    processBlocks(*state, func);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&] { return state->numFinishedBlocks == state->numBlocks; });
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+void ThreadPool::runWorker()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this] { return _shutdown || !_tasks.empty(); });
+            if (_shutdown && _tasks.empty()) {
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop();
+        }
+        task();
+    }
+}
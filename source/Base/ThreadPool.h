@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "Definitions.h"
+
+class ThreadPool
+{
+public:
+    static ThreadPool& getInstance();
+
+    explicit ThreadPool(int numThreads = 0);  //0 = number of hardware threads
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    void operator=(ThreadPool const&) = delete;
+
+    int getNumThreads() const;
+
+    template <typename Func>
+    auto submit(Func&& func) -> std::future<std::invoke_result_t<Func>>;
+
+    //calls func(begin, end) for consecutive blocks covering [0, numItems) and blocks until all calls are finished
+    //the calling thread participates in the work, hence nested calls from tasks of the pool cannot deadlock
+    void parallelFor(int numItems, std::function<void(int, int)> const& func, int minBlockSize = 1);
+
+private:
+    void runWorker();
+
+    std::vector<std::thread> _threads;
+    std::queue<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _shutdown = false;
+};
+
+template <typename Func>
+auto ThreadPool::submit(Func&& func) -> std::future<std::invoke_result_t<Func>>
+{
+    using ResultType = std::invoke_result_t<Func>;
+    auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Func>(func));
+    auto result = task->get_future();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.emplace([task] { (*task)(); });
+    }
+    _condition.notify_one();
+    return result;
+}
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineImpl/EngineWorker.h"
+#include "EngineImpl/HostSimulationBackend.h"
+
+/**
+ * Measures the overhead of EngineWorker on a host backend, so that results are independent of a GPU.
+ * Usage: benchmarks [timestep duration in us] [measurement duration in ms] [number of commands]
+ */
+
+namespace
+{
+    struct Options
+    {
+        std::chrono::microseconds timestepDuration{100};
+        std::chrono::milliseconds measurementDuration{1000};
+        int numCommands = 100000;
+    };
+
+    Options parseOptions(int argc, char** argv)
+    {
+        Options result;
+        if (argc > 1) {
+            result.timestepDuration = std::chrono::microseconds(std::stoi(argv[1]));
+        }
+        if (argc > 2) {
+            result.measurementDuration = std::chrono::milliseconds(std::stoi(argv[2]));
+        }
+        if (argc > 3) {
+            result.numCommands = std::stoi(argv[3]);
+        }
+        return result;
+    }
+
+    double toMicroseconds(std::chrono::steady_clock::duration const& duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    class BenchmarkWorker
+    {
+    public:
+        BenchmarkWorker(Options const& options)
+        {
+            GeneralSettings generalSettings{1000, 1000};
+            _worker.newSimulation(0, generalSettings, SimulationParameters(), [&](uint64_t timestep, Settings const& settings) {
+                return std::make_shared<_HostSimulationBackend>(timestep, settings, options.timestepDuration);
+            });
+            _thread = std::thread(&EngineWorker::runThreadLoop, &_worker);
+            _worker.setSimulationData(DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(20).center({500.0f, 500.0f})));
+        }
+
+        ~BenchmarkWorker()
+        {
+            _worker.beginShutdown();
+            _thread.join();
+            _worker.endShutdown();
+        }
+
+        EngineWorker& get() { return _worker; }
+
+    private:
+        EngineWorker _worker;
+        std::thread _thread;
+    };
+
+    void benchmarkWorkerOverhead(Options const& options)
+    {
+        BenchmarkWorker worker(options);
+        auto startTimestep = worker.get().getCurrentTimestep();
+        auto startTime = std::chrono::steady_clock::now();
+        worker.get().runSimulation();
+        std::this_thread::sleep_for(options.measurementDuration);
+        worker.get().pauseSimulation();
+        auto duration = std::chrono::steady_clock::now() - startTime;
+        auto numTimesteps = worker.get().getCurrentTimestep() - startTimestep;
+
+        auto timePerTimestep = toMicroseconds(duration) / static_cast<double>(std::max(numTimesteps, uint64_t(1)));
+        std::cout << "worker overhead" << std::endl;
+        std::cout << "  time steps:         " << numTimesteps << std::endl;
+        std::cout << "  time per step:      " << timePerTimestep << " us" << std::endl;
+        std::cout << "  overhead per step:  " << timePerTimestep - toMicroseconds(options.timestepDuration) << " us" << std::endl;
+    }
+
+    void benchmarkGuardLatency(Options const& options, bool running)
+    {
+        BenchmarkWorker worker(options);
+        if (running) {
+            worker.get().runSimulation();
+        }
+
+        std::vector<double> latencies;
+        auto endTime = std::chrono::steady_clock::now() + options.measurementDuration;
+        while (std::chrono::steady_clock::now() < endTime) {
+            auto startTime = std::chrono::steady_clock::now();
+            worker.get().getSelectionShallowData();
+            latencies.emplace_back(toMicroseconds(std::chrono::steady_clock::now() - startTime));
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        worker.get().pauseSimulation();
+
+        std::ranges::sort(latencies);
+        auto percentile = [&](double value) { return latencies[static_cast<size_t>(value * static_cast<double>(latencies.size() - 1))]; };
+        std::cout << "guard latency while " << (running ? "running" : "paused") << std::endl;
+        std::cout << "  samples:            " << latencies.size() << std::endl;
+        std::cout << "  median:             " << percentile(0.5) << " us" << std::endl;
+        std::cout << "  99th percentile:    " << percentile(0.99) << " us" << std::endl;
+        std::cout << "  max:                " << latencies.back() << " us" << std::endl;
+    }
+
+    void benchmarkIdleCpuTime(Options const& options)
+    {
+        BenchmarkWorker worker(options);
+        auto cpuStart = std::clock();
+        std::this_thread::sleep_for(options.measurementDuration);
+        auto cpuDuration = 1000.0 * static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+        std::cout << "idle worker while paused" << std::endl;
+        std::cout << "  process CPU time:   " << cpuDuration << " ms in " << options.measurementDuration.count() << " ms" << std::endl;
+    }
+
+    void benchmarkJobThroughput(Options const& options)
+    {
+        BenchmarkWorker worker(options);
+        worker.get().runSimulation();
+
+        //acquiring access finishes all pending commands
+        auto startTime = std::chrono::steady_clock::now();
+        for (int i = 0; i < options.numCommands; ++i) {
+            worker.get().applyForce_async({500.0f, 500.0f}, {501.0f, 500.0f}, {0.001f, 0.0f}, 5.0f);
+        }
+        worker.get().getSelectionShallowData();
+        auto commandDuration = std::chrono::steady_clock::now() - startTime;
+
+        startTime = std::chrono::steady_clock::now();
+        std::vector<std::shared_future<StatisticsData>> results;
+        for (int i = 0; i < options.numCommands / 100; ++i) {
+            results.emplace_back(worker.get().getStatistics_async());
+            if (i % 10 == 9) {
+                results.back().wait();
+            }
+        }
+        for (auto const& result : results) {
+            result.wait();
+        }
+        auto queryDuration = std::chrono::steady_clock::now() - startTime;
+        worker.get().pauseSimulation();
+
+        std::cout << "job throughput while running" << std::endl;
+        std::cout << "  commands per second: " << options.numCommands / (toMicroseconds(commandDuration) / 1e6) << std::endl;
+        std::cout << "  queries per second:  " << static_cast<double>(results.size()) / (toMicroseconds(queryDuration) / 1e6) << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto options = parseOptions(argc, argv);
+    std::cout << "time step duration of host backend: " << options.timestepDuration.count() << " us" << std::endl;
+
+    benchmarkWorkerOverhead(options);
+    benchmarkGuardLatency(options, true);
+    benchmarkGuardLatency(options, false);
+    benchmarkIdleCpuTime(options);
+    benchmarkJobThroughput(options);
+    return 0;
+}
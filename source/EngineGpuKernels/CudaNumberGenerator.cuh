@@ -7,6 +7,8 @@
 
 #include <cuda/helper_cuda.h>
 
+#include "Base/RandomStream.h"
+
 #include "Array.cuh"
 #include "CudaMemoryManager.cuh"
 #include "Base.cuh"
@@ -23,7 +25,7 @@ private:
     unsigned int* _currentSmallId;
 
 public:
-    void init(int size)
+    void init(int size, RandomStream& randomStream)
     {
         _size = size;
 
@@ -39,9 +41,7 @@ public:
         CHECK_FOR_CUDA_ERROR(cudaMemcpy(_currentSmallId, &hostCurrentSmallId, sizeof(unsigned int), cudaMemcpyHostToDevice));
 
         std::vector<int> randomNumbers(size);
-        for (int i = 0; i < size; ++i) {
-            randomNumbers[i] = rand();
-        }
+        randomStream.fill(randomNumbers, 0, RAND_MAX);
         CHECK_FOR_CUDA_ERROR(cudaMemcpy(_array, randomNumbers.data(), sizeof(int) * size, cudaMemcpyHostToDevice));
     }
 
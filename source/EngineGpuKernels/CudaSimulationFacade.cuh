@@ -19,62 +19,63 @@
 #include "EngineInterface/MutationType.h"
 
 #include "Definitions.cuh"
+#include "SimulationBackend.cuh"
 
-class _CudaSimulationFacade
+class _CudaSimulationFacade : public _SimulationBackend
 {
 public:
     static void initCuda();
 
     _CudaSimulationFacade(uint64_t timestep, Settings const& settings);
-    ~_CudaSimulationFacade();
-
-    void* registerImageResource(GLuint image);
-
-    void calcTimestep();
-
-    void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom);
-    void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
-    void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO);
-    void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO);
-    void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO);
-    void addAndSelectSimulationData(DataTO const& dataTO);
-    void setSimulationData(DataTO const& dataTO);
-    void removeSelectedObjects(bool includeClusters);
-    void relaxSelectedObjects(bool includeClusters);
-    void uniformVelocitiesForSelectedObjects(bool includeClusters);
-    void makeSticky(bool includeClusters);
-    void removeStickiness(bool includeClusters);
-    void setBarrier(bool value, bool includeClusters);
-    void changeInspectedSimulationData(DataTO const& changeDataTO);
-
-    void applyForce(ApplyForceData const& applyData);
-    void switchSelection(PointSelectionData const& switchData);
-    void swapSelection(PointSelectionData const& selectionData);
-    void setSelection(AreaSelectionData const& selectionData);
-    SelectionShallowData getSelectionShallowData();
-    void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData);
-    void removeSelection();
-    void updateSelection();
-    void colorSelectedObjects(unsigned char color, bool includeClusters);
-    void reconnectSelectedObjects();
-    void setDetached(bool value);
-
-    void setGpuConstants(GpuSettings const& cudaConstants);
-    void setSimulationParameters(SimulationParameters const& parameters);
-
-    ArraySizes getArraySizes() const;
-
-    StatisticsData getStatistics();
-    void resetTimeIntervalStatistics();
-    uint64_t getCurrentTimestep() const;
-    void setCurrentTimestep(uint64_t timestep);
-
-    void clear();
-
-    void resizeArraysIfNecessary(ArraySizes const& additionals = ArraySizes());
+    ~_CudaSimulationFacade() override;
+
+    void* registerImageResource(GLuint image) override;
+
+    void calcTimestep() override;
+
+    void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom) override;
+    void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) override;
+    void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO) override;
+    void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO) override;
+    void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) override;
+    void addAndSelectSimulationData(DataTO const& dataTO) override;
+    void setSimulationData(DataTO const& dataTO) override;
+    void removeSelectedObjects(bool includeClusters) override;
+    void relaxSelectedObjects(bool includeClusters) override;
+    void uniformVelocitiesForSelectedObjects(bool includeClusters) override;
+    void makeSticky(bool includeClusters) override;
+    void removeStickiness(bool includeClusters) override;
+    void setBarrier(bool value, bool includeClusters) override;
+    void changeInspectedSimulationData(DataTO const& changeDataTO) override;
+
+    void applyForce(ApplyForceData const& applyData) override;
+    void switchSelection(PointSelectionData const& switchData) override;
+    void swapSelection(PointSelectionData const& selectionData) override;
+    void setSelection(AreaSelectionData const& selectionData) override;
+    SelectionShallowData getSelectionShallowData() override;
+    void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData) override;
+    void removeSelection() override;
+    void updateSelection() override;
+    void colorSelectedObjects(unsigned char color, bool includeClusters) override;
+    void reconnectSelectedObjects() override;
+    void setDetached(bool value) override;
+
+    void setGpuConstants(GpuSettings const& cudaConstants) override;
+    void setSimulationParameters(SimulationParameters const& parameters) override;
+
+    ArraySizes getArraySizes() const override;
+
+    StatisticsData getStatistics() override;
+    void resetTimeIntervalStatistics() override;
+    uint64_t getCurrentTimestep() const override;
+    void setCurrentTimestep(uint64_t timestep) override;
+
+    void clear() override;
+
+    void resizeArraysIfNecessary(ArraySizes const& additionals = ArraySizes()) override;
 
     //for tests
-    void testOnly_mutate(uint64_t cellId, MutationType mutationType);
+    void testOnly_mutate(uint64_t cellId, MutationType mutationType) override;
 
 private:
     void syncAndCheck();
@@ -2,5 +2,8 @@
 
 #include <memory>
 
+class _SimulationBackend;
+using SimulationBackend = std::shared_ptr<_SimulationBackend>;
+
 class _CudaSimulationFacade;
 using CudaSimulationFacade = std::shared_ptr<_CudaSimulationFacade>;
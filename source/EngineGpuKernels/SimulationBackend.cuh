@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include <vector_types.h>
+#include <GL/gl.h>
+
+#include "EngineInterface/ArraySizes.h"
+#include "EngineInterface/GpuSettings.h"
+#include "EngineInterface/MutationType.h"
+#include "EngineInterface/SelectionShallowData.h"
+#include "EngineInterface/ShallowUpdateSelectionData.h"
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/StatisticsData.h"
+
+#include "Definitions.cuh"
+
+/**
+ * Simulation state and operations which EngineWorker drives from its thread.
+ * Data is exchanged via transfer objects allocated by the caller with the sizes returned by getArraySizes().
+ */
+class _SimulationBackend
+{
+public:
+    virtual ~_SimulationBackend() = default;
+
+    virtual void* registerImageResource(GLuint image) = 0;
+
+    virtual void calcTimestep() = 0;
+
+    virtual void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom) = 0;
+    virtual void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) = 0;
+    virtual void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO) = 0;
+    virtual void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO) = 0;
+    virtual void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) = 0;
+    virtual void addAndSelectSimulationData(DataTO const& dataTO) = 0;
+    virtual void setSimulationData(DataTO const& dataTO) = 0;
+    virtual void removeSelectedObjects(bool includeClusters) = 0;
+    virtual void relaxSelectedObjects(bool includeClusters) = 0;
+    virtual void uniformVelocitiesForSelectedObjects(bool includeClusters) = 0;
+    virtual void makeSticky(bool includeClusters) = 0;
+    virtual void removeStickiness(bool includeClusters) = 0;
+    virtual void setBarrier(bool value, bool includeClusters) = 0;
+    virtual void changeInspectedSimulationData(DataTO const& changeDataTO) = 0;
+
+    virtual void applyForce(ApplyForceData const& applyData) = 0;
+    virtual void switchSelection(PointSelectionData const& switchData) = 0;
+    virtual void swapSelection(PointSelectionData const& selectionData) = 0;
+    virtual void setSelection(AreaSelectionData const& selectionData) = 0;
+    virtual SelectionShallowData getSelectionShallowData() = 0;
+    virtual void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData) = 0;
+    virtual void removeSelection() = 0;
+    virtual void updateSelection() = 0;
+    virtual void colorSelectedObjects(unsigned char color, bool includeClusters) = 0;
+    virtual void reconnectSelectedObjects() = 0;
+    virtual void setDetached(bool value) = 0;
+
+    virtual void setGpuConstants(GpuSettings const& cudaConstants) = 0;
+    virtual void setSimulationParameters(SimulationParameters const& parameters) = 0;
+
+    virtual ArraySizes getArraySizes() const = 0;
+
+    virtual StatisticsData getStatistics() = 0;
+    virtual void resetTimeIntervalStatistics() = 0;
+    virtual uint64_t getCurrentTimestep() const = 0;
+    virtual void setCurrentTimestep(uint64_t timestep) = 0;
+
+    virtual void clear() = 0;
+
+    virtual void resizeArraysIfNecessary(ArraySizes const& additionals = ArraySizes()) = 0;
+
+    //for tests
+    virtual void testOnly_mutate(uint64_t cellId, MutationType mutationType) = 0;
+};
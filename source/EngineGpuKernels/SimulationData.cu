@@ -17,8 +17,9 @@ void SimulationData::init(int2 const& worldSize_, uint64_t timestep_)
     CHECK_FOR_CUDA_ERROR(cudaMemset(residualEnergy, 0, sizeof(double)));
  
     processMemory.init();
-    numberGen1.init(40312357);   //some array size for random numbers (~ 40 MB)
-    numberGen2.init(1536941);  //some array size for random numbers (~ 1.5 MB)
+    RandomStream randomStream(RandomStream::getRandomSeed());
+    numberGen1.init(40312357, randomStream);  //some array size for random numbers (~ 40 MB)
+    numberGen2.init(1536941, randomStream);  //some array size for random numbers (~ 1.5 MB)
 
     structuralOperations.init();
     for (int i = 0; i < CellFunction_WithoutNoneCount; ++i) {
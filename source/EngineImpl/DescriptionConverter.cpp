@@ -1,101 +1,60 @@
 #include "DescriptionConverter.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <boost/range/adaptor/map.hpp>
 
-#include "Base/NumberGenerator.h"
+#include "Base/IdAllocator.h"
 #include "Base/Exceptions.h"
+#include "Base/ThreadPool.h"
 #include "EngineInterface/Descriptions.h"
 
 
 namespace
 {
-    union BytesAsFloat
-    {
-        float f;
-        uint8_t b[4];
-    };
-
-    void convert(DataTO const& dataTO, uint64_t sourceSize, uint64_t sourceIndex, std::vector<uint8_t>& target)
-    {
-        target.resize(sourceSize);
-        for (int i = 0; i < sourceSize; ++i) {
-            target[i] = dataTO.auxiliaryData[sourceIndex + i];
-        }
-    }
+    auto constexpr ParallelConversionBlockSize = 1024;
 
-    void convert(DataTO const& dataTO, uint64_t sourceSize, uint64_t sourceIndex, std::vector<float>& target)
+    //genomes are hash-consed so that clones share their genome
+    GenomeBuffer convertGenome(DataTO const& dataTO, uint64_t sourceSize, uint64_t sourceIndex)
     {
-        BytesAsFloat bytesAsFloat;
-        target.resize(sourceSize / 4);
-        for (uint64_t i = 0; i < sourceSize / 4; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                bytesAsFloat.b[j] = dataTO.auxiliaryData[sourceIndex + i * 4 + j];
-            }
-            target[i] = bytesAsFloat.f;
+        if (sourceSize == 0) {
+            return GenomeBuffer();
         }
+        return GenomeBuffer(std::span<uint8_t const>(dataTO.auxiliaryData + sourceIndex, sourceSize));
     }
 
-    template<typename Container>
-    void convert(DataTO const& dataTO, Container const& source, uint64_t& targetSize, uint64_t& targetIndex)
+    //copies source to the auxiliary data at auxiliaryDataIndex which is advanced afterwards
+    template <typename Container>
+    void convert(DataTO const& dataTO, Container const& source, uint64_t& targetSize, uint64_t& targetIndex, uint64_t& auxiliaryDataIndex)
     {
-        targetSize = source.size();
+        targetSize = source.size() * sizeof(typename Container::value_type);
         if (targetSize > 0) {
-            targetIndex = *dataTO.numAuxiliaryData;
-            uint64_t size = source.size();
-            for (uint64_t i = 0; i < size; ++i) {
-                dataTO.auxiliaryData[targetIndex + i] = source.at(i);
-            }
-            (*dataTO.numAuxiliaryData) += size;
+            targetIndex = auxiliaryDataIndex;
+            std::memcpy(dataTO.auxiliaryData + targetIndex, source.data(), targetSize);
+            auxiliaryDataIndex += targetSize;
         }
     }
 
-    template <>
-    void convert(DataTO const& dataTO, std::vector<float> const& source, uint64_t& targetSize, uint64_t& targetIndex)
-    {
-        BytesAsFloat bytesAsFloat;
-        targetSize = source.size() * 4;
-        if (targetSize > 0) {
-            targetIndex = *dataTO.numAuxiliaryData;
-            uint64_t size = source.size();
-            for (uint64_t i = 0; i < size; ++i) {
-                bytesAsFloat.f = source.at(i);
-                for (int j = 0; j < 4; ++j) {
-                    dataTO.auxiliaryData[targetIndex + i * 4 + j] = bytesAsFloat.b[j];
-                }
-            }
-            (*dataTO.numAuxiliaryData) += targetSize;
-        }
-    }
+    //weights (row-major) followed by biases as laid out in the auxiliary data
+    using WeightsAndBiases = std::array<float, MAX_CHANNELS * (MAX_CHANNELS + 1)>;
 
-    std::vector<float> unitWeightsAndBias(std::vector<std::vector<float>> const& weights, std::vector<float> const& bias)
+    WeightsAndBiases unitWeightsAndBias(NeuronDescription const& neuron)
     {
-        std::vector<float> result(MAX_CHANNELS * MAX_CHANNELS + MAX_CHANNELS, 0);
+        WeightsAndBiases result;
         for (int row = 0; row < MAX_CHANNELS; ++row) {
-            for (int col = 0; col < MAX_CHANNELS; ++col) {
-                result[col + row * MAX_CHANNELS] = weights[row][col];
-            }
-        }
-        for (int col = 0; col < MAX_CHANNELS; ++col) {
-            result[col + MAX_CHANNELS * MAX_CHANNELS] = bias[col];
+            std::copy(neuron.weights[row].begin(), neuron.weights[row].end(), result.begin() + row * MAX_CHANNELS);
         }
-
+        std::copy(neuron.biases.begin(), neuron.biases.end(), result.begin() + MAX_CHANNELS * MAX_CHANNELS);
         return result;
     }
 
-    std::pair<std::vector<std::vector<float>>, std::vector<float>> splitWeightsAndBias(std::vector<float> const& weightsAndBias)
+    void splitWeightsAndBias(NeuronDescription& neuron, uint8_t const* weightsAndBias)
     {
-        std::vector<std::vector<float>> weights(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS, 0));
         for (int row = 0; row < MAX_CHANNELS; ++row) {
-            for (int col = 0; col < MAX_CHANNELS; ++col) {
-                weights[row][col] = weightsAndBias[col + row * MAX_CHANNELS];
-            }
+            std::memcpy(neuron.weights[row].data(), weightsAndBias + sizeof(float) * row * MAX_CHANNELS, sizeof(float) * MAX_CHANNELS);
         }
-
-        std::vector<float> bias;
-        bias = std::vector<float>(weightsAndBias.begin() + MAX_CHANNELS * MAX_CHANNELS, weightsAndBias.end());
-
-        return std::make_pair(weights, bias);
+        std::memcpy(neuron.biases.data(), weightsAndBias + sizeof(float) * MAX_CHANNELS * MAX_CHANNELS, sizeof(float) * MAX_CHANNELS);
     }
 }
 
@@ -127,11 +86,129 @@ ArraySizes DescriptionConverter::getArraySizes(ClusteredDataDescription const& d
     return result;
 }
 
-ClusteredDataDescription DescriptionConverter::convertTOtoClusteredDataDescription(DataTO const& dataTO) const
+ClusteredDataDescription DescriptionConverter::convertTOtoClusteredDataDescription(DataTO const& dataTO, ClusteringAlgorithm algorithm) const
 {
 	ClusteredDataDescription result;
 
     //cells
+    if (algorithm == ClusteringAlgorithm_ParallelUnionFind) {
+        result.clusters = createClustersByUnionFind(dataTO);
+    } else {
+        result.clusters = createClustersByBreadthFirstSearch(dataTO);
+    }
+
+    //particles
+    std::vector<ParticleDescription> particles;
+    for (int i = 0; i < *dataTO.numParticles; ++i) {
+        ParticleTO const& particle = dataTO.particles[i];
+        particles.emplace_back(ParticleDescription()
+                                   .setId(particle.id)
+                                   .setPos({particle.pos.x, particle.pos.y})
+                                   .setVel({particle.vel.x, particle.vel.y})
+                                   .setEnergy(particle.energy)
+                                   .setColor(particle.color));
+    }
+    result.addParticles(particles);
+
+    return result;
+}
+
+namespace
+{
+    //lock-free union-find: roots are always linked to smaller roots, hence the root of a set is its smallest index
+    int findRoot(std::vector<std::atomic<int>>& parents, int index)
+    {
+        while (true) {
+            auto parent = parents[index].load(std::memory_order_relaxed);
+            if (parent == index) {
+                return index;
+            }
+            auto grandParent = parents[parent].load(std::memory_order_relaxed);
+            if (grandParent != parent) {
+                parents[index].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);  //path halving
+            }
+            index = grandParent;
+        }
+    }
+
+    void unite(std::vector<std::atomic<int>>& parents, int index1, int index2)
+    {
+        while (true) {
+            auto root1 = findRoot(parents, index1);
+            auto root2 = findRoot(parents, index2);
+            if (root1 == root2) {
+                return;
+            }
+            auto [smallerRoot, largerRoot] = std::minmax(root1, root2);
+            auto expected = largerRoot;
+            if (parents[largerRoot].compare_exchange_strong(expected, smallerRoot, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+}
+
+std::vector<ClusterDescription> DescriptionConverter::createClustersByUnionFind(DataTO const& dataTO) const
+{
+    auto numCells = toInt(*dataTO.numCells);
+    auto& threadPool = ThreadPool::getInstance();
+
+    std::vector<std::atomic<int>> parents(numCells);
+    threadPool.parallelFor(numCells, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            parents[i].store(i, std::memory_order_relaxed);
+        }
+    });
+    threadPool.parallelFor(numCells, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            auto const& cellTO = dataTO.cells[i];
+            for (int j = 0; j < cellTO.numConnections; ++j) {
+                auto connectedIndex = cellTO.connections[j].cellIndex;
+                if (connectedIndex >= 0 && connectedIndex < numCells) {
+                    unite(parents, i, connectedIndex);
+                }
+            }
+        }
+    });
+
+    //counting sort of cells by their roots
+    std::vector<int> roots(numCells);
+    threadPool.parallelFor(numCells, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            roots[i] = findRoot(parents, i);
+        }
+    });
+    std::vector<int> clusterIndexByRoot(numCells, -1);
+    std::vector<int> clusterSizes;
+    for (int i = 0; i < numCells; ++i) {
+        if (roots[i] == i) {
+            clusterIndexByRoot[i] = toInt(clusterSizes.size());
+            clusterSizes.emplace_back(0);
+        }
+        ++clusterSizes[clusterIndexByRoot[roots[i]]];
+    }
+    std::vector<ClusterDescription> result(clusterSizes.size());
+    for (size_t i = 0; i < clusterSizes.size(); ++i) {
+        result[i].cells.resize(clusterSizes[i]);
+        clusterSizes[i] = 0;
+    }
+    std::vector<std::pair<int, int>> clusterAndCellIndices(numCells);
+    for (int i = 0; i < numCells; ++i) {
+        auto clusterIndex = clusterIndexByRoot[roots[i]];
+        clusterAndCellIndices[i] = {clusterIndex, clusterSizes[clusterIndex]++};
+    }
+
+    threadPool.parallelFor(numCells, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            auto [clusterIndex, cellIndex] = clusterAndCellIndices[i];
+            result[clusterIndex].cells[cellIndex] = createCellDescription(dataTO, i);
+        }
+    });
+    return result;
+}
+
+std::vector<ClusterDescription> DescriptionConverter::createClustersByBreadthFirstSearch(DataTO const& dataTO) const
+{
     std::vector<ClusterDescription> clusters;
     std::unordered_set<int> freeCellIndices;
     for (int i = 0; i < *dataTO.numCells; ++i) {
@@ -153,22 +230,7 @@ ClusteredDataDescription DescriptionConverter::convertTOtoClusteredDataDescripti
         }
         ++clusterDescIndex;
     }
-    result.addClusters(clusters);
-
-    //particles
-    std::vector<ParticleDescription> particles;
-    for (int i = 0; i < *dataTO.numParticles; ++i) {
-        ParticleTO const& particle = dataTO.particles[i];
-        particles.emplace_back(ParticleDescription()
-                                   .setId(particle.id)
-                                   .setPos({particle.pos.x, particle.pos.y})
-                                   .setVel({particle.vel.x, particle.vel.y})
-                                   .setEnergy(particle.energy)
-                                   .setColor(particle.color));
-    }
-    result.addParticles(particles);
-
-    return result;
+    return clusters;
 }
 
 DataDescription DescriptionConverter::convertTOtoDataDescription(DataTO const& dataTO) const
@@ -228,49 +290,132 @@ OverlayDescription DescriptionConverter::convertTOtoOverlayDescription(DataTO co
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, ClusteredDataDescription const& description) const
 {
-    std::unordered_map<uint64_t, int> cellIndexByIds;
-    for (auto const& cluster: description.clusters) {
-        for (auto const& cell : cluster.cells) {
-            addCell(result, cell, cellIndexByIds);
-        }
-    }
+    std::vector<CellDescription const*> cells;
     for (auto const& cluster : description.clusters) {
         for (auto const& cell : cluster.cells) {
-            if (cell.id != 0) {
-                setConnections(result, cell, cellIndexByIds);
-            }
+            cells.emplace_back(&cell);
         }
     }
+    std::vector<ParticleDescription const*> particles;
+    particles.reserve(description.particles.size());
     for (auto const& particle : description.particles) {
-        addParticle(result, particle);
+        particles.emplace_back(&particle);
     }
+    convertCellsAndParticlesToTO(result, cells, particles);
 }
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, DataDescription const& description) const
 {
-    std::unordered_map<uint64_t, int> cellIndexByIds;
-    for (auto const& cell : description.cells) {
-        addCell(result, cell, cellIndexByIds);
-    }
+    std::vector<CellDescription const*> cells;
+    cells.reserve(description.cells.size());
     for (auto const& cell : description.cells) {
-        if (cell.id != 0) {
-            setConnections(result, cell, cellIndexByIds);
-        }
+        cells.emplace_back(&cell);
     }
+    std::vector<ParticleDescription const*> particles;
+    particles.reserve(description.particles.size());
     for (auto const& particle : description.particles) {
-        addParticle(result, particle);
+        particles.emplace_back(&particle);
     }
+    convertCellsAndParticlesToTO(result, cells, particles);
 }
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, CellDescription const& cell) const
 {
-    std::unordered_map<uint64_t, int> cellIndexByIds;
-    addCell(result, cell, cellIndexByIds);
+    auto cellIndex = (*result.numCells)++;
+    auto auxiliaryDataIndex = *result.numAuxiliaryData;
+    addAdditionalDataSizeForCell(cell, *result.numAuxiliaryData);
+    IdAllocator::getInstance().resync(cell.id);
+    addCell(result, cell, cellIndex, cell.id == 0 ? IdAllocator::getInstance().getId() : cell.id, auxiliaryDataIndex);
 }
 
 void DescriptionConverter::convertDescriptionToTO(DataTO& result, ParticleDescription const& particle) const
 {
-    addParticle(result, particle);
+    auto particleIndex = (*result.numParticles)++;
+    IdAllocator::getInstance().resync(particle.id);
+    addParticle(result, particle, particleIndex, particle.id == 0 ? IdAllocator::getInstance().getId() : particle.id);
+}
+
+void DescriptionConverter::convertCellsAndParticlesToTO(
+    DataTO const& dataTO,
+    std::vector<CellDescription const*> const& cells,
+    std::vector<ParticleDescription const*> const& particles) const
+{
+    auto& threadPool = ThreadPool::getInstance();
+    auto numCells = toInt(cells.size());
+    auto numParticles = toInt(particles.size());
+    auto cellIndexOffset = *dataTO.numCells;
+    auto particleIndexOffset = *dataTO.numParticles;
+
+    //first pass: auxiliary data sizes, ids and exclusive prefix sum for the auxiliary data indices
+    std::vector<uint64_t> auxiliaryDataIndices(numCells, 0);
+    threadPool.parallelFor(
+        numCells,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                addAdditionalDataSizeForCell(*cells[i], auxiliaryDataIndices[i]);
+            }
+        },
+        ParallelConversionBlockSize);
+
+    //new ids must not collide with the ids of the converted data
+    auto& idAllocator = IdAllocator::getInstance();
+    uint64_t maxId = 0;
+    for (auto const& cell : cells) {
+        maxId = std::max(maxId, cell->id);
+    }
+    for (auto const& particle : particles) {
+        maxId = std::max(maxId, particle->id);
+    }
+    idAllocator.resync(maxId);
+
+    std::vector<uint64_t> cellIds(numCells);
+    std::unordered_map<uint64_t, int> cellIndexByIds;
+    cellIndexByIds.reserve(numCells);
+    auto auxiliaryDataIndex = *dataTO.numAuxiliaryData;
+    for (int i = 0; i < numCells; ++i) {
+        auto const& cell = *cells[i];
+        cellIds[i] = cell.id == 0 ? idAllocator.getId() : cell.id;
+        cellIndexByIds.insert_or_assign(cellIds[i], toInt(cellIndexOffset + i));
+        auto size = auxiliaryDataIndices[i];
+        auxiliaryDataIndices[i] = auxiliaryDataIndex;
+        auxiliaryDataIndex += size;
+    }
+    std::vector<uint64_t> particleIds(numParticles);
+    for (int i = 0; i < numParticles; ++i) {
+        particleIds[i] = particles[i]->id == 0 ? idAllocator.getId() : particles[i]->id;
+    }
+
+    //second pass: each cell writes to its own TO and auxiliary data region
+    threadPool.parallelFor(
+        numCells,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                addCell(dataTO, *cells[i], cellIndexOffset + i, cellIds[i], auxiliaryDataIndices[i]);
+            }
+        },
+        ParallelConversionBlockSize);
+    threadPool.parallelFor(
+        numCells,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                if (cells[i]->id != 0) {
+                    setConnections(dataTO, *cells[i], cellIndexOffset + i, cellIndexByIds);
+                }
+            }
+        },
+        ParallelConversionBlockSize);
+    threadPool.parallelFor(
+        numParticles,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                addParticle(dataTO, *particles[i], particleIndexOffset + i, particleIds[i]);
+            }
+        },
+        ParallelConversionBlockSize);
+
+    *dataTO.numCells += numCells;
+    *dataTO.numParticles += numParticles;
+    *dataTO.numAuxiliaryData = auxiliaryDataIndex;
 }
 
 void DescriptionConverter::addAdditionalDataSizeForCell(CellDescription const& cell, uint64_t& additionalDataSize) const
@@ -367,10 +512,10 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
     result.energy = cellTO.energy;
     result.stiffness = cellTO.stiffness;
     result.maxConnections = cellTO.maxConnections;
-    std::vector<ConnectionDescription> connections;
+    result.connections.resize(cellTO.numConnections);
     for (int i = 0; i < cellTO.numConnections; ++i) {
         auto const& connectionTO = cellTO.connections[i];
-        ConnectionDescription connection;
+        auto& connection = result.connections[i];
         if (connectionTO.cellIndex != -1) {
             connection.cellId = dataTO.cells[connectionTO.cellIndex].id;
         } else {
@@ -378,9 +523,7 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
         }
         connection.distance = connectionTO.distance;
         connection.angleFromPrevious = connectionTO.angleFromPrevious;
-        connections.emplace_back(connection);
     }
-    result.connections = connections;
     result.livingState = cellTO.livingState;
     result.creatureId = cellTO.creatureId;
     result.mutationId = cellTO.mutationId;
@@ -408,9 +551,7 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
     switch (cellTO.cellFunction) {
     case CellFunction_Neuron: {
         NeuronDescription neuron;
-        std::vector<float> weigthsAndBias;
-        convert(dataTO, sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1), cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex, weigthsAndBias);
-        std::tie(neuron.weights, neuron.biases) = splitWeightsAndBias(weigthsAndBias);
+        splitWeightsAndBias(neuron, dataTO.auxiliaryData + cellTO.cellFunctionData.neuron.weightsAndBiasesDataIndex);
         result.cellFunction = neuron;
     } break;
     case CellFunction_Transmitter: {
@@ -422,7 +563,7 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
         ConstructorDescription constructor;
         constructor.activationMode = cellTO.cellFunctionData.constructor.activationMode;
         constructor.constructionActivationTime = cellTO.cellFunctionData.constructor.constructionActivationTime;
-        convert(dataTO, cellTO.cellFunctionData.constructor.genomeSize, cellTO.cellFunctionData.constructor.genomeDataIndex, constructor.genome);
+        constructor.genome = convertGenome(dataTO, cellTO.cellFunctionData.constructor.genomeSize, cellTO.cellFunctionData.constructor.genomeDataIndex);
         constructor.genomeReadPosition = toInt(cellTO.cellFunctionData.constructor.genomeReadPosition);
         constructor.offspringCreatureId = cellTO.cellFunctionData.constructor.offspringCreatureId;
         constructor.offspringMutationId = cellTO.cellFunctionData.constructor.offspringMutationId;
@@ -455,7 +596,7 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
         InjectorDescription injector;
         injector.mode = cellTO.cellFunctionData.injector.mode;
         injector.counter = cellTO.cellFunctionData.injector.counter;
-        convert(dataTO, cellTO.cellFunctionData.injector.genomeSize, cellTO.cellFunctionData.injector.genomeDataIndex, injector.genome);
+        injector.genome = convertGenome(dataTO, cellTO.cellFunctionData.injector.genomeSize, cellTO.cellFunctionData.injector.genomeDataIndex);
         injector.genomeGeneration = cellTO.cellFunctionData.injector.genomeGeneration;
         result.cellFunction = injector;
     } break;
@@ -485,12 +626,10 @@ CellDescription DescriptionConverter::createCellDescription(DataTO const& dataTO
     return result;
 }
 
-void DescriptionConverter::addParticle(DataTO const& dataTO, ParticleDescription const& particleDesc) const
+void DescriptionConverter::addParticle(DataTO const& dataTO, ParticleDescription const& particleDesc, uint64_t particleIndex, uint64_t particleId) const
 {
-    auto particleIndex = (*dataTO.numParticles)++;
-
 	ParticleTO& particleTO = dataTO.particles[particleIndex];
-	particleTO.id = particleDesc.id == 0 ? NumberGenerator::getInstance().getId() : particleDesc.id;
+	particleTO.id = particleId;
     particleTO.pos = {particleDesc.pos.x, particleDesc.pos.y};
     particleTO.vel = {particleDesc.vel.x, particleDesc.vel.y};
 	particleTO.energy = particleDesc.energy;
@@ -498,11 +637,14 @@ void DescriptionConverter::addParticle(DataTO const& dataTO, ParticleDescription
 }
 
 void DescriptionConverter::addCell(
-    DataTO const& dataTO, CellDescription const& cellDesc, std::unordered_map<uint64_t, int>& cellIndexTOByIds) const
+    DataTO const& dataTO,
+    CellDescription const& cellDesc,
+    uint64_t cellIndex,
+    uint64_t cellId,
+    uint64_t auxiliaryDataIndex) const
 {
-    int cellIndex = (*dataTO.numCells)++;
     CellTO& cellTO = dataTO.cells[cellIndex];
-    cellTO.id = cellDesc.id == 0 ? NumberGenerator::getInstance().getId() : cellDesc.id;
+    cellTO.id = cellId;
 	cellTO.pos= { cellDesc.pos.x, cellDesc.pos.y };
     cellTO.vel = {cellDesc.vel.x, cellDesc.vel.y};
     cellTO.energy = cellDesc.energy;
@@ -519,9 +661,9 @@ void DescriptionConverter::addCell(
     case CellFunction_Neuron: {
         NeuronTO neuronTO;
         auto const& neuronDesc = std::get<NeuronDescription>(*cellDesc.cellFunction);
-        std::vector<float> weigthsAndBias = unitWeightsAndBias(neuronDesc.weights, neuronDesc.biases);
+        auto weigthsAndBias = unitWeightsAndBias(neuronDesc);
         uint64_t targetSize;
-        convert(dataTO, weigthsAndBias, targetSize, neuronTO.weightsAndBiasesDataIndex);
+        convert(dataTO, weigthsAndBias, targetSize, neuronTO.weightsAndBiasesDataIndex, auxiliaryDataIndex);
         CHECK(targetSize == sizeof(float) * MAX_CHANNELS * (MAX_CHANNELS + 1));
         cellTO.cellFunctionData.neuron = neuronTO;
     } break;
@@ -536,7 +678,7 @@ void DescriptionConverter::addCell(
         ConstructorTO constructorTO;
         constructorTO.activationMode = constructorDesc.activationMode;
         constructorTO.constructionActivationTime = constructorDesc.constructionActivationTime;
-        convert(dataTO, constructorDesc.genome, constructorTO.genomeSize, constructorTO.genomeDataIndex);
+        convert(dataTO, constructorDesc.genome, constructorTO.genomeSize, constructorTO.genomeDataIndex, auxiliaryDataIndex);
         constructorTO.genomeReadPosition = constructorDesc.genomeReadPosition;
         constructorTO.offspringCreatureId = constructorDesc.offspringCreatureId;
         constructorTO.offspringMutationId = constructorDesc.offspringMutationId;
@@ -572,7 +714,7 @@ void DescriptionConverter::addCell(
         InjectorTO injectorTO;
         injectorTO.mode = injectorDesc.mode;
         injectorTO.counter = injectorDesc.counter;
-        convert(dataTO, injectorDesc.genome, injectorTO.genomeSize, injectorTO.genomeDataIndex);
+        convert(dataTO, injectorDesc.genome, injectorTO.genomeSize, injectorTO.genomeDataIndex, auxiliaryDataIndex);
         injectorTO.genomeGeneration = injectorDesc.genomeGeneration;
         cellTO.cellFunctionData.injector = injectorTO;
     } break;
@@ -605,15 +747,18 @@ void DescriptionConverter::addCell(
     cellTO.age = cellDesc.age;
     cellTO.color = cellDesc.color;
     cellTO.genomeSize = cellDesc.genomeSize;
-    convert(dataTO, cellDesc.metadata.name, cellTO.metadata.nameSize, cellTO.metadata.nameDataIndex);
-    convert(dataTO, cellDesc.metadata.description, cellTO.metadata.descriptionSize, cellTO.metadata.descriptionDataIndex);
-	cellIndexTOByIds.insert_or_assign(cellTO.id, cellIndex);
+    convert(dataTO, cellDesc.metadata.name, cellTO.metadata.nameSize, cellTO.metadata.nameDataIndex, auxiliaryDataIndex);
+    convert(dataTO, cellDesc.metadata.description, cellTO.metadata.descriptionSize, cellTO.metadata.descriptionDataIndex, auxiliaryDataIndex);
 }
 
-void DescriptionConverter::setConnections(DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int> const& cellIndexByIds) const
+void DescriptionConverter::setConnections(
+    DataTO const& dataTO,
+    CellDescription const& cellToAdd,
+    uint64_t cellIndex,
+    std::unordered_map<uint64_t, int> const& cellIndexByIds) const
 {
     int index = 0;
-    auto& cellTO = dataTO.cells[cellIndexByIds.at(cellToAdd.id)];
+    auto& cellTO = dataTO.cells[cellIndex];
     float angleOffset = 0;
     for (ConnectionDescription const& connection : cellToAdd.connections) {
         if (connection.cellId != 0) {
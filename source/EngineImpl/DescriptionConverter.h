@@ -10,6 +10,13 @@
 #include "EngineGpuKernels/TOs.cuh"
 #include "Definitions.h"
 
+using ClusteringAlgorithm = int;
+enum ClusteringAlgorithm_
+{
+    ClusteringAlgorithm_ParallelUnionFind,  //clusters ordered by their smallest cell index, cells ordered by index
+    ClusteringAlgorithm_BreadthFirstSearch  //previous serial implementation, order depends on hash sets
+};
+
 class DescriptionConverter
 {
 public:
@@ -18,7 +25,9 @@ public:
     ArraySizes getArraySizes(DataDescription const& data) const;
     ArraySizes getArraySizes(ClusteredDataDescription const& data) const;
 
-    ClusteredDataDescription convertTOtoClusteredDataDescription(DataTO const& dataTO) const;
+    ClusteredDataDescription convertTOtoClusteredDataDescription(
+        DataTO const& dataTO,
+        ClusteringAlgorithm algorithm = ClusteringAlgorithm_ParallelUnionFind) const;
     DataDescription convertTOtoDataDescription(DataTO const& dataTO) const;
     OverlayDescription convertTOtoOverlayDescription(DataTO const& dataTO) const;
     void convertDescriptionToTO(DataTO& result, ClusteredDataDescription const& description) const;
@@ -29,6 +38,9 @@ public:
 private:
     void addAdditionalDataSizeForCell(CellDescription const& cell, uint64_t& additionalDataSize) const;
 
+    std::vector<ClusterDescription> createClustersByUnionFind(DataTO const& dataTO) const;
+    std::vector<ClusterDescription> createClustersByBreadthFirstSearch(DataTO const& dataTO) const;
+
 	struct CreateClusterReturnData
     {
         ClusterDescription cluster;
@@ -40,12 +52,25 @@ private:
         std::unordered_set<int>& freeCellIndices) const;
     CellDescription createCellDescription(DataTO const& dataTO, int cellIndex) const;
 
+    //two passes: auxiliary data layout via prefix sum, then parallel filling of the TOs
+    void convertCellsAndParticlesToTO(
+        DataTO const& dataTO,
+        std::vector<CellDescription const*> const& cells,
+        std::vector<ParticleDescription const*> const& particles) const;
+
 	void addCell(
-        DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int>& cellIndexTOByIds) const;
-    void addParticle(DataTO const& dataTO, ParticleDescription const& particleDesc) const;
+        DataTO const& dataTO,
+        CellDescription const& cellToAdd,
+        uint64_t cellIndex,
+        uint64_t cellId,
+        uint64_t auxiliaryDataIndex) const;
+    void addParticle(DataTO const& dataTO, ParticleDescription const& particleDesc, uint64_t particleIndex, uint64_t particleId) const;
 
 	void setConnections(
-        DataTO const& dataTO, CellDescription const& cellToAdd, std::unordered_map<uint64_t, int> const& cellIndexByIds) const;
+        DataTO const& dataTO,
+        CellDescription const& cellToAdd,
+        uint64_t cellIndex,
+        std::unordered_map<uint64_t, int> const& cellIndexByIds) const;
 
 private:
 	SimulationParameters _parameters;
@@ -0,0 +1,114 @@
+#include "EngineCommandQueue.h"
+
+#include <algorithm>
+#include <bit>
+
+EngineCommandQueue::EngineCommandQueue(int capacity)
+{
+    auto size = std::bit_ceil(static_cast<uint64_t>(std::max(capacity, 2)));
+    _slots = std::make_unique<Slot[]>(size);
+    _mask = size - 1;
+    for (uint64_t i = 0; i < size; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool EngineCommandQueue::tryPush(EngineCommand&& command)
+{
+    //a slot is free for the push position if its sequence equals the position
+    auto pos = _pushPos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &_slots[pos & _mask];
+        auto sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _pushPos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->command = std::move(command);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool EngineCommandQueue::isEmpty() const
+{
+    auto pos = _popPos.load(std::memory_order_acquire);
+    return _slots[pos & _mask].sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+std::vector<EngineCommand> EngineCommandQueue::popAll()
+{
+    std::vector<EngineCommand> result;
+    while (auto command = tryPop()) {
+        result.emplace_back(std::move(*command));
+    }
+    return coalesce(std::move(result));
+}
+
+std::optional<EngineCommand> EngineCommandQueue::tryPop()
+{
+    auto pos = _popPos.load(std::memory_order_relaxed);
+    auto& slot = _slots[pos & _mask];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+        return std::nullopt;
+    }
+    auto result = std::move(slot.command);
+    slot.command = RemoveSelectionCommand();  //releases the memory of large commands
+    slot.sequence.store(pos + _mask + 1, std::memory_order_release);
+    _popPos.store(pos + 1, std::memory_order_release);
+    return result;
+}
+
+std::vector<EngineCommand> EngineCommandQueue::coalesce(std::vector<EngineCommand> commands)
+{
+    std::optional<size_t> lastParametersIndex;
+    std::optional<size_t> lastGpuSettingsIndex;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        if (std::holds_alternative<SetSimulationParametersCommand>(commands[i])) {
+            lastParametersIndex = i;
+        }
+        if (std::holds_alternative<SetGpuSettingsCommand>(commands[i])) {
+            lastGpuSettingsIndex = i;
+        }
+    }
+
+    std::vector<EngineCommand> result;
+    result.reserve(commands.size());
+    for (size_t i = 0; i < commands.size(); ++i) {
+        auto& command = commands[i];
+        if (std::holds_alternative<SetSimulationParametersCommand>(command) && i != *lastParametersIndex) {
+            continue;
+        }
+        if (std::holds_alternative<SetGpuSettingsCommand>(command) && i != *lastGpuSettingsIndex) {
+            continue;
+        }
+        if (!result.empty()) {
+            auto& prevCommand = result.back();
+            if (std::holds_alternative<SetSelectionCommand>(command) && std::holds_alternative<SetSelectionCommand>(prevCommand)) {
+                prevCommand = std::move(command);
+                continue;
+            }
+            auto update = std::get_if<ShallowUpdateSelectedObjectsCommand>(&command);
+            auto prevUpdate = std::get_if<ShallowUpdateSelectedObjectsCommand>(&prevCommand);
+            if (update && prevUpdate && update->updateData.considerClusters == prevUpdate->updateData.considerClusters) {
+                auto& data = prevUpdate->updateData;
+                data.posDeltaX += update->updateData.posDeltaX;
+                data.posDeltaY += update->updateData.posDeltaY;
+                data.velDeltaX += update->updateData.velDeltaX;
+                data.velDeltaY += update->updateData.velDeltaY;
+                data.angleDelta += update->updateData.angleDelta;
+                data.angularVelDelta += update->updateData.angularVelDelta;
+                continue;
+            }
+        }
+        result.emplace_back(std::move(command));
+    }
+    return result;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GpuSettings.h"
+#include "EngineInterface/ShallowUpdateSelectionData.h"
+#include "EngineInterface/SimulationParameters.h"
+
+struct SetSimulationParametersCommand
+{
+    std::shared_ptr<SimulationParameters const> parameters;  //indirection keeps the queue slots small
+};
+
+struct SetGpuSettingsCommand
+{
+    GpuSettings gpuSettings;
+};
+
+struct ApplyForceCommand
+{
+    RealVector2D start;
+    RealVector2D end;
+    RealVector2D force;
+    float radius = 0;
+};
+
+struct SwitchSelectionCommand
+{
+    RealVector2D pos;
+    float radius = 0;
+};
+
+struct SwapSelectionCommand
+{
+    RealVector2D pos;
+    float radius = 0;
+};
+
+struct SetSelectionCommand
+{
+    RealVector2D startPos;
+    RealVector2D endPos;
+};
+
+struct RemoveSelectionCommand
+{};
+
+struct ShallowUpdateSelectedObjectsCommand
+{
+    ShallowUpdateSelectionData updateData;
+};
+
+struct AddAndSelectDataCommand
+{
+    DataDescription data;
+};
+
+struct RemoveSelectedObjectsCommand
+{
+    bool includeClusters = false;
+};
+
+using EngineCommand = std::variant<
+    SetSimulationParametersCommand,
+    SetGpuSettingsCommand,
+    ApplyForceCommand,
+    SwitchSelectionCommand,
+    SwapSelectionCommand,
+    SetSelectionCommand,
+    RemoveSelectionCommand,
+    ShallowUpdateSelectedObjectsCommand,
+    AddAndSelectDataCommand,
+    RemoveSelectedObjectsCommand>;
+
+/**
+ * Bounded lock-free queue for commands which are pushed from arbitrary threads and executed by a single consumer
+ * (the worker thread or a thread holding the worker access) between time steps.
+ * Commands are popped in batches which are coalesced:
+ * - only the latest parameter and GPU settings update of a batch is kept
+ * - adjacent shallow updates of the selection are merged
+ * - adjacent area selections are replaced by the latest one
+ */
+class EngineCommandQueue
+{
+public:
+    static int constexpr DefaultCapacity = 1024;
+
+    EngineCommandQueue(int capacity = DefaultCapacity);  //capacity is rounded up to a power of 2
+
+    bool tryPush(EngineCommand&& command);  //returns false and leaves the command untouched if the queue is full
+    bool isEmpty() const;
+
+    //for a single consumer at a time
+    std::vector<EngineCommand> popAll();
+
+private:
+    std::optional<EngineCommand> tryPop();
+    static std::vector<EngineCommand> coalesce(std::vector<EngineCommand> commands);
+
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence;
+        EngineCommand command;
+    };
+    std::unique_ptr<Slot[]> _slots;
+    uint64_t _mask = 0;
+
+    alignas(64) std::atomic<uint64_t> _pushPos{0};
+    alignas(64) std::atomic<uint64_t> _popPos{0};
+};
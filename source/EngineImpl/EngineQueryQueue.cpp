@@ -0,0 +1,27 @@
+#include "EngineQueryQueue.h"
+
+bool EngineQueryQueue::isEmpty() const
+{
+    std::lock_guard lock(_mutex);
+    return _queries.empty();
+}
+
+void EngineQueryQueue::clear()
+{
+    std::lock_guard lock(_mutex);
+    _queries.clear();
+}
+
+int EngineQueryQueue::process()
+{
+    //queries enqueued during the execution belong to the next batch
+    std::vector<Query> queries;
+    {
+        std::lock_guard lock(_mutex);
+        queries.swap(_queries);
+    }
+    for (auto const& query : queries) {
+        query.execute();
+    }
+    return toInt(queries.size());
+}
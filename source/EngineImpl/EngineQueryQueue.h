@@ -0,0 +1,95 @@
+#pragma once
+
+#include <any>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/ThreadPool.h"
+
+using EngineQueryType = int;
+enum EngineQueryType_
+{
+    EngineQueryType_SimulationData,
+    EngineQueryType_SelectedSimulationData,
+    EngineQueryType_InspectedSimulationData,
+    EngineQueryType_SelectionShallowData,
+    EngineQueryType_Statistics
+};
+
+struct EngineQueryKey
+{
+    EngineQueryType type = EngineQueryType_SimulationData;
+    std::vector<uint64_t> arguments;
+
+    bool operator==(EngineQueryKey const&) const = default;
+};
+
+/**
+ * Read queries which are enqueued from arbitrary threads and executed by the worker thread in batches between time steps.
+ * A query consists of a capture function, which is called on the worker thread while it has access to the simulation and
+ * should only copy data, and the conversion function returned by it, which is called on the thread pool.
+ * Pending queries with equal keys are coalesced and share one result.
+ */
+class EngineQueryQueue
+{
+public:
+    template <typename Result>
+    using Conversion = std::function<Result()>;
+    template <typename Result>
+    using Capture = std::function<Conversion<Result>()>;
+
+    template <typename Result>
+    std::shared_future<Result> enqueue(EngineQueryKey const& key, Capture<Result> const& capture);
+
+    bool isEmpty() const;
+    void clear();  //pending queries are finished with a broken promise
+
+    //for the worker thread, returns the number of executed captures
+    int process();
+
+private:
+    struct Query
+    {
+        EngineQueryKey key;
+        std::function<void()> execute;
+        std::any result;  //shared_future of the result type
+    };
+
+    mutable std::mutex _mutex;
+    std::vector<Query> _queries;
+};
+
+template <typename Result>
+std::shared_future<Result> EngineQueryQueue::enqueue(EngineQueryKey const& key, Capture<Result> const& capture)
+{
+    std::lock_guard lock(_mutex);
+    for (auto const& query : _queries) {
+        if (query.key == key) {
+            return std::any_cast<std::shared_future<Result>>(query.result);
+        }
+    }
+
+    auto promise = std::make_shared<std::promise<Result>>();
+    auto result = promise->get_future().share();
+    auto execute = [promise, capture] {
+        Conversion<Result> conversion;
+        try {
+            conversion = capture();
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+            return;
+        }
+        ThreadPool::getInstance().submit([promise, conversion = std::move(conversion)] {
+            try {
+                promise->set_value(conversion());
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
+    };
+    _queries.emplace_back(Query{key, std::move(execute), result});
+    return result;
+}
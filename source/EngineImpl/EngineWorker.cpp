@@ -3,31 +3,32 @@
 #include <chrono>
 
 #include "EngineGpuKernels/TOs.cuh"
-#include "EngineGpuKernels/CudaSimulationFacade.cuh"
+#include "EngineGpuKernels/SimulationBackend.cuh"
 #include "AccessDataTOCache.h"
 #include "DescriptionConverter.h"
+#include "SimulationDataSnapshotImpl.h"
 
 namespace
 {
     std::chrono::milliseconds const FrameTimeout(500);
+    std::chrono::seconds const AccessTimeout(5);
     std::chrono::milliseconds const StatisticsUpdate(30);
 }
 
-void EngineWorker::initCuda()
+void EngineWorker::newSimulation(
+    uint64_t timestep,
+    GeneralSettings const& generalSettings,
+    SimulationParameters const& parameters,
+    SimulationBackendFactory const& backendFactory)
 {
-    _CudaSimulationFacade::initCuda();
-}
-
-void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters)
-{
-    _accessState = 0;
+    _access.reset();
     _settings.generalSettings = generalSettings;
     _settings.simulationParameters = parameters;
     _dataTOCache = std::make_shared<_AccessDataTOCache>();
-    _cudaSimulation = std::make_shared<_CudaSimulationFacade>(timestep, _settings);
+    _backend = backendFactory(timestep, _settings);
 
     if (_imageResourceToRegister) {
-        _cudaResource = _cudaSimulation->registerImageResource(*_imageResourceToRegister);
+        _cudaResource = _backend->registerImageResource(*_imageResourceToRegister);
         _imageResourceToRegister = std::nullopt;
     }
     updateStatistics();
@@ -36,20 +37,20 @@ void EngineWorker::newSimulation(uint64_t timestep, GeneralSettings const& gener
 void EngineWorker::clear()
 {
     EngineWorkerGuard access(this);
-    return _cudaSimulation->clear();
+    return _backend->clear();
 }
 
 void EngineWorker::registerImageResource(void* image)
 {
     GLuint imageId = reinterpret_cast<uintptr_t>(image);
-    if (!_cudaSimulation) {
+    if (!_backend) {
 
         //cuda is not initialized yet => register image resource later
         _imageResourceToRegister = imageId;
     } else {
 
         EngineWorkerGuard access(this);
-        _cudaResource = _cudaSimulation->registerImageResource(imageId);
+        _cudaResource = _backend->registerImageResource(imageId);
     }
 }
 
@@ -63,7 +64,7 @@ void EngineWorker::tryDrawVectorGraphics(
 
 
     if (!access.isTimeout()) {
-        _cudaSimulation->drawVectorGraphics(
+        _backend->drawVectorGraphics(
             {rectUpperLeft.x, rectUpperLeft.y},
             {rectLowerRight.x, rectLowerRight.y},
             _cudaResource,
@@ -82,7 +83,7 @@ std::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturnOv
     EngineWorkerGuard access(this, FrameTimeout);
 
     if (!access.isTimeout()) {
-        _cudaSimulation->drawVectorGraphics(
+        _backend->drawVectorGraphics(
             {rectUpperLeft.x, rectUpperLeft.y},
             {rectLowerRight.x, rectLowerRight.y},
             _cudaResource,
@@ -91,7 +92,7 @@ std::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturnOv
 
         DataTO dataTO = provideTO();
 
-        _cudaSimulation->getOverlayData(
+        _backend->getOverlayData(
             {toInt(rectUpperLeft.x), toInt(rectUpperLeft.y)},
             int2{toInt(rectLowerRight.x), toInt(rectLowerRight.y)},
             dataTO);
@@ -113,6 +114,7 @@ bool EngineWorker::isSyncSimulationWithRendering() const
 void EngineWorker::setSyncSimulationWithRendering(bool value)
 {
     _syncSimulationWithRendering = value;
+    _access.notifyWorker();
 }
 
 int EngineWorker::getSyncSimulationWithRenderingRatio() const
@@ -131,7 +133,7 @@ ClusteredDataDescription EngineWorker::getClusteredSimulationData(IntVector2D co
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSimulationData(
+    _backend->getSimulationData(
         {rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
@@ -140,13 +142,24 @@ ClusteredDataDescription EngineWorker::getClusteredSimulationData(IntVector2D co
     return result;
 }
 
+SimulationDataSnapshot EngineWorker::getSimulationDataSnapshot(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
+{
+    EngineWorkerGuard access(this);
+
+    DataTO dataTO = provideTO();
+
+    _backend->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
+
+    return std::make_shared<_SimulationDataSnapshotImpl>(dataTO, _settings.simulationParameters);
+}
+
 DataDescription EngineWorker::getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
 {
     EngineWorkerGuard access(this);
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
+    _backend->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -160,7 +173,7 @@ ClusteredDataDescription EngineWorker::getSelectedClusteredSimulationData(bool i
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSelectedSimulationData(includeClusters, dataTO);
+    _backend->getSelectedSimulationData(includeClusters, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -174,7 +187,7 @@ DataDescription EngineWorker::getSelectedSimulationData(bool includeClusters)
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getSelectedSimulationData(includeClusters, dataTO);
+    _backend->getSelectedSimulationData(includeClusters, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -189,7 +202,7 @@ DataDescription EngineWorker::getInspectedSimulationData(std::vector<uint64_t> o
 
     DataTO dataTO = provideTO();
     
-    _cudaSimulation->getInspectedSimulationData(objectsIds, dataTO);
+    _backend->getInspectedSimulationData(objectsIds, dataTO);
 
     DescriptionConverter converter(_settings.simulationParameters);
 
@@ -204,6 +217,81 @@ StatisticsData EngineWorker::getStatistics() const
     return _lastStatistics;
 }
 
+std::shared_future<DataDescription> EngineWorker::getSimulationData_async(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
+{
+    EngineQueryKey key{
+        EngineQueryType_SimulationData,
+        {static_cast<uint64_t>(rectUpperLeft.x), static_cast<uint64_t>(rectUpperLeft.y), static_cast<uint64_t>(rectLowerRight.x), static_cast<uint64_t>(rectLowerRight.y)}};
+    return enqueueQuery<DataDescription>(key, [=, this] {
+        DataTO dataTO = provideTO();
+        _backend->getSimulationData({rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
+        return createConversion(dataTO);
+    });
+}
+
+std::shared_future<DataDescription> EngineWorker::getSelectedSimulationData_async(bool includeClusters)
+{
+    return enqueueQuery<DataDescription>({EngineQueryType_SelectedSimulationData, {includeClusters ? 1ull : 0ull}}, [=, this] {
+        DataTO dataTO = provideTO();
+        _backend->getSelectedSimulationData(includeClusters, dataTO);
+        return createConversion(dataTO);
+    });
+}
+
+std::shared_future<DataDescription> EngineWorker::getInspectedSimulationData_async(std::vector<uint64_t> objectsIds)
+{
+    return enqueueQuery<DataDescription>({EngineQueryType_InspectedSimulationData, objectsIds}, [=, this] {
+        DataTO dataTO = provideTO();
+        _backend->getInspectedSimulationData(objectsIds, dataTO);
+        return createConversion(dataTO);
+    });
+}
+
+std::shared_future<SelectionShallowData> EngineWorker::getSelectionShallowData_async()
+{
+    return enqueueQuery<SelectionShallowData>({EngineQueryType_SelectionShallowData}, [this] {
+        auto selectionShallowData = _backend->getSelectionShallowData();
+        return [=] { return selectionShallowData; };
+    });
+}
+
+std::shared_future<StatisticsData> EngineWorker::getStatistics_async()
+{
+    return enqueueQuery<StatisticsData>({EngineQueryType_Statistics}, [this] {
+        updateStatistics();
+        auto statistics = getStatistics();
+        return [=] { return statistics; };
+    });
+}
+
+PublishedFrame const& EngineWorker::getPublishedFrame()
+{
+    return _publishedFrames.getFrontBuffer();
+}
+
+std::chrono::milliseconds EngineWorker::getPublishingInterval() const
+{
+    return std::chrono::milliseconds(_publishingInterval.load());
+}
+
+void EngineWorker::setPublishingInterval(std::chrono::milliseconds const& value)
+{
+    _publishingInterval.store(toInt(value.count()));
+}
+
+uint64_t EngineWorker::setInspectedEntityIdsForPublishing(std::vector<uint64_t> const& entityIds)
+{
+    uint64_t result;
+    {
+        std::lock_guard lock(_mutexForInspection);
+        _inspectedEntityIdsForPublishing = entityIds;
+        result = ++_inspectionRequest;
+    }
+    _isPublishingRequested = true;
+    _access.notifyWorker();
+    return result;
+}
+
 void EngineWorker::addAndSelectSimulationData(DataDescription const& dataToUpdate)
 {
     DescriptionConverter converter(_settings.simulationParameters);
@@ -212,29 +300,34 @@ void EngineWorker::addAndSelectSimulationData(DataDescription const& dataToUpdat
 
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->resizeArraysIfNecessary(arraySizes);
+    _backend->resizeArraysIfNecessary(arraySizes);
 
     DataTO dataTO = provideTO();
 
     converter.convertDescriptionToTO(dataTO, dataToUpdate);
 
-    _cudaSimulation->addAndSelectSimulationData(dataTO);
+    _backend->addAndSelectSimulationData(dataTO);
     updateStatistics();
 }
 
+void EngineWorker::addAndSelectSimulationData_async(DataDescription const& dataToUpdate)
+{
+    pushCommand(AddAndSelectDataCommand{dataToUpdate});
+}
+
 void EngineWorker::setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate)
 {
     DescriptionConverter converter(_settings.simulationParameters);
 
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
+    _backend->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
 
     DataTO dataTO = provideTO();
 
     converter.convertDescriptionToTO(dataTO, dataToUpdate);
 
-    _cudaSimulation->setSimulationData(dataTO);
+    _backend->setSimulationData(dataTO);
     updateStatistics();
 }
 
@@ -244,12 +337,12 @@ void EngineWorker::setSimulationData(DataDescription const& dataToUpdate)
 
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
+    _backend->resizeArraysIfNecessary(converter.getArraySizes(dataToUpdate));
 
     DataTO dataTO = provideTO();
     converter.convertDescriptionToTO(dataTO, dataToUpdate);
 
-    _cudaSimulation->setSimulationData(dataTO);
+    _backend->setSimulationData(dataTO);
     updateStatistics();
 }
 
@@ -257,43 +350,48 @@ void EngineWorker::removeSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->removeSelectedObjects(includeClusters);
+    _backend->removeSelectedObjects(includeClusters);
     updateStatistics();
 }
 
+void EngineWorker::removeSelectedObjects_async(bool includeClusters)
+{
+    pushCommand(RemoveSelectedObjectsCommand{includeClusters});
+}
+
 void EngineWorker::relaxSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->relaxSelectedObjects(includeClusters);
+    _backend->relaxSelectedObjects(includeClusters);
 }
 
 void EngineWorker::uniformVelocitiesForSelectedObjects(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->uniformVelocitiesForSelectedObjects(includeClusters);
+    _backend->uniformVelocitiesForSelectedObjects(includeClusters);
 }
 
 void EngineWorker::makeSticky(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->makeSticky(includeClusters);
+    _backend->makeSticky(includeClusters);
 }
 
 void EngineWorker::removeStickiness(bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->removeStickiness(includeClusters);
+    _backend->removeStickiness(includeClusters);
 }
 
 void EngineWorker::setBarrier(bool value, bool includeClusters)
 {
     EngineWorkerGuard access(this);
 
-    _cudaSimulation->setBarrier(value, includeClusters);
+    _backend->setBarrier(value, includeClusters);
 }
 
 void EngineWorker::changeCell(CellDescription const& changedCell)
@@ -305,7 +403,7 @@ void EngineWorker::changeCell(CellDescription const& changedCell)
     DescriptionConverter converter(_settings.simulationParameters);
     converter.convertDescriptionToTO(dataTO, changedCell);
 
-    _cudaSimulation->changeInspectedSimulationData(dataTO);
+    _backend->changeInspectedSimulationData(dataTO);
 }
 
 void EngineWorker::changeParticle(ParticleDescription const& changedParticle)
@@ -317,27 +415,28 @@ void EngineWorker::changeParticle(ParticleDescription const& changedParticle)
     DescriptionConverter converter(_settings.simulationParameters);
     converter.convertDescriptionToTO(dataTO, changedParticle);
 
-    _cudaSimulation->changeInspectedSimulationData(dataTO);
+    _backend->changeInspectedSimulationData(dataTO);
 }
 
 void EngineWorker::calcSingleTimestep()
 {
     EngineWorkerGuard access(this);
-
-    _cudaSimulation->calcTimestep();
-    updateStatistics();
+    calcTimestepWithinAccess();
 }
 
 void EngineWorker::beginShutdown()
 {
     _isShutdown.store(true);
+    _access.notifyWorker();
 }
 
 void EngineWorker::endShutdown()
 {
     _isSimulationRunning = false;
     _isShutdown = false;
-    _cudaSimulation.reset();
+    _commands.popAll();
+    _queries.clear();
+    _backend.reset();
 }
 
 int EngineWorker::getTpsRestriction() const
@@ -358,32 +457,30 @@ float EngineWorker::getTps() const
 
 uint64_t EngineWorker::getCurrentTimestep() const
 {
-    return _cudaSimulation->getCurrentTimestep();
+    return _backend->getCurrentTimestep();
 }
 
 void EngineWorker::setCurrentTimestep(uint64_t value)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setCurrentTimestep(value);
+    _backend->setCurrentTimestep(value);
     resetTimeIntervalStatistics();
 }
 
 void EngineWorker::setSimulationParameters(SimulationParameters const& parameters)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setSimulationParameters(parameters);
+    _backend->setSimulationParameters(parameters);
 }
 
 void EngineWorker::setSimulationParameters_async(SimulationParameters const& parameters)
 {
-    std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
-    _updateSimulationParametersJob = parameters;
+    pushCommand(SetSimulationParametersCommand{std::make_shared<SimulationParameters const>(parameters)});
 }
 
 void EngineWorker::setGpuSettings_async(GpuSettings const& gpuSettings)
 {
-    std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
-    _updateGpuSettingsJob = gpuSettings;
+    pushCommand(SetGpuSettingsCommand{gpuSettings});
 }
 
 void EngineWorker::applyForce_async(
@@ -392,60 +489,84 @@ void EngineWorker::applyForce_async(
     RealVector2D const& force,
     float radius)
 {
-    std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
-    _applyForceJobs.emplace_back(ApplyForceJob{start, end, force, radius});
+    pushCommand(ApplyForceCommand{start, end, force, radius});
 }
 
 void EngineWorker::switchSelection(RealVector2D const& pos, float radius)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->switchSelection(PointSelectionData{{pos.x, pos.y}, radius});
+    _backend->switchSelection(PointSelectionData{{pos.x, pos.y}, radius});
+}
+
+void EngineWorker::switchSelection_async(RealVector2D const& pos, float radius)
+{
+    pushCommand(SwitchSelectionCommand{pos, radius});
 }
 
 void EngineWorker::swapSelection(RealVector2D const& pos, float radius)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->swapSelection(PointSelectionData{{pos.x, pos.y}, radius});
+    _backend->swapSelection(PointSelectionData{{pos.x, pos.y}, radius});
+}
+
+void EngineWorker::swapSelection_async(RealVector2D const& pos, float radius)
+{
+    pushCommand(SwapSelectionCommand{pos, radius});
 }
 
 SelectionShallowData EngineWorker::getSelectionShallowData()
 {
     EngineWorkerGuard access(this);
-    return _cudaSimulation->getSelectionShallowData();
+    return _backend->getSelectionShallowData();
 }
 
 void EngineWorker::setSelection(RealVector2D const& startPos, RealVector2D const& endPos)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setSelection(AreaSelectionData{{startPos.x, startPos.y}, {endPos.x, endPos.y}});
+    _backend->setSelection(AreaSelectionData{{startPos.x, startPos.y}, {endPos.x, endPos.y}});
+}
+
+void EngineWorker::setSelection_async(RealVector2D const& startPos, RealVector2D const& endPos)
+{
+    pushCommand(SetSelectionCommand{startPos, endPos});
 }
 
 void EngineWorker::removeSelection()
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->removeSelection();
+    _backend->removeSelection();
 
     updateStatistics();
 }
 
+void EngineWorker::removeSelection_async()
+{
+    pushCommand(RemoveSelectionCommand());
+}
+
 void EngineWorker::updateSelection()
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->updateSelection();
+    _backend->updateSelection();
 }
 
 void EngineWorker::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->shallowUpdateSelectedObjects(updateData);
+    _backend->shallowUpdateSelectedObjects(updateData);
 
     updateStatistics();
 }
 
+void EngineWorker::shallowUpdateSelectedObjects_async(ShallowUpdateSelectionData const& updateData)
+{
+    pushCommand(ShallowUpdateSelectedObjectsCommand{updateData});
+}
+
 void EngineWorker::colorSelectedObjects(unsigned char color, bool includeClusters)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->colorSelectedObjects(color, includeClusters);
+    _backend->colorSelectedObjects(color, includeClusters);
 
     updateStatistics();
 }
@@ -453,26 +574,24 @@ void EngineWorker::colorSelectedObjects(unsigned char color, bool includeCluster
 void EngineWorker::reconnectSelectedObjects()
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->reconnectSelectedObjects();
+    _backend->reconnectSelectedObjects();
 }
 
 void EngineWorker::setDetached(bool value)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->setDetached(value);
+    _backend->setDetached(value);
 }
 
 void EngineWorker::runThreadLoop()
 {
     try {
-        std::mutex mutexForLoop;
-        std::unique_lock<std::mutex> lockForLoop(mutexForLoop);
-
         while (!_isShutdown.load()) {
 
-            if (!_syncSimulationWithRendering && _accessState == 0) {
+            if (!_syncSimulationWithRendering && _access.isWorkerAccess()) {
                 if (_isSimulationRunning.load()) {
-                    _cudaSimulation->calcTimestep();
+                    _backend->calcTimestep();
+                    _isPublishingRequested = true;
 
                     if (++_statisticsCounter == 3) {  //for performance reasons...
                         updateStatistics(true);
@@ -483,11 +602,14 @@ void EngineWorker::runThreadLoop()
                 slowdownTPS();
             }
             
-            processJobs();
-
-            if (_accessState == 1) {
-                _accessState = 2;
+            processCommands();
+            _queries.process();
+            if (isFramePublishingDue()) {
+                publishFrame();
             }
+
+            //sleeps while paused and nothing is to be done
+            _access.waitForWorkAndGrantAccess([this] { return isWorkPending(); });
         }
     } catch (std::exception const& e) {
         std::unique_lock<std::mutex> uniqueLock(_exceptionData.mutex);
@@ -498,6 +620,7 @@ void EngineWorker::runThreadLoop()
 void EngineWorker::runSimulation()
 {
     _isSimulationRunning.store(true);
+    _access.notifyWorker();
 }
 
 void EngineWorker::pauseSimulation()
@@ -514,18 +637,32 @@ bool EngineWorker::isSimulationRunning() const
 void EngineWorker::testOnly_mutate(uint64_t cellId, MutationType mutationType)
 {
     EngineWorkerGuard access(this);
-    _cudaSimulation->testOnly_mutate(cellId, mutationType);
+    _backend->testOnly_mutate(cellId, mutationType);
 }
 
 DataTO EngineWorker::provideTO()
 {
-    return _dataTOCache->getDataTO(_cudaSimulation->getArraySizes());
+    return _dataTOCache->getDataTO(_backend->getArraySizes());
+}
+
+EngineQueryQueue::Conversion<DataDescription> EngineWorker::createConversion(DataTO const& dataTO) const
+{
+    auto snapshot = std::make_shared<_SimulationDataSnapshotImpl>(dataTO, _settings.simulationParameters);
+    return [snapshot] { return snapshot->convertToDataDescription(); };
+}
+
+template <typename Result>
+std::shared_future<Result> EngineWorker::enqueueQuery(EngineQueryKey const& key, EngineQueryQueue::Capture<Result> const& capture)
+{
+    auto result = _queries.enqueue(key, capture);
+    _access.notifyWorker();
+    return result;
 }
 
 void EngineWorker::resetTimeIntervalStatistics()
 {
     std::lock_guard guard(_mutexForStatistics);
-    _cudaSimulation->resetTimeIntervalStatistics();
+    _backend->resetTimeIntervalStatistics();
 }
 
 void EngineWorker::updateStatistics(bool afterMinDuration)
@@ -534,40 +671,133 @@ void EngineWorker::updateStatistics(bool afterMinDuration)
     if (!afterMinDuration  || !_lastStatisticsUpdateTime || now - *_lastStatisticsUpdateTime > StatisticsUpdate) {
 
         std::lock_guard guard(_mutexForStatistics);
-        _lastStatistics = _cudaSimulation->getStatistics();
+        _lastStatistics = _backend->getStatistics();
         _lastStatisticsUpdateTime = now;
     }
 }
 
-void EngineWorker::processJobs()
+void EngineWorker::pushCommand(EngineCommand&& command)
 {
-    std::unique_lock<std::mutex> asyncJobsLock(_mutexForAsyncJobs);
-    if (_updateSimulationParametersJob) {
-        _cudaSimulation->setSimulationParameters(*_updateSimulationParametersJob);
-        _updateSimulationParametersJob = std::nullopt;
+    if (!_commands.tryPush(std::move(command))) {
+
+        //queue is full => execute synchronously after the pending commands, concurrent pushing threads are served one after another
+        //since the access is not re-entrant, commands must not be pushed while holding it
+        EngineWorkerGuard access(this);
+        executeCommand(command);
+        return;
     }
-    if (_updateGpuSettingsJob) {
-        _cudaSimulation->setGpuConstants(*_updateGpuSettingsJob);
-        _updateGpuSettingsJob = std::nullopt;
+    _access.notifyWorker();
+}
+
+void EngineWorker::processCommands()
+{
+    for (auto const& command : _commands.popAll()) {
+        executeCommand(command);
     }
-    if (!_applyForceJobs.empty()) {
-        for (auto const& applyForceJob : _applyForceJobs) {
-            _cudaSimulation->applyForce(
-                {{applyForceJob.start.x, applyForceJob.start.y},
-                 {applyForceJob.end.x, applyForceJob.end.y},
-                 {applyForceJob.force.x, applyForceJob.force.y},
-                 applyForceJob.radius,
-                 false});
-        }
-        _applyForceJobs.clear();
+}
+
+void EngineWorker::executeCommand(EngineCommand const& command)
+{
+    if (auto setParameters = std::get_if<SetSimulationParametersCommand>(&command)) {
+        _backend->setSimulationParameters(*setParameters->parameters);
+    } else if (auto setGpuSettings = std::get_if<SetGpuSettingsCommand>(&command)) {
+        _backend->setGpuConstants(setGpuSettings->gpuSettings);
+    } else if (auto applyForce = std::get_if<ApplyForceCommand>(&command)) {
+        _backend->applyForce(
+            {{applyForce->start.x, applyForce->start.y},
+             {applyForce->end.x, applyForce->end.y},
+             {applyForce->force.x, applyForce->force.y},
+             applyForce->radius,
+             false});
+    } else if (auto switchSelection = std::get_if<SwitchSelectionCommand>(&command)) {
+        _backend->switchSelection(PointSelectionData{{switchSelection->pos.x, switchSelection->pos.y}, switchSelection->radius});
+    } else if (auto swapSelection = std::get_if<SwapSelectionCommand>(&command)) {
+        _backend->swapSelection(PointSelectionData{{swapSelection->pos.x, swapSelection->pos.y}, swapSelection->radius});
+    } else if (auto setSelection = std::get_if<SetSelectionCommand>(&command)) {
+        _backend->setSelection(
+            AreaSelectionData{{setSelection->startPos.x, setSelection->startPos.y}, {setSelection->endPos.x, setSelection->endPos.y}});
+    } else if (std::holds_alternative<RemoveSelectionCommand>(command)) {
+        _backend->removeSelection();
+        updateStatistics();
+    } else if (auto shallowUpdate = std::get_if<ShallowUpdateSelectedObjectsCommand>(&command)) {
+        _backend->shallowUpdateSelectedObjects(shallowUpdate->updateData);
+        updateStatistics();
+    } else if (auto addData = std::get_if<AddAndSelectDataCommand>(&command)) {
+        DescriptionConverter converter(_settings.simulationParameters);
+        _backend->resizeArraysIfNecessary(converter.getArraySizes(addData->data));
+
+        DataTO dataTO = provideTO();
+        converter.convertDescriptionToTO(dataTO, addData->data);
+        _backend->addAndSelectSimulationData(dataTO);
+        updateStatistics();
+    } else if (auto removeObjects = std::get_if<RemoveSelectedObjectsCommand>(&command)) {
+        _backend->removeSelectedObjects(removeObjects->includeClusters);
+        updateStatistics();
     }
+    _isPublishingRequested = true;
+}
+
+bool EngineWorker::isWorkPending() const
+{
+    if (_isShutdown.load() || (_isSimulationRunning.load() && !_syncSimulationWithRendering)) {
+        return true;
+    }
+    return !_commands.isEmpty() || !_queries.isEmpty() || isFramePublishingDue();
+}
+
+bool EngineWorker::isFramePublishingDue() const
+{
+    if (!_isPublishingRequested.load()) {
+        return false;
+    }
+
+    //the interval only applies while the thread loop is busy, otherwise the worker would not wake up for a delayed frame
+    if (!_isSimulationRunning.load() || _syncSimulationWithRendering.load()) {
+        return true;
+    }
+    return !_lastPublishingTime || std::chrono::steady_clock::now() - *_lastPublishingTime >= std::chrono::milliseconds(_publishingInterval.load());
+}
+
+void EngineWorker::publishFrame()
+{
+    _isPublishingRequested = false;
+    _lastPublishingTime = std::chrono::steady_clock::now();
+
+    auto& frame = _publishedFrames.getBackBuffer();
+    frame.version = ++_publishedFrameVersion;
+    frame.timestep = _backend->getCurrentTimestep();
+    frame.statistics = getStatistics();
+    frame.selection = _backend->getSelectionShallowData();
+
+    std::vector<uint64_t> inspectedEntityIds;
+    {
+        std::lock_guard lock(_mutexForInspection);
+        inspectedEntityIds = _inspectedEntityIdsForPublishing;
+        frame.inspectionRequest = _inspectionRequest;
+    }
+    if (!inspectedEntityIds.empty()) {
+        DataTO dataTO = provideTO();
+        _backend->getInspectedSimulationData(inspectedEntityIds, dataTO);
+
+        DescriptionConverter converter(_settings.simulationParameters);
+        frame.inspectedData = converter.convertTOtoDataDescription(dataTO);
+    } else {
+        frame.inspectedData.clear();
+    }
+    _publishedFrames.publish();
+}
+
+void EngineWorker::calcTimestepWithinAccess()
+{
+    _backend->calcTimestep();
+    updateStatistics();
 }
 
 void EngineWorker::syncSimulationWithRenderingIfDesired()
 {
     if (_syncSimulationWithRendering && _isSimulationRunning) {
         for (int i = 0; i < _syncSimulationWithRenderingRatio; ++i) {
-            calcSingleTimestep();
+            calcTimestepWithinAccess();
             measureTPS();
             slowdownTPS();
         }
@@ -576,12 +806,7 @@ void EngineWorker::syncSimulationWithRenderingIfDesired()
 
 void EngineWorker::waitAndAllowAccess(std::chrono::microseconds const& duration)
 {
-    auto startTimepoint = std::chrono::steady_clock::now();
-    while (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTimepoint) < duration) {
-        if (_accessState == 1) {
-            _accessState = 2;
-        }
-    }
+    _access.waitAndGrantAccess(duration);
 }
 
 void EngineWorker::measureTPS()
@@ -631,29 +856,31 @@ void EngineWorker::slowdownTPS()
 EngineWorkerGuard::EngineWorkerGuard(EngineWorker* worker, std::optional<std::chrono::milliseconds> const& maxDuration)
     : _worker(worker)
 {
-    worker->_accessState = 1;
+    checkForException(worker->_exceptionData);
 
-    auto startTimepoint = std::chrono::steady_clock::now();
-    while (worker->_accessState == 1) {
-        auto timePassed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTimepoint);
-        if (maxDuration) {
-            if (timePassed > *maxDuration) {
-                break;
-            }
-        } else {
-            if (timePassed > std::chrono::seconds(5)) {
-                _isTimeout = true;
-                throw std::runtime_error("GPU Timeout");
-            }
+    if (!worker->_access.acquire(maxDuration ? *maxDuration : AccessTimeout)) {
+        _isTimeout = true;
+        if (!maxDuration) {
+            throw std::runtime_error("GPU Timeout");
         }
+        return;
     }
 
-    checkForException(worker->_exceptionData);
+    //pending commands precede the access
+    try {
+        worker->processCommands();
+    } catch (...) {
+        worker->_access.release();
+        throw;
+    }
 }
 
 EngineWorkerGuard::~EngineWorkerGuard()
 {
-    _worker->_accessState = 0;
+    if (!_isTimeout) {
+        _worker->_isPublishingRequested = true;
+        _worker->_access.release();
+    }
 }
 
 bool EngineWorkerGuard::isTimeout() const
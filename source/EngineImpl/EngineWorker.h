@@ -3,6 +3,8 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
+#include <future>
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -20,9 +22,14 @@
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/ShallowUpdateSelectionData.h"
 #include "EngineInterface/MutationType.h"
+#include "EngineInterface/PublishedFrame.h"
 #include "EngineGpuKernels/Definitions.h"
 
 #include "Definitions.h"
+#include "EngineCommandQueue.h"
+#include "EngineQueryQueue.h"
+#include "EngineWorkerAccess.h"
+#include "TripleBuffer.h"
 
 struct ExceptionData
 {
@@ -32,13 +39,17 @@ struct ExceptionData
 
 struct DataTO;
 
+using SimulationBackendFactory = std::function<SimulationBackend(uint64_t timestep, Settings const& settings)>;
+
 class EngineWorker
 {
     friend class EngineWorkerGuard;
 public:
-    void initCuda();
-
-    void newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters);
+    void newSimulation(
+        uint64_t timestep,
+        GeneralSettings const& generalSettings,
+        SimulationParameters const& parameters,
+        SimulationBackendFactory const& backendFactory);
     void clear();
 
     void registerImageResource(void* image);
@@ -53,16 +64,32 @@ public:
     void setSyncSimulationWithRenderingRatio(int value);
 
     ClusteredDataDescription getClusteredSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    SimulationDataSnapshot getSimulationDataSnapshot(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
     DataDescription getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
     ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters);
     DataDescription getSelectedSimulationData(bool includeClusters);
     DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds);
     StatisticsData getStatistics() const;
 
+    //queries which are executed between time steps, see EngineQueryQueue
+    std::shared_future<DataDescription> getSimulationData_async(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    std::shared_future<DataDescription> getSelectedSimulationData_async(bool includeClusters);
+    std::shared_future<DataDescription> getInspectedSimulationData_async(std::vector<uint64_t> objectsIds);
+    std::shared_future<SelectionShallowData> getSelectionShallowData_async();
+    std::shared_future<StatisticsData> getStatistics_async();
+
+    //published frames can be read by a single thread without blocking, the reference stays valid until the next call
+    PublishedFrame const& getPublishedFrame();
+    std::chrono::milliseconds getPublishingInterval() const;
+    void setPublishingInterval(std::chrono::milliseconds const& value);
+    uint64_t setInspectedEntityIdsForPublishing(std::vector<uint64_t> const& entityIds);  //returns the inspection request
+
     void addAndSelectSimulationData(DataDescription const& dataToUpdate);
+    void addAndSelectSimulationData_async(DataDescription const& dataToUpdate);
     void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate);
     void setSimulationData(DataDescription const& dataToUpdate);
     void removeSelectedObjects(bool includeClusters);
+    void removeSelectedObjects_async(bool includeClusters);
     void relaxSelectedObjects(bool includeClusters);
     void uniformVelocitiesForSelectedObjects(bool includeClusters);
     void makeSticky(bool includeClusters);
@@ -90,12 +117,17 @@ public:
     void applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius);
 
     void switchSelection(RealVector2D const& pos, float radius);
+    void switchSelection_async(RealVector2D const& pos, float radius);
     void swapSelection(RealVector2D const& pos, float radius);
+    void swapSelection_async(RealVector2D const& pos, float radius);
     SelectionShallowData getSelectionShallowData();
     void setSelection(RealVector2D const& startPos, RealVector2D const& endPos);
+    void setSelection_async(RealVector2D const& startPos, RealVector2D const& endPos);
     void removeSelection();
+    void removeSelection_async();
     void updateSelection();
     void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData);
+    void shallowUpdateSelectedObjects_async(ShallowUpdateSelectionData const& updateData);
     void colorSelectedObjects(unsigned char color, bool includeClusters);
     void reconnectSelectedObjects();
     void setDetached(bool value);
@@ -110,16 +142,25 @@ public:
 
 private:
     DataTO provideTO(); 
+    EngineQueryQueue::Conversion<DataDescription> createConversion(DataTO const& dataTO) const;
+    template <typename Result>
+    std::shared_future<Result> enqueueQuery(EngineQueryKey const& key, EngineQueryQueue::Capture<Result> const& capture);
     void resetTimeIntervalStatistics();
     void updateStatistics(bool afterMinDuration = false);
-    void processJobs();
-
-    void syncSimulationWithRenderingIfDesired();
+    void pushCommand(EngineCommand&& command);
+    void processCommands();
+    void executeCommand(EngineCommand const& command);
+    bool isWorkPending() const;
+    bool isFramePublishingDue() const;
+    void publishFrame();
+
+    void calcTimestepWithinAccess();  //caller must hold the access
+    void syncSimulationWithRenderingIfDesired();  //caller must hold the access
     void waitAndAllowAccess(std::chrono::microseconds const& duration);
     void measureTPS();
     void slowdownTPS();
 
-    CudaSimulationFacade _cudaSimulation;
+    SimulationBackend _backend;
 
     //settings
     Settings _settings;
@@ -127,25 +168,25 @@ private:
     //sync
     std::atomic<bool> _syncSimulationWithRendering{false};
     std::atomic<int> _syncSimulationWithRenderingRatio{2};
-    std::atomic<int> _accessState{0};  //0 = worker thread has access, 1 = require access from other thread, 2 = access granted to other thread
+    EngineWorkerAccess _access;
     std::atomic<bool> _isSimulationRunning{false};
     std::atomic<bool> _isShutdown{false};
     ExceptionData _exceptionData;
 
     //async jobs
-    mutable std::mutex _mutexForAsyncJobs;
-    std::optional<SimulationParameters> _updateSimulationParametersJob;
-    std::optional<GpuSettings> _updateGpuSettingsJob;
     std::optional<GLuint> _imageResourceToRegister;
-
-    struct ApplyForceJob
-    {
-        RealVector2D start;
-        RealVector2D end;
-        RealVector2D force;
-        float radius;
-    };
-    std::vector<ApplyForceJob> _applyForceJobs;
+    EngineCommandQueue _commands;
+    EngineQueryQueue _queries;
+
+    //published frames
+    TripleBuffer<PublishedFrame> _publishedFrames;
+    std::atomic<int> _publishingInterval{15};  //in milliseconds
+    std::atomic<bool> _isPublishingRequested{true};  //set after the simulation may have changed
+    std::optional<std::chrono::steady_clock::time_point> _lastPublishingTime;
+    uint64_t _publishedFrameVersion = 0;
+    mutable std::mutex _mutexForInspection;
+    std::vector<uint64_t> _inspectedEntityIdsForPublishing;
+    uint64_t _inspectionRequest = 0;
 
     //time step measurements
     std::atomic<int> _tpsRestriction{0};  //0 = no restriction
@@ -0,0 +1,86 @@
+#include "EngineWorkerAccess.h"
+
+bool EngineWorkerAccess::acquire(std::chrono::microseconds const& maxDuration)
+{
+    auto deadline = std::chrono::steady_clock::now() + maxDuration;
+    std::unique_lock lock(_mutex);
+    if (!_condition.wait_until(lock, deadline, [this] { return !_isRequesterActive; })) {
+        return false;
+    }
+    _isRequesterActive = true;
+
+    _state = WorkerAccessState_AccessRequested;
+    _condition.notify_all();
+    if (!_condition.wait_until(lock, deadline, [this] { return _state == WorkerAccessState_AccessGranted; })) {
+        _state = WorkerAccessState_WorkerHasAccess;
+        _isRequesterActive = false;
+        lock.unlock();
+        _condition.notify_all();
+        return false;
+    }
+    return true;
+}
+
+void EngineWorkerAccess::release()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _state = WorkerAccessState_WorkerHasAccess;
+        _isRequesterActive = false;
+    }
+    _condition.notify_all();
+}
+
+bool EngineWorkerAccess::isWorkerAccess() const
+{
+    return _state == WorkerAccessState_WorkerHasAccess;
+}
+
+void EngineWorkerAccess::grantAccessIfRequested()
+{
+    std::unique_lock lock(_mutex);
+    grantAccessIfRequested(lock);
+}
+
+void EngineWorkerAccess::waitAndGrantAccess(std::chrono::microseconds const& duration)
+{
+    auto deadline = std::chrono::steady_clock::now() + duration;
+    std::unique_lock lock(_mutex);
+    do {
+        grantAccessIfRequested(lock);
+    } while (_condition.wait_until(lock, deadline, [this] { return _state == WorkerAccessState_AccessRequested; }));
+}
+
+void EngineWorkerAccess::waitForWorkAndGrantAccess(std::function<bool()> const& isWorkPending)
+{
+    std::unique_lock lock(_mutex);
+    grantAccessIfRequested(lock);
+    while (!isWorkPending()) {
+        _condition.wait(lock, [&] { return _state == WorkerAccessState_AccessRequested || isWorkPending(); });
+        grantAccessIfRequested(lock);
+    }
+}
+
+void EngineWorkerAccess::notifyWorker()
+{
+    {
+        std::lock_guard lock(_mutex);
+    }
+    _condition.notify_all();
+}
+
+void EngineWorkerAccess::reset()
+{
+    std::lock_guard lock(_mutex);
+    _state = WorkerAccessState_WorkerHasAccess;
+    _isRequesterActive = false;
+}
+
+void EngineWorkerAccess::grantAccessIfRequested(std::unique_lock<std::mutex>& lock)
+{
+    while (_state == WorkerAccessState_AccessRequested) {
+        _state = WorkerAccessState_AccessGranted;
+        _condition.notify_all();
+        _condition.wait(lock, [this] { return _state != WorkerAccessState_AccessGranted; });
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+using WorkerAccessState = int;
+enum WorkerAccessState_
+{
+    WorkerAccessState_WorkerHasAccess,
+    WorkerAccessState_AccessRequested,
+    WorkerAccessState_AccessGranted
+};
+
+/**
+ * Blocking handoff of the simulation access between the worker thread and other threads.
+ * A thread requesting access sleeps until the worker grants it, and the worker thread sleeps while access is granted
+ * and while it has nothing to do. Concurrent requesting threads are served one after another.
+ * The access is not re-entrant: a thread holding it must not request it again, e.g. via a nested EngineWorkerGuard.
+ */
+class EngineWorkerAccess
+{
+public:
+    //methods for other threads
+    bool acquire(std::chrono::microseconds const& maxDuration);  //returns false if access has not been granted in time
+    void release();
+
+    //methods for the worker thread
+    bool isWorkerAccess() const;
+    void grantAccessIfRequested();  //returns after access has been released
+    void waitAndGrantAccess(std::chrono::microseconds const& duration);
+    void waitForWorkAndGrantAccess(std::function<bool()> const& isWorkPending);
+
+    //has to be called after changing the state evaluated by isWorkPending
+    void notifyWorker();
+
+    void reset();
+
+private:
+    void grantAccessIfRequested(std::unique_lock<std::mutex>& lock);
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _isRequesterActive = false;  //set by a requesting thread from acquire until release
+    std::atomic<WorkerAccessState> _state{WorkerAccessState_WorkerHasAccess};
+};
@@ -0,0 +1,453 @@
+#include "HostSimulationBackend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_set>
+
+namespace
+{
+    void rebaseAuxiliaryDataIndices(CellTO& cell, uint64_t offset)
+    {
+        cell.metadata.nameDataIndex += offset;
+        cell.metadata.descriptionDataIndex += offset;
+        if (cell.cellFunction == CellFunction_Neuron) {
+            cell.cellFunctionData.neuron.weightsAndBiasesDataIndex += offset;
+        } else if (cell.cellFunction == CellFunction_Constructor) {
+            cell.cellFunctionData.constructor.genomeDataIndex += offset;
+        } else if (cell.cellFunction == CellFunction_Injector) {
+            cell.cellFunctionData.injector.genomeDataIndex += offset;
+        }
+    }
+
+    float wrap(float value, int size)
+    {
+        auto result = std::fmod(value, static_cast<float>(size));
+        return result < 0 ? result + static_cast<float>(size) : result;
+    }
+
+    bool isInRect(float2 const& pos, float2 const& upperLeft, float2 const& lowerRight)
+    {
+        return pos.x >= upperLeft.x && pos.x <= lowerRight.x && pos.y >= upperLeft.y && pos.y <= lowerRight.y;
+    }
+
+    bool isInCircle(float2 const& pos, float2 const& center, float radius)
+    {
+        auto dx = pos.x - center.x;
+        auto dy = pos.y - center.y;
+        return dx * dx + dy * dy <= radius * radius;
+    }
+}
+
+_HostSimulationBackend::_HostSimulationBackend(uint64_t timestep, Settings const& settings, std::chrono::microseconds const& timestepDuration)
+    : _settings(settings)
+    , _timestepDuration(timestepDuration)
+    , _timestep(timestep)
+{}
+
+void* _HostSimulationBackend::registerImageResource(GLuint image)
+{
+    return nullptr;
+}
+
+void _HostSimulationBackend::calcTimestep()
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    auto timestepSize = _settings.simulationParameters.timestepSize;
+    auto const& worldSize = _settings.generalSettings;
+    for (auto& cell : _cells) {
+        cell.pos = {wrap(cell.pos.x + cell.vel.x * timestepSize, worldSize.worldSizeX), wrap(cell.pos.y + cell.vel.y * timestepSize, worldSize.worldSizeY)};
+        ++cell.age;
+    }
+    for (auto& particle : _particles) {
+        particle.pos = {
+            wrap(particle.pos.x + particle.vel.x * timestepSize, worldSize.worldSizeX), wrap(particle.pos.y + particle.vel.y * timestepSize, worldSize.worldSizeY)};
+    }
+    ++_timestep;
+
+    //busy waiting mimics a GPU which keeps the calling thread occupied
+    while (std::chrono::steady_clock::now() - startTime < _timestepDuration) {
+    }
+}
+
+void _HostSimulationBackend::drawVectorGraphics(
+    float2 const& rectUpperLeft,
+    float2 const& rectLowerRight,
+    void* cudaResource,
+    int2 const& imageSize,
+    double zoom)
+{}
+
+void _HostSimulationBackend::getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+{
+    float2 upperLeft{toFloat(rectUpperLeft.x), toFloat(rectUpperLeft.y)};
+    float2 lowerRight{toFloat(rectLowerRight.x), toFloat(rectLowerRight.y)};
+    copyToTO(
+        dataTO,
+        [&](CellTO const& cell) { return isInRect(cell.pos, upperLeft, lowerRight); },
+        [&](ParticleTO const& particle) { return isInRect(particle.pos, upperLeft, lowerRight); });
+}
+
+void _HostSimulationBackend::getSelectedSimulationData(bool includeClusters, DataTO const& dataTO)
+{
+    copyToTO(dataTO, [](CellTO const& cell) { return cell.selected != 0; }, [](ParticleTO const& particle) { return particle.selected != 0; });
+}
+
+void _HostSimulationBackend::getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO)
+{
+    std::unordered_set<uint64_t> entityIdSet(entityIds.begin(), entityIds.end());
+    copyToTO(
+        dataTO,
+        [&](CellTO const& cell) { return entityIdSet.contains(cell.id); },
+        [&](ParticleTO const& particle) { return entityIdSet.contains(particle.id); });
+}
+
+void _HostSimulationBackend::getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO)
+{
+    getSimulationData(rectUpperLeft, rectLowerRight, dataTO);
+}
+
+void _HostSimulationBackend::addAndSelectSimulationData(DataTO const& dataTO)
+{
+    removeSelection();
+    appendFromTO(dataTO, true);
+}
+
+void _HostSimulationBackend::setSimulationData(DataTO const& dataTO)
+{
+    clear();
+    appendFromTO(dataTO, false);
+}
+
+void _HostSimulationBackend::removeSelectedObjects(bool includeClusters)
+{
+    std::vector<int> newCellIndices(_cells.size(), -1);
+    std::vector<CellTO> cells;
+    for (int i = 0; i < toInt(_cells.size()); ++i) {
+        if (!_cells[i].selected) {
+            newCellIndices[i] = toInt(cells.size());
+            cells.emplace_back(_cells[i]);
+        }
+    }
+    for (auto& cell : cells) {
+        int numConnections = 0;
+        for (int i = 0; i < cell.numConnections; ++i) {
+            auto newIndex = newCellIndices[cell.connections[i].cellIndex];
+            if (newIndex != -1) {
+                cell.connections[numConnections] = cell.connections[i];
+                cell.connections[numConnections].cellIndex = newIndex;
+                ++numConnections;
+            }
+        }
+        cell.numConnections = numConnections;
+    }
+    _cells = std::move(cells);
+    std::erase_if(_particles, [](ParticleTO const& particle) { return particle.selected != 0; });
+}
+
+void _HostSimulationBackend::relaxSelectedObjects(bool includeClusters) {}
+
+void _HostSimulationBackend::uniformVelocitiesForSelectedObjects(bool includeClusters)
+{
+    auto selectionData = getSelectionShallowData();
+    for (auto& cell : _cells) {
+        if (cell.selected) {
+            cell.vel = {selectionData.centerVelX, selectionData.centerVelY};
+        }
+    }
+    for (auto& particle : _particles) {
+        if (particle.selected) {
+            particle.vel = {selectionData.centerVelX, selectionData.centerVelY};
+        }
+    }
+}
+
+void _HostSimulationBackend::makeSticky(bool includeClusters) {}
+
+void _HostSimulationBackend::removeStickiness(bool includeClusters) {}
+
+void _HostSimulationBackend::setBarrier(bool value, bool includeClusters)
+{
+    for (auto& cell : _cells) {
+        if (cell.selected) {
+            cell.barrier = value;
+        }
+    }
+}
+
+void _HostSimulationBackend::changeInspectedSimulationData(DataTO const& changeDataTO)
+{
+    auto auxiliaryDataOffset = _auxiliaryData.size();
+    _auxiliaryData.insert(_auxiliaryData.end(), changeDataTO.auxiliaryData, changeDataTO.auxiliaryData + *changeDataTO.numAuxiliaryData);
+
+    for (uint64_t i = 0; i < *changeDataTO.numCells; ++i) {
+        auto const& changedCell = changeDataTO.cells[i];
+        auto cell = std::ranges::find_if(_cells, [&](CellTO const& cell) { return cell.id == changedCell.id; });
+        if (cell != _cells.end()) {
+            auto connections = std::to_array(cell->connections);
+            auto numConnections = cell->numConnections;
+            *cell = changedCell;
+            std::ranges::copy(connections, cell->connections);
+            cell->numConnections = numConnections;
+            rebaseAuxiliaryDataIndices(*cell, auxiliaryDataOffset);
+        }
+    }
+    for (uint64_t i = 0; i < *changeDataTO.numParticles; ++i) {
+        auto const& changedParticle = changeDataTO.particles[i];
+        auto particle = std::ranges::find_if(_particles, [&](ParticleTO const& particle) { return particle.id == changedParticle.id; });
+        if (particle != _particles.end()) {
+            *particle = changedParticle;
+        }
+    }
+    resizeArraysIfNecessary();
+}
+
+void _HostSimulationBackend::applyForce(ApplyForceData const& applyData)
+{
+    for (auto& cell : _cells) {
+        if (isInCircle(cell.pos, applyData.endPos, applyData.radius)) {
+            cell.vel = {cell.vel.x + applyData.force.x, cell.vel.y + applyData.force.y};
+        }
+    }
+    for (auto& particle : _particles) {
+        if (isInCircle(particle.pos, applyData.endPos, applyData.radius)) {
+            particle.vel = {particle.vel.x + applyData.force.x, particle.vel.y + applyData.force.y};
+        }
+    }
+}
+
+void _HostSimulationBackend::switchSelection(PointSelectionData const& switchData)
+{
+    setSelectionIf([&](float2 const& pos) { return isInCircle(pos, switchData.pos, switchData.radius); });
+}
+
+void _HostSimulationBackend::swapSelection(PointSelectionData const& selectionData)
+{
+    for (auto& cell : _cells) {
+        if (isInCircle(cell.pos, selectionData.pos, selectionData.radius)) {
+            cell.selected = cell.selected ? 0 : 1;
+        }
+    }
+    for (auto& particle : _particles) {
+        if (isInCircle(particle.pos, selectionData.pos, selectionData.radius)) {
+            particle.selected = particle.selected ? 0 : 1;
+        }
+    }
+}
+
+void _HostSimulationBackend::setSelection(AreaSelectionData const& selectionData)
+{
+    setSelectionIf([&](float2 const& pos) { return isInRect(pos, selectionData.startPos, selectionData.endPos); });
+}
+
+SelectionShallowData _HostSimulationBackend::getSelectionShallowData()
+{
+    SelectionShallowData result;
+    for (auto const& cell : _cells) {
+        if (cell.selected) {
+            ++result.numCells;
+            result.centerPosX += cell.pos.x;
+            result.centerPosY += cell.pos.y;
+            result.centerVelX += cell.vel.x;
+            result.centerVelY += cell.vel.y;
+        }
+    }
+    for (auto const& particle : _particles) {
+        if (particle.selected) {
+            ++result.numParticles;
+            result.centerPosX += particle.pos.x;
+            result.centerPosY += particle.pos.y;
+            result.centerVelX += particle.vel.x;
+            result.centerVelY += particle.vel.y;
+        }
+    }
+    if (auto numEntities = result.numCells + result.numParticles) {
+        result.centerPosX /= toFloat(numEntities);
+        result.centerPosY /= toFloat(numEntities);
+        result.centerVelX /= toFloat(numEntities);
+        result.centerVelY /= toFloat(numEntities);
+    }
+
+    //there is no cluster detection on the host
+    result.numClusterCells = result.numCells;
+    result.clusterCenterPosX = result.centerPosX;
+    result.clusterCenterPosY = result.centerPosY;
+    result.clusterCenterVelX = result.centerVelX;
+    result.clusterCenterVelY = result.centerVelY;
+    return result;
+}
+
+void _HostSimulationBackend::shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData)
+{
+    for (auto& cell : _cells) {
+        if (cell.selected) {
+            cell.pos = {cell.pos.x + shallowUpdateData.posDeltaX, cell.pos.y + shallowUpdateData.posDeltaY};
+            cell.vel = {cell.vel.x + shallowUpdateData.velDeltaX, cell.vel.y + shallowUpdateData.velDeltaY};
+        }
+    }
+    for (auto& particle : _particles) {
+        if (particle.selected) {
+            particle.pos = {particle.pos.x + shallowUpdateData.posDeltaX, particle.pos.y + shallowUpdateData.posDeltaY};
+            particle.vel = {particle.vel.x + shallowUpdateData.velDeltaX, particle.vel.y + shallowUpdateData.velDeltaY};
+        }
+    }
+}
+
+void _HostSimulationBackend::removeSelection()
+{
+    setSelectionIf([](float2 const&) { return false; });
+}
+
+void _HostSimulationBackend::updateSelection() {}
+
+void _HostSimulationBackend::colorSelectedObjects(unsigned char color, bool includeClusters)
+{
+    for (auto& cell : _cells) {
+        if (cell.selected) {
+            cell.color = color;
+        }
+    }
+    for (auto& particle : _particles) {
+        if (particle.selected) {
+            particle.color = color;
+        }
+    }
+}
+
+void _HostSimulationBackend::reconnectSelectedObjects() {}
+
+void _HostSimulationBackend::setDetached(bool value) {}
+
+void _HostSimulationBackend::setGpuConstants(GpuSettings const& cudaConstants)
+{
+    _settings.gpuSettings = cudaConstants;
+}
+
+void _HostSimulationBackend::setSimulationParameters(SimulationParameters const& parameters)
+{
+    _settings.simulationParameters = parameters;
+}
+
+ArraySizes _HostSimulationBackend::getArraySizes() const
+{
+    return _arraySizes;
+}
+
+StatisticsData _HostSimulationBackend::getStatistics()
+{
+    StatisticsData result{};
+    auto& statistics = result.timeline.timestep;
+    for (auto const& cell : _cells) {
+        auto color = std::clamp(cell.color, 0, MAX_COLORS - 1);
+        ++statistics.numCells[color];
+        statistics.numConnections[color] += cell.numConnections;
+        statistics.totalEnergy[color] += cell.energy;
+    }
+    for (auto const& particle : _particles) {
+        auto color = std::clamp(particle.color, 0, MAX_COLORS - 1);
+        ++statistics.numParticles[color];
+        statistics.totalEnergy[color] += particle.energy;
+    }
+    return result;
+}
+
+void _HostSimulationBackend::resetTimeIntervalStatistics() {}
+
+uint64_t _HostSimulationBackend::getCurrentTimestep() const
+{
+    return _timestep;
+}
+
+void _HostSimulationBackend::setCurrentTimestep(uint64_t timestep)
+{
+    _timestep = timestep;
+}
+
+void _HostSimulationBackend::clear()
+{
+    _cells.clear();
+    _particles.clear();
+    _auxiliaryData.clear();
+}
+
+void _HostSimulationBackend::resizeArraysIfNecessary(ArraySizes const& additionals)
+{
+    _arraySizes.cellArraySize = std::max(_arraySizes.cellArraySize, _cells.size() + additionals.cellArraySize);
+    _arraySizes.particleArraySize = std::max(_arraySizes.particleArraySize, _particles.size() + additionals.particleArraySize);
+    _arraySizes.auxiliaryDataSize = std::max(_arraySizes.auxiliaryDataSize, _auxiliaryData.size() + additionals.auxiliaryDataSize);
+}
+
+void _HostSimulationBackend::testOnly_mutate(uint64_t cellId, MutationType mutationType) {}
+
+void _HostSimulationBackend::copyToTO(DataTO const& dataTO, CellFilter const& cellFilter, ParticleFilter const& particleFilter) const
+{
+    std::vector<int> newCellIndices(_cells.size(), -1);
+    uint64_t numCells = 0;
+    for (int i = 0; i < toInt(_cells.size()); ++i) {
+        if (cellFilter(_cells[i])) {
+            newCellIndices[i] = toInt(numCells);
+            dataTO.cells[numCells++] = _cells[i];
+        }
+    }
+    for (uint64_t i = 0; i < numCells; ++i) {
+        auto& cell = dataTO.cells[i];
+        int numConnections = 0;
+        for (int j = 0; j < cell.numConnections; ++j) {
+            auto newIndex = newCellIndices[cell.connections[j].cellIndex];
+            if (newIndex != -1) {
+                cell.connections[numConnections] = cell.connections[j];
+                cell.connections[numConnections].cellIndex = newIndex;
+                ++numConnections;
+            }
+        }
+        cell.numConnections = numConnections;
+    }
+    *dataTO.numCells = numCells;
+
+    uint64_t numParticles = 0;
+    for (auto const& particle : _particles) {
+        if (particleFilter(particle)) {
+            dataTO.particles[numParticles++] = particle;
+        }
+    }
+    *dataTO.numParticles = numParticles;
+
+    //auxiliary data indices remain valid since the whole data is copied
+    if (!_auxiliaryData.empty()) {
+        std::memcpy(dataTO.auxiliaryData, _auxiliaryData.data(), _auxiliaryData.size());
+    }
+    *dataTO.numAuxiliaryData = _auxiliaryData.size();
+}
+
+void _HostSimulationBackend::appendFromTO(DataTO const& dataTO, bool select)
+{
+    auto cellIndexOffset = toInt(_cells.size());
+    auto auxiliaryDataOffset = _auxiliaryData.size();
+    for (uint64_t i = 0; i < *dataTO.numCells; ++i) {
+        auto cell = dataTO.cells[i];
+        for (int j = 0; j < cell.numConnections; ++j) {
+            cell.connections[j].cellIndex += cellIndexOffset;
+        }
+        rebaseAuxiliaryDataIndices(cell, auxiliaryDataOffset);
+        cell.selected = select ? 1 : 0;
+        _cells.emplace_back(cell);
+    }
+    for (uint64_t i = 0; i < *dataTO.numParticles; ++i) {
+        auto particle = dataTO.particles[i];
+        particle.selected = select ? 1 : 0;
+        _particles.emplace_back(particle);
+    }
+    _auxiliaryData.insert(_auxiliaryData.end(), dataTO.auxiliaryData, dataTO.auxiliaryData + *dataTO.numAuxiliaryData);
+    resizeArraysIfNecessary();
+}
+
+void _HostSimulationBackend::setSelectionIf(std::function<bool(float2 const&)> const& predicate)
+{
+    for (auto& cell : _cells) {
+        cell.selected = predicate(cell.pos) ? 1 : 0;
+    }
+    for (auto& particle : _particles) {
+        particle.selected = predicate(particle.pos) ? 1 : 0;
+    }
+}
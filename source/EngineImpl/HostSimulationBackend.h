@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include "Base/Definitions.h"
+#include "EngineInterface/Settings.h"
+#include "EngineGpuKernels/SimulationBackend.cuh"
+#include "EngineGpuKernels/TOs.cuh"
+
+/**
+ * Deterministic simulation backend on the host for exercising and benchmarking EngineWorker without a GPU.
+ * A time step moves all entities by their velocities and then busy-waits for a configurable duration.
+ * Entity data and the selection are maintained, whereas bond physics, rendering and mutations are no-ops.
+ */
+class _HostSimulationBackend : public _SimulationBackend
+{
+public:
+    _HostSimulationBackend(uint64_t timestep, Settings const& settings, std::chrono::microseconds const& timestepDuration = std::chrono::microseconds(0));
+
+    void* registerImageResource(GLuint image) override;
+
+    void calcTimestep() override;
+
+    void drawVectorGraphics(float2 const& rectUpperLeft, float2 const& rectLowerRight, void* cudaResource, int2 const& imageSize, double zoom) override;
+    void getSimulationData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) override;
+    void getSelectedSimulationData(bool includeClusters, DataTO const& dataTO) override;
+    void getInspectedSimulationData(std::vector<uint64_t> entityIds, DataTO const& dataTO) override;
+    void getOverlayData(int2 const& rectUpperLeft, int2 const& rectLowerRight, DataTO const& dataTO) override;
+    void addAndSelectSimulationData(DataTO const& dataTO) override;
+    void setSimulationData(DataTO const& dataTO) override;
+    void removeSelectedObjects(bool includeClusters) override;
+    void relaxSelectedObjects(bool includeClusters) override;
+    void uniformVelocitiesForSelectedObjects(bool includeClusters) override;
+    void makeSticky(bool includeClusters) override;
+    void removeStickiness(bool includeClusters) override;
+    void setBarrier(bool value, bool includeClusters) override;
+    void changeInspectedSimulationData(DataTO const& changeDataTO) override;
+
+    void applyForce(ApplyForceData const& applyData) override;
+    void switchSelection(PointSelectionData const& switchData) override;
+    void swapSelection(PointSelectionData const& selectionData) override;
+    void setSelection(AreaSelectionData const& selectionData) override;
+    SelectionShallowData getSelectionShallowData() override;
+    void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& shallowUpdateData) override;
+    void removeSelection() override;
+    void updateSelection() override;
+    void colorSelectedObjects(unsigned char color, bool includeClusters) override;
+    void reconnectSelectedObjects() override;
+    void setDetached(bool value) override;
+
+    void setGpuConstants(GpuSettings const& cudaConstants) override;
+    void setSimulationParameters(SimulationParameters const& parameters) override;
+
+    ArraySizes getArraySizes() const override;
+
+    StatisticsData getStatistics() override;
+    void resetTimeIntervalStatistics() override;
+    uint64_t getCurrentTimestep() const override;
+    void setCurrentTimestep(uint64_t timestep) override;
+
+    void clear() override;
+
+    void resizeArraysIfNecessary(ArraySizes const& additionals = ArraySizes()) override;
+
+    //for tests
+    void testOnly_mutate(uint64_t cellId, MutationType mutationType) override;
+
+private:
+    using CellFilter = std::function<bool(CellTO const&)>;
+    using ParticleFilter = std::function<bool(ParticleTO const&)>;
+
+    void copyToTO(DataTO const& dataTO, CellFilter const& cellFilter, ParticleFilter const& particleFilter) const;
+    void appendFromTO(DataTO const& dataTO, bool select);
+    void setSelectionIf(std::function<bool(float2 const&)> const& predicate);
+
+    Settings _settings;
+    std::chrono::microseconds _timestepDuration;
+    uint64_t _timestep = 0;
+
+    ArraySizes _arraySizes;
+    std::vector<CellTO> _cells;
+    std::vector<ParticleTO> _particles;
+    std::vector<uint8_t> _auxiliaryData;
+};
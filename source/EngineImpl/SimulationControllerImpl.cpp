@@ -1,10 +1,11 @@
 #include "SimulationControllerImpl.h"
 
 #include "EngineInterface/Descriptions.h"
+#include "EngineGpuKernels/CudaSimulationFacade.cuh"
 
 void _SimulationControllerImpl::initCuda()
 {
-    _worker.initCuda();
+    _CudaSimulationFacade::initCuda();
 }
 
 void _SimulationControllerImpl::newSimulation(uint64_t timestep, GeneralSettings const& generalSettings, SimulationParameters const& parameters)
@@ -12,7 +13,9 @@ void _SimulationControllerImpl::newSimulation(uint64_t timestep, GeneralSettings
     _settings.simulationParameters = parameters;
     _settings.generalSettings = generalSettings;
     _origSettings = _settings;
-    _worker.newSimulation(timestep, generalSettings, parameters);
+    _worker.newSimulation(timestep, generalSettings, parameters, [](uint64_t timestep, Settings const& settings) {
+        return std::make_shared<_CudaSimulationFacade>(timestep, settings);
+    });
 
     _thread = new std::thread(&EngineWorker::runThreadLoop, &_worker);
 
@@ -75,6 +78,12 @@ ClusteredDataDescription _SimulationControllerImpl::getClusteredSimulationData()
     return _worker.getClusteredSimulationData({-10, -10}, {size.x + 10, size.y + 10});
 }
 
+SimulationDataSnapshot _SimulationControllerImpl::getSimulationDataSnapshot()
+{
+    auto size = getWorldSize();
+    return _worker.getSimulationDataSnapshot({-10, -10}, {size.x + 10, size.y + 10});
+}
+
 DataDescription _SimulationControllerImpl::getSimulationData()
 {
     auto size = getWorldSize();
@@ -96,11 +105,62 @@ DataDescription _SimulationControllerImpl::getInspectedSimulationData(std::vecto
     return _worker.getInspectedSimulationData(objectIds);
 }
 
+std::shared_future<DataDescription> _SimulationControllerImpl::getSimulationData_async()
+{
+    auto size = getWorldSize();
+    return _worker.getSimulationData_async({-10, -10}, {size.x + 10, size.y + 10});
+}
+
+std::shared_future<DataDescription> _SimulationControllerImpl::getSelectedSimulationData_async(bool includeClusters)
+{
+    return _worker.getSelectedSimulationData_async(includeClusters);
+}
+
+std::shared_future<DataDescription> _SimulationControllerImpl::getInspectedSimulationData_async(std::vector<uint64_t> objectIds)
+{
+    return _worker.getInspectedSimulationData_async(objectIds);
+}
+
+std::shared_future<SelectionShallowData> _SimulationControllerImpl::getSelectionShallowData_async()
+{
+    return _worker.getSelectionShallowData_async();
+}
+
+std::shared_future<StatisticsData> _SimulationControllerImpl::getStatistics_async()
+{
+    return _worker.getStatistics_async();
+}
+
+PublishedFrame const& _SimulationControllerImpl::getPublishedFrame()
+{
+    return _worker.getPublishedFrame();
+}
+
+std::chrono::milliseconds _SimulationControllerImpl::getPublishingInterval() const
+{
+    return _worker.getPublishingInterval();
+}
+
+void _SimulationControllerImpl::setPublishingInterval(std::chrono::milliseconds const& value)
+{
+    _worker.setPublishingInterval(value);
+}
+
+uint64_t _SimulationControllerImpl::setInspectedEntityIdsForPublishing(std::vector<uint64_t> const& entityIds)
+{
+    return _worker.setInspectedEntityIdsForPublishing(entityIds);
+}
+
 void _SimulationControllerImpl::addAndSelectSimulationData(DataDescription const& dataToAdd)
 {
     _worker.addAndSelectSimulationData(dataToAdd);
 }
 
+void _SimulationControllerImpl::addAndSelectSimulationData_async(DataDescription const& dataToAdd)
+{
+    _worker.addAndSelectSimulationData_async(dataToAdd);
+}
+
 void _SimulationControllerImpl::setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate)
 {
     _worker.setClusteredSimulationData(dataToUpdate);
@@ -119,6 +179,12 @@ void _SimulationControllerImpl::removeSelectedObjects(bool includeClusters)
     _selectionNeedsUpdate = true;
 }
 
+void _SimulationControllerImpl::removeSelectedObjects_async(bool includeClusters)
+{
+    _worker.removeSelectedObjects_async(includeClusters);
+    _selectionNeedsUpdate = true;
+}
+
 void _SimulationControllerImpl::relaxSelectedObjects(bool includeClusters)
 {
     _worker.relaxSelectedObjects(includeClusters);
@@ -268,11 +334,21 @@ void _SimulationControllerImpl::switchSelection(RealVector2D const& pos, float r
     _worker.switchSelection(pos, radius);
 }
 
+void _SimulationControllerImpl::switchSelection_async(RealVector2D const& pos, float radius)
+{
+    _worker.switchSelection_async(pos, radius);
+}
+
 void _SimulationControllerImpl::swapSelection(RealVector2D const& pos, float radius)
 {
     _worker.swapSelection(pos, radius);
 }
 
+void _SimulationControllerImpl::swapSelection_async(RealVector2D const& pos, float radius)
+{
+    _worker.swapSelection_async(pos, radius);
+}
+
 SelectionShallowData _SimulationControllerImpl::getSelectionShallowData()
 {
     return _worker.getSelectionShallowData();
@@ -283,16 +359,31 @@ void _SimulationControllerImpl::shallowUpdateSelectedObjects(ShallowUpdateSelect
     _worker.shallowUpdateSelectedObjects(updateData);
 }
 
+void _SimulationControllerImpl::shallowUpdateSelectedObjects_async(ShallowUpdateSelectionData const& updateData)
+{
+    _worker.shallowUpdateSelectedObjects_async(updateData);
+}
+
 void _SimulationControllerImpl::setSelection(RealVector2D const& startPos, RealVector2D const& endPos)
 {
     _worker.setSelection(startPos, endPos);
 }
 
+void _SimulationControllerImpl::setSelection_async(RealVector2D const& startPos, RealVector2D const& endPos)
+{
+    _worker.setSelection_async(startPos, endPos);
+}
+
 void _SimulationControllerImpl::removeSelection()
 {
     _worker.removeSelection();
 }
 
+void _SimulationControllerImpl::removeSelection_async()
+{
+    _worker.removeSelection_async();
+}
+
 bool _SimulationControllerImpl::updateSelectionIfNecessary()
 {
     auto result = _selectionNeedsUpdate;
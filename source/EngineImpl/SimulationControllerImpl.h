@@ -45,15 +45,29 @@ public:
     void setSyncSimulationWithRenderingRatio(int value) override;
 
     ClusteredDataDescription getClusteredSimulationData() override;
+    SimulationDataSnapshot getSimulationDataSnapshot() override;
     DataDescription getSimulationData() override;
     ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters) override;
     DataDescription getSelectedSimulationData(bool includeClusters) override;
     DataDescription getInspectedSimulationData(std::vector<uint64_t> objectIds) override;
 
+    std::shared_future<DataDescription> getSimulationData_async() override;
+    std::shared_future<DataDescription> getSelectedSimulationData_async(bool includeClusters) override;
+    std::shared_future<DataDescription> getInspectedSimulationData_async(std::vector<uint64_t> objectIds) override;
+    std::shared_future<SelectionShallowData> getSelectionShallowData_async() override;
+    std::shared_future<StatisticsData> getStatistics_async() override;
+
+    PublishedFrame const& getPublishedFrame() override;
+    std::chrono::milliseconds getPublishingInterval() const override;
+    void setPublishingInterval(std::chrono::milliseconds const& value) override;
+    uint64_t setInspectedEntityIdsForPublishing(std::vector<uint64_t> const& entityIds) override;
+
     void addAndSelectSimulationData(DataDescription const& dataToAdd) override;
+    void addAndSelectSimulationData_async(DataDescription const& dataToAdd) override;
     void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) override;
     void setSimulationData(DataDescription const& dataToUpdate) override;
     void removeSelectedObjects(bool includeClusters) override;
+    void removeSelectedObjects_async(bool includeClusters) override;
     void relaxSelectedObjects(bool includeClusters) override;
     void uniformVelocitiesForSelectedObjects(bool includeClusters) override;
     void makeSticky(bool includeClusters) override;
@@ -90,11 +104,16 @@ public:
     applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius) override;
 
     void switchSelection(RealVector2D const& pos, float radius) override;
+    void switchSelection_async(RealVector2D const& pos, float radius) override;
     void swapSelection(RealVector2D const& pos, float radius) override;
+    void swapSelection_async(RealVector2D const& pos, float radius) override;
     SelectionShallowData getSelectionShallowData() override;
     void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData) override;
+    void shallowUpdateSelectedObjects_async(ShallowUpdateSelectionData const& updateData) override;
     void setSelection(RealVector2D const& startPos, RealVector2D const& endPos) override;
+    void setSelection_async(RealVector2D const& startPos, RealVector2D const& endPos) override;
     void removeSelection() override;
+    void removeSelection_async() override;
     bool updateSelectionIfNecessary() override;
 
     GeneralSettings getGeneralSettings() const override;
@@ -0,0 +1,51 @@
+#include "SimulationDataSnapshotImpl.h"
+
+#include "EngineInterface/Descriptions.h"
+
+#include "DescriptionConverter.h"
+
+_SimulationDataSnapshotImpl::_SimulationDataSnapshotImpl(DataTO const& dataTO, SimulationParameters const& parameters)
+    : _parameters(parameters)
+    , _cells(dataTO.cells, dataTO.cells + *dataTO.numCells)
+    , _particles(dataTO.particles, dataTO.particles + *dataTO.numParticles)
+    , _auxiliaryData(dataTO.auxiliaryData, dataTO.auxiliaryData + *dataTO.numAuxiliaryData)
+{}
+
+uint64_t _SimulationDataSnapshotImpl::getNumCells() const
+{
+    return _cells.size();
+}
+
+uint64_t _SimulationDataSnapshotImpl::getNumParticles() const
+{
+    return _particles.size();
+}
+
+template <typename Func>
+auto _SimulationDataSnapshotImpl::convert(Func const& func) const
+{
+    //the converter only reads from the TO
+    uint64_t numCells = _cells.size();
+    uint64_t numParticles = _particles.size();
+    uint64_t numAuxiliaryData = _auxiliaryData.size();
+    DataTO dataTO;
+    dataTO.numCells = &numCells;
+    dataTO.cells = const_cast<CellTO*>(_cells.data());
+    dataTO.numParticles = &numParticles;
+    dataTO.particles = const_cast<ParticleTO*>(_particles.data());
+    dataTO.numAuxiliaryData = &numAuxiliaryData;
+    dataTO.auxiliaryData = const_cast<uint8_t*>(_auxiliaryData.data());
+
+    DescriptionConverter converter(_parameters);
+    return func(converter, dataTO);
+}
+
+ClusteredDataDescription _SimulationDataSnapshotImpl::convertToClusteredDataDescription() const
+{
+    return convert([](DescriptionConverter& converter, DataTO const& dataTO) { return converter.convertTOtoClusteredDataDescription(dataTO); });
+}
+
+DataDescription _SimulationDataSnapshotImpl::convertToDataDescription() const
+{
+    return convert([](DescriptionConverter& converter, DataTO const& dataTO) { return converter.convertTOtoDataDescription(dataTO); });
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "EngineInterface/SimulationDataSnapshot.h"
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineGpuKernels/TOs.cuh"
+
+class _SimulationDataSnapshotImpl : public _SimulationDataSnapshot
+{
+public:
+    _SimulationDataSnapshotImpl(DataTO const& dataTO, SimulationParameters const& parameters);  //copies the filled parts of dataTO
+
+    uint64_t getNumCells() const override;
+    uint64_t getNumParticles() const override;
+
+    ClusteredDataDescription convertToClusteredDataDescription() const override;
+    DataDescription convertToDataDescription() const override;
+
+private:
+    template <typename Func>
+    auto convert(Func const& func) const;
+
+    SimulationParameters _parameters;
+
+    std::vector<CellTO> _cells;
+    std::vector<ParticleTO> _particles;
+    std::vector<uint8_t> _auxiliaryData;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Wait-free handoff of values from one writer thread to one reader thread. The writer fills the back buffer and
+ * publishes it, the reader picks up the most recently published buffer. Neither side blocks and the reader never
+ * observes a partially written value. Buffers are reused, so their content should be overwritten completely.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    //methods for the writer thread
+    T& getBackBuffer() { return _buffers[_backIndex]; }
+    void publish()
+    {
+        auto middle = _middle.exchange(_backIndex | NewDataFlag, std::memory_order_acq_rel);
+        _backIndex = middle & IndexMask;
+    }
+
+    //method for the reader thread, the reference stays valid until the next call
+    T const& getFrontBuffer()
+    {
+        if (_middle.load(std::memory_order_relaxed) & NewDataFlag) {
+            auto middle = _middle.exchange(_frontIndex, std::memory_order_acq_rel);
+            _frontIndex = middle & IndexMask;
+        }
+        return _buffers[_frontIndex];
+    }
+
+private:
+    static uint8_t constexpr IndexMask = 3;
+    static uint8_t constexpr NewDataFlag = 4;
+
+    std::array<T, 3> _buffers;
+    uint8_t _backIndex = 0;
+    std::atomic<uint8_t> _middle{1};  //index of the buffer in between, NewDataFlag is set if it has been published since the last read
+    uint8_t _frontIndex = 2;
+};
@@ -0,0 +1,135 @@
+#include "AsyncSimulationWriter.h"
+
+#include <filesystem>
+
+#include "Base/LoggingService.h"
+
+namespace
+{
+    //e.g. autosave.sim => autosave.tmp.sim, which is saved along with autosave.tmp.settings.json
+    std::filesystem::path getTemporaryFilename(std::filesystem::path const& filename)
+    {
+        auto result = filename;
+        result.replace_filename(filename.stem().string() + ".tmp" + filename.extension().string());
+        return result;
+    }
+
+    std::filesystem::path getSettingsFilename(std::filesystem::path filename)
+    {
+        return filename.replace_extension(std::filesystem::path(".settings.json"));
+    }
+}
+
+AsyncSimulationWriter::AsyncSimulationWriter(int maxInFlightSaves)
+    : _maxInFlightSaves(std::max(1, maxInFlightSaves))
+{
+    _thread = std::thread(&AsyncSimulationWriter::runWorker, this);
+}
+
+AsyncSimulationWriter::~AsyncSimulationWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+int AsyncSimulationWriter::getMaxInFlightSaves() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxInFlightSaves;
+}
+
+void AsyncSimulationWriter::setMaxInFlightSaves(int value)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _maxInFlightSaves = std::max(1, value);
+}
+
+bool AsyncSimulationWriter::canSubmit() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _progress.numInFlightSaves < _maxInFlightSaves;
+}
+
+bool AsyncSimulationWriter::trySubmit(std::string const& filename, SimulationProvider const& provider)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_progress.numInFlightSaves >= _maxInFlightSaves) {
+            return false;
+        }
+        ++_progress.numInFlightSaves;
+        _jobs.emplace_back(Job{filename, provider});
+    }
+    _condition.notify_all();
+    return true;
+}
+
+AsyncSaveProgress AsyncSimulationWriter::getProgress() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _progress;
+}
+
+void AsyncSimulationWriter::waitUntilIdle()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return _progress.numInFlightSaves == 0; });
+}
+
+void AsyncSimulationWriter::runWorker()
+{
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this] { return _shutdown || !_jobs.empty(); });
+            if (_jobs.empty()) {
+                return;
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+            _progress.stage = SaveStage_Converting;
+            _progress.filename = job.filename;
+        }
+
+        auto success = save(job);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_progress.numInFlightSaves;
+            _progress.stage = SaveStage_Idle;
+            _progress.filename.clear();
+            ++(success ? _progress.numSucceededSaves : _progress.numFailedSaves);
+        }
+        _condition.notify_all();
+    }
+}
+
+bool AsyncSimulationWriter::save(Job const& job)
+{
+    std::filesystem::path filename(job.filename);
+    auto temporaryFilename = getTemporaryFilename(filename);
+    try {
+        auto simulation = job.provider();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _progress.stage = SaveStage_Writing;
+        }
+        if (Serializer::serializeSimulationToFiles(temporaryFilename.string(), simulation)) {
+            //the simulation file is renamed last, so that it is never newer than its settings
+            std::filesystem::rename(getSettingsFilename(temporaryFilename), getSettingsFilename(filename));
+            std::filesystem::rename(temporaryFilename, filename);
+            return true;
+        }
+    } catch (std::exception const& exception) {
+        log(Priority::Important, "saving " + job.filename + " failed: " + exception.what());
+    }
+    std::error_code errorCode;
+    std::filesystem::remove(temporaryFilename, errorCode);
+    std::filesystem::remove(getSettingsFilename(temporaryFilename), errorCode);
+    return false;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Base/Definitions.h"
+#include "Serializer.h"
+
+using SaveStage = int;
+enum SaveStage_
+{
+    SaveStage_Idle,
+    SaveStage_Converting,
+    SaveStage_Writing
+};
+
+struct AsyncSaveProgress
+{
+    int numInFlightSaves = 0;  //queued or running
+    SaveStage stage = SaveStage_Idle;  //of the running save
+    std::string filename;  //of the running save
+    uint64_t numSucceededSaves = 0;
+    uint64_t numFailedSaves = 0;
+};
+
+/**
+ * Saves simulations on a background thread. The simulation is provided by a function which is invoked on that thread,
+ * so the conversion of a previously taken snapshot, the compression and the disk I/O do not block the caller.
+ * The files are written under temporary names and each one is renamed afterwards, hence no file is left partially written.
+ * An interruption between the renames may leave the settings of the new save next to the previous simulation file.
+ * At most maxInFlightSaves saves can be queued or running at a time. The destructor completes all submitted saves.
+ */
+class AsyncSimulationWriter
+{
+public:
+    using SimulationProvider = std::function<DeserializedSimulation()>;
+
+    explicit AsyncSimulationWriter(int maxInFlightSaves = 1);
+    ~AsyncSimulationWriter();
+
+    AsyncSimulationWriter(AsyncSimulationWriter const&) = delete;
+    void operator=(AsyncSimulationWriter const&) = delete;
+
+    int getMaxInFlightSaves() const;
+    void setMaxInFlightSaves(int value);
+    bool canSubmit() const;
+
+    //returns false if the maximum number of in-flight saves is reached
+    bool trySubmit(std::string const& filename, SimulationProvider const& provider);
+
+    AsyncSaveProgress getProgress() const;
+    void waitUntilIdle();
+
+private:
+    struct Job
+    {
+        std::string filename;
+        SimulationProvider provider;
+    };
+
+    void runWorker();
+    bool save(Job const& job);
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<Job> _jobs;
+    int _maxInFlightSaves = 1;
+    bool _shutdown = false;
+    AsyncSaveProgress _progress;
+
+    std::thread _thread;
+};
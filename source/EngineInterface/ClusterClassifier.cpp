@@ -0,0 +1,295 @@
+#include "ClusterClassifier.h"
+
+#include <algorithm>
+#include <span>
+#include <unordered_map>
+
+#include "Base/ThreadPool.h"
+
+namespace
+{
+    auto constexpr ClassificationBlockSize = 16;
+    auto constexpr MaxVerificationSteps = 1000000;
+
+    uint64_t mix(uint64_t value)
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    uint64_t combine(uint64_t hash, uint64_t value)
+    {
+        return mix(hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2)));
+    }
+
+    uint64_t calcCellLabel(CellDescription const& cell)
+    {
+        uint64_t result = 0;
+        result = combine(result, cell.maxConnections);
+        result = combine(result, cell.connections.size());
+        result = combine(result, cell.livingState);
+        result = combine(result, cell.inputExecutionOrderNumber.value_or(-1));
+        result = combine(result, cell.outputBlocked);
+        result = combine(result, cell.executionOrderNumber);
+        result = combine(result, cell.color);
+        result = combine(result, cell.getCellFunctionType());
+        return result;
+    }
+
+    //bond graph in compressed row format with stable Weisfeiler-Lehman colors
+    struct ClusterGraph
+    {
+        std::vector<int> adjacencyOffsets;
+        std::vector<int> adjacentCells;
+        std::vector<uint64_t> colors;
+        uint64_t hash = 0;
+
+        int getNumCells() const { return toInt(colors.size()); }
+        int getNumBonds() const { return toInt(adjacentCells.size()); }
+        std::span<int const> getAdjacentCells(int index) const
+        {
+            return std::span<int const>(adjacentCells).subspan(adjacencyOffsets[index], adjacencyOffsets[index + 1] - adjacencyOffsets[index]);
+        }
+        bool isAdjacent(int index1, int index2) const { return std::ranges::find(getAdjacentCells(index1), index2) != getAdjacentCells(index1).end(); }
+    };
+
+    int getNumDistinctColors(std::vector<uint64_t> colors)
+    {
+        std::ranges::sort(colors);
+        return toInt(std::ranges::unique(colors).begin() - colors.begin());
+    }
+
+    ClusterGraph createGraph(ClusterDescription const& cluster)
+    {
+        ClusterGraph result;
+        auto numCells = toInt(cluster.cells.size());
+
+        std::unordered_map<uint64_t, int> indexById;
+        indexById.reserve(numCells);
+        for (int i = 0; i < numCells; ++i) {
+            indexById.emplace(cluster.cells[i].id, i);
+        }
+        result.adjacencyOffsets.reserve(numCells + 1);
+        result.adjacencyOffsets.emplace_back(0);
+        result.colors.reserve(numCells);
+        for (auto const& cell : cluster.cells) {
+            for (auto const& connection : cell.connections) {
+                auto findResult = indexById.find(connection.cellId);
+                if (findResult != indexById.end()) {
+                    result.adjacentCells.emplace_back(findResult->second);
+                }
+            }
+            result.adjacencyOffsets.emplace_back(toInt(result.adjacentCells.size()));
+            result.colors.emplace_back(calcCellLabel(cell));
+        }
+
+        //refine colors by the multisets of neighbor colors until the partition is stable
+        auto numDistinctColors = getNumDistinctColors(result.colors);
+        std::vector<uint64_t> refinedColors(numCells);
+        for (int round = 0; round < numCells; ++round) {
+            for (int i = 0; i < numCells; ++i) {
+                uint64_t neighborHash = 0;
+                for (auto adjacentCell : result.getAdjacentCells(i)) {
+                    neighborHash += mix(result.colors[adjacentCell]);
+                }
+                refinedColors[i] = combine(result.colors[i], neighborHash);
+            }
+            auto numRefinedColors = getNumDistinctColors(refinedColors);
+            if (numRefinedColors == numDistinctColors) {
+                break;
+            }
+            result.colors.swap(refinedColors);
+            numDistinctColors = numRefinedColors;
+        }
+
+        auto sortedColors = result.colors;
+        std::ranges::sort(sortedColors);
+        result.hash = combine(numCells, result.getNumBonds());
+        for (auto color : sortedColors) {
+            result.hash = combine(result.hash, color);
+        }
+        return result;
+    }
+
+    //cells in breadth-first order where each cell is preceded by a neighbor if present; roots are taken from rare colors
+    std::vector<std::pair<int, int>> getSearchOrder(ClusterGraph const& graph)
+    {
+        auto numCells = graph.getNumCells();
+        std::unordered_map<uint64_t, int> colorFrequencies;
+        for (auto color : graph.colors) {
+            ++colorFrequencies[color];
+        }
+        std::vector<int> rootCandidates(numCells);
+        for (int i = 0; i < numCells; ++i) {
+            rootCandidates[i] = i;
+        }
+        std::ranges::stable_sort(rootCandidates, [&](int index1, int index2) {
+            return colorFrequencies.at(graph.colors[index1]) < colorFrequencies.at(graph.colors[index2]);
+        });
+
+        std::vector<std::pair<int, int>> result;  //cell index and index of a preceding neighbor or -1
+        result.reserve(numCells);
+        std::vector<bool> visited(numCells, false);
+        for (auto root : rootCandidates) {
+            if (visited[root]) {
+                continue;
+            }
+            visited[root] = true;
+            result.emplace_back(root, -1);
+            for (auto pos = result.size() - 1; pos < result.size(); ++pos) {
+                auto cell = result[pos].first;
+                for (auto adjacentCell : graph.getAdjacentCells(cell)) {
+                    if (!visited[adjacentCell]) {
+                        visited[adjacentCell] = true;
+                        result.emplace_back(adjacentCell, cell);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    //backtracking search for a color and bond preserving bijection; nullopt if the step budget is exhausted
+    std::optional<bool> findIsomorphism(ClusterGraph const& graph1, ClusterGraph const& graph2)
+    {
+        if (graph1.hash != graph2.hash || graph1.getNumCells() != graph2.getNumCells() || graph1.getNumBonds() != graph2.getNumBonds()) {
+            return false;
+        }
+        auto numCells = graph1.getNumCells();
+        auto order = getSearchOrder(graph1);
+
+        std::vector<int> map1To2(numCells, -1);
+        std::vector<int> map2To1(numCells, -1);
+        std::vector<int> candidatePositions(numCells + 1, 0);
+
+        auto isConsistent = [&](int cell1, int cell2) {
+            if (map2To1[cell2] != -1 || graph1.colors[cell1] != graph2.colors[cell2]) {
+                return false;
+            }
+            auto numMappedNeighbors1 = 0;
+            for (auto adjacentCell1 : graph1.getAdjacentCells(cell1)) {
+                if (map1To2[adjacentCell1] != -1) {
+                    if (!graph2.isAdjacent(cell2, map1To2[adjacentCell1])) {
+                        return false;
+                    }
+                    ++numMappedNeighbors1;
+                }
+            }
+            auto numMappedNeighbors2 = 0;
+            for (auto adjacentCell2 : graph2.getAdjacentCells(cell2)) {
+                if (map2To1[adjacentCell2] != -1) {
+                    ++numMappedNeighbors2;
+                }
+            }
+            return numMappedNeighbors1 == numMappedNeighbors2;
+        };
+
+        int numSteps = 0;
+        int pos = 0;
+        while (pos >= 0 && pos < numCells) {
+            if (++numSteps > MaxVerificationSteps) {
+                return std::nullopt;
+            }
+            auto [cell1, precedingCell1] = order[pos];
+            if (map1To2[cell1] != -1) {
+                map2To1[map1To2[cell1]] = -1;
+                map1To2[cell1] = -1;
+            }
+
+            //candidates are the neighbors of the image of the preceding cell or all cells for roots
+            auto numCandidates = precedingCell1 != -1 ? toInt(graph2.getAdjacentCells(map1To2[precedingCell1]).size()) : numCells;
+            auto getCandidate = [&](int index) { return precedingCell1 != -1 ? graph2.getAdjacentCells(map1To2[precedingCell1])[index] : index; };
+            auto& candidatePos = candidatePositions[pos];
+            while (candidatePos < numCandidates && !isConsistent(cell1, getCandidate(candidatePos))) {
+                ++candidatePos;
+            }
+            if (candidatePos < numCandidates) {
+                auto cell2 = getCandidate(candidatePos);
+                map1To2[cell1] = cell2;
+                map2To1[cell2] = cell1;
+                ++candidatePos;
+                ++pos;
+                candidatePositions[pos] = 0;
+            } else {
+                candidatePos = 0;
+                --pos;
+            }
+        }
+        return pos == numCells;
+    }
+
+    bool areIdentical(ClusterGraph const& graph1, ClusterGraph const& graph2)
+    {
+        //an exhausted search splits the clusters into different classes rather than merging possibly different ones
+        return findIsomorphism(graph1, graph2).value_or(false);
+    }
+}
+
+std::vector<std::vector<int>> ClusterClassifier::classify(std::vector<ClusterDescription> const& clusters)
+{
+    auto& threadPool = ThreadPool::getInstance();
+    auto numClusters = toInt(clusters.size());
+
+    std::vector<ClusterGraph> graphs(numClusters);
+    threadPool.parallelFor(
+        numClusters,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                graphs[i] = createGraph(clusters[i]);
+            }
+        },
+        ClassificationBlockSize);
+
+    std::vector<std::vector<int>> clusterIndicesByHash;
+    std::unordered_map<uint64_t, int> bucketIndexByHash;
+    for (int i = 0; i < numClusters; ++i) {
+        auto [iter, inserted] = bucketIndexByHash.try_emplace(graphs[i].hash, toInt(clusterIndicesByHash.size()));
+        if (inserted) {
+            clusterIndicesByHash.emplace_back();
+        }
+        clusterIndicesByHash[iter->second].emplace_back(i);
+    }
+
+    //exact verification within each bucket of equal hashes
+    std::vector<std::vector<std::vector<int>>> classesByBucket(clusterIndicesByHash.size());
+    threadPool.parallelFor(
+        toInt(clusterIndicesByHash.size()),
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                auto& classes = classesByBucket[i];
+                for (auto clusterIndex : clusterIndicesByHash[i]) {
+                    auto findResult = std::ranges::find_if(
+                        classes, [&](auto const& clusterClass) { return areIdentical(graphs[clusterClass.front()], graphs[clusterIndex]); });
+                    if (findResult != classes.end()) {
+                        findResult->emplace_back(clusterIndex);
+                    } else {
+                        classes.emplace_back(std::vector<int>{clusterIndex});
+                    }
+                }
+            }
+        },
+        1);
+
+    std::vector<std::vector<int>> result;
+    for (auto& classes : classesByBucket) {
+        for (auto& clusterClass : classes) {
+            result.emplace_back(std::move(clusterClass));
+        }
+    }
+    std::ranges::sort(result, [](auto const& class1, auto const& class2) { return class1.front() < class2.front(); });
+    return result;
+}
+
+uint64_t ClusterClassifier::calcStructuralHash(ClusterDescription const& cluster)
+{
+    return createGraph(cluster).hash;
+}
+
+bool ClusterClassifier::isIdentical(ClusterDescription const& cluster1, ClusterDescription const& cluster2)
+{
+    return areIdentical(createGraph(cluster1), createGraph(cluster2));
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Descriptions.h"
+
+/**
+ * Partitions clusters into classes of structurally identical clusters. Two clusters are identical if there is a
+ * bijection between their cells which preserves the bonds and the cell attributes (max connections, number of
+ * connections, living state, execution order numbers, output blocking, color and cell function). Positions, energies
+ * and bond geometry are ignored.
+ * Clusters are grouped by a Weisfeiler-Lehman hash computed in parallel, and clusters with equal hashes are verified by an
+ * exact isomorphism search. Clusters for which the search exceeds its step budget are treated as different.
+ */
+class ClusterClassifier
+{
+public:
+    //returns indices of clusters per class: classes and their elements are ordered by first occurrence
+    static std::vector<std::vector<int>> classify(std::vector<ClusterDescription> const& clusters);
+
+    static uint64_t calcStructuralHash(ClusterDescription const& cluster);
+    static bool isIdentical(ClusterDescription const& cluster1, ClusterDescription const& cluster2);
+};
@@ -0,0 +1,362 @@
+#include "ColumnarSnapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "Descriptions.h"
+
+namespace
+{
+    //layout:
+    //  magic | format version u32 | byte order mark u32 | number of columns u32 | reserved u32 | column table | aligned columns
+    //column table entry: column u32 | element size u32 | offset u64 | number of elements u64
+    //columns are stored in native byte order, the byte order mark is used to reject files from foreign platforms
+    char const SnapshotMagic[8] = {'A', 'L', 'I', 'E', 'N', 'C', 'O', 'L'};
+    uint32_t constexpr SnapshotFormatVersion = 1;
+    uint32_t constexpr SnapshotByteOrderMark = 0x01020304;
+    auto constexpr SnapshotHeaderSize = sizeof(SnapshotMagic) + sizeof(uint32_t) * 4;
+    auto constexpr SnapshotColumnTableEntrySize = sizeof(uint32_t) * 2 + sizeof(uint64_t) * 2;
+    auto constexpr SnapshotColumnAlignment = 64;
+
+    static_assert(sizeof(RealVector2D) == sizeof(float) * 2);
+
+    struct ColumnTableEntry
+    {
+        uint32_t column = 0;
+        uint32_t elementSize = 0;
+        uint64_t offset = 0;
+        uint64_t numElements = 0;
+    };
+
+    template <typename T>
+    void writeRaw(std::ostream& stream, T const& value)
+    {
+        stream.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    T readRaw(uint8_t const* data)
+    {
+        T result;
+        std::memcpy(&result, data, sizeof(T));
+        return result;
+    }
+
+    class ColumnWriter
+    {
+    public:
+        ColumnWriter(std::ostream& stream)
+            : _stream(stream)
+        {
+            writeRaw(_stream, SnapshotMagic);
+            writeRaw(_stream, SnapshotFormatVersion);
+            writeRaw(_stream, SnapshotByteOrderMark);
+            writeRaw(_stream, static_cast<uint32_t>(SnapshotColumn_Count));
+            writeRaw(_stream, uint32_t(0));
+            std::string emptyTable(SnapshotColumnTableEntrySize * SnapshotColumn_Count, '\0');
+            _stream.write(emptyTable.data(), emptyTable.size());
+        }
+
+        template <typename T>
+        void writeColumn(SnapshotColumn column, std::vector<T> const& values)
+        {
+            auto pos = static_cast<uint64_t>(_stream.tellp());
+            auto padding = (SnapshotColumnAlignment - pos % SnapshotColumnAlignment) % SnapshotColumnAlignment;
+            std::string zeros(padding, '\0');
+            _stream.write(zeros.data(), zeros.size());
+
+            _table.emplace_back(ColumnTableEntry{static_cast<uint32_t>(column), sizeof(T), pos + padding, values.size()});
+            _stream.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+        }
+
+        void writeTable()
+        {
+            _stream.seekp(SnapshotHeaderSize);
+            for (auto const& entry : _table) {
+                writeRaw(_stream, entry.column);
+                writeRaw(_stream, entry.elementSize);
+                writeRaw(_stream, entry.offset);
+                writeRaw(_stream, entry.numElements);
+            }
+        }
+
+    private:
+        std::ostream& _stream;
+        std::vector<ColumnTableEntry> _table;
+    };
+
+    template <typename T, typename Container, typename Func>
+    std::vector<T> collect(Container const& container, Func const& func)
+    {
+        std::vector<T> result;
+        result.reserve(container.size());
+        for (auto const& element : container) {
+            result.emplace_back(func(element));
+        }
+        return result;
+    }
+
+    std::vector<uint8_t> const* findGenome(CellDescription const& cell)
+    {
+        if (!cell.cellFunction) {
+            return nullptr;
+        }
+        if (auto constructor = std::get_if<ConstructorDescription>(&*cell.cellFunction)) {
+            return &constructor->genome.getData();
+        }
+        if (auto injector = std::get_if<InjectorDescription>(&*cell.cellFunction)) {
+            return &injector->genome.getData();
+        }
+        return nullptr;
+    }
+}
+
+bool ColumnarSnapshot::serializeToFile(std::string const& filename, ClusteredDataDescription const& data)
+{
+    try {
+        std::ofstream stream(filename, std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+
+        std::vector<CellDescription const*> cells;
+        std::vector<uint64_t> clusterCellOffsets{0};
+        clusterCellOffsets.reserve(data.clusters.size() + 1);
+        for (auto const& cluster : data.clusters) {
+            for (auto const& cell : cluster.cells) {
+                cells.emplace_back(&cell);
+            }
+            clusterCellOffsets.emplace_back(cells.size());
+        }
+
+        ColumnWriter writer(stream);
+        writer.writeColumn(SnapshotColumn_ClusterCellOffsets, clusterCellOffsets);
+        writer.writeColumn(SnapshotColumn_CellIds, collect<uint64_t>(cells, [](auto const& cell) { return cell->id; }));
+        writer.writeColumn(SnapshotColumn_CellPositions, collect<RealVector2D>(cells, [](auto const& cell) { return cell->pos; }));
+        writer.writeColumn(SnapshotColumn_CellVelocities, collect<RealVector2D>(cells, [](auto const& cell) { return cell->vel; }));
+        writer.writeColumn(SnapshotColumn_CellEnergies, collect<float>(cells, [](auto const& cell) { return cell->energy; }));
+        writer.writeColumn(SnapshotColumn_CellColors, collect<int32_t>(cells, [](auto const& cell) { return cell->color; }));
+        writer.writeColumn(SnapshotColumn_CellCreatureIds, collect<int32_t>(cells, [](auto const& cell) { return cell->creatureId; }));
+        writer.writeColumn(SnapshotColumn_CellMutationIds, collect<int32_t>(cells, [](auto const& cell) { return cell->mutationId; }));
+        writer.writeColumn(
+            SnapshotColumn_CellFunctionTypes, collect<uint8_t>(cells, [](auto const& cell) { return static_cast<uint8_t>(cell->getCellFunctionType()); }));
+
+        {
+            std::vector<uint64_t> connectionOffsets{0};
+            std::vector<uint64_t> connectionCellIds;
+            std::vector<float> connectionDistances;
+            connectionOffsets.reserve(cells.size() + 1);
+            for (auto const& cell : cells) {
+                for (auto const& connection : cell->connections) {
+                    connectionCellIds.emplace_back(connection.cellId);
+                    connectionDistances.emplace_back(connection.distance);
+                }
+                connectionOffsets.emplace_back(connectionCellIds.size());
+            }
+            writer.writeColumn(SnapshotColumn_CellConnectionOffsets, connectionOffsets);
+            writer.writeColumn(SnapshotColumn_ConnectionCellIds, connectionCellIds);
+            writer.writeColumn(SnapshotColumn_ConnectionDistances, connectionDistances);
+        }
+        {
+            std::vector<uint64_t> genomeOffsets{0};
+            std::vector<uint8_t> genomeBytes;
+            genomeOffsets.reserve(cells.size() + 1);
+            for (auto const& cell : cells) {
+                if (auto genome = findGenome(*cell)) {
+                    genomeBytes.insert(genomeBytes.end(), genome->begin(), genome->end());
+                }
+                genomeOffsets.emplace_back(genomeBytes.size());
+            }
+            writer.writeColumn(SnapshotColumn_CellGenomeOffsets, genomeOffsets);
+            writer.writeColumn(SnapshotColumn_GenomeBytes, genomeBytes);
+        }
+
+        auto const& particles = data.particles;
+        writer.writeColumn(SnapshotColumn_ParticleIds, collect<uint64_t>(particles, [](auto const& particle) { return particle.id; }));
+        writer.writeColumn(SnapshotColumn_ParticlePositions, collect<RealVector2D>(particles, [](auto const& particle) { return particle.pos; }));
+        writer.writeColumn(SnapshotColumn_ParticleVelocities, collect<RealVector2D>(particles, [](auto const& particle) { return particle.vel; }));
+        writer.writeColumn(SnapshotColumn_ParticleEnergies, collect<float>(particles, [](auto const& particle) { return particle.energy; }));
+        writer.writeColumn(SnapshotColumn_ParticleColors, collect<int32_t>(particles, [](auto const& particle) { return particle.color; }));
+
+        writer.writeTable();
+        stream.close();
+        return !stream.fail();
+    } catch (...) {
+        return false;
+    }
+}
+
+ColumnarSnapshot::ColumnarSnapshot(std::string const& filename)
+    : _file(std::make_unique<MappedFile>(filename))
+{
+    auto data = _file->getData();
+    auto size = _file->getSize();
+    if (size < SnapshotHeaderSize || std::memcmp(data, SnapshotMagic, sizeof(SnapshotMagic)) != 0) {
+        throw std::runtime_error("No columnar snapshot detected.");
+    }
+    auto pos = sizeof(SnapshotMagic);
+    if (readRaw<uint32_t>(data + pos) > SnapshotFormatVersion) {
+        throw std::runtime_error("Format version not supported.");
+    }
+    pos += sizeof(uint32_t);
+    if (readRaw<uint32_t>(data + pos) != SnapshotByteOrderMark) {
+        throw std::runtime_error("Byte order not supported.");
+    }
+    pos += sizeof(uint32_t);
+    auto numColumns = readRaw<uint32_t>(data + pos);
+    pos = SnapshotHeaderSize;
+    if (size < SnapshotHeaderSize + uint64_t(numColumns) * SnapshotColumnTableEntrySize) {
+        throw std::runtime_error("Unexpected end of file.");
+    }
+
+    //columns unknown to this version are ignored, missing columns are empty
+    for (uint32_t i = 0; i < numColumns; ++i) {
+        auto column = readRaw<uint32_t>(data + pos);
+        ColumnInfo info;
+        info.elementSize = readRaw<uint32_t>(data + pos + 4);
+        info.offset = readRaw<uint64_t>(data + pos + 8);
+        info.numElements = readRaw<uint64_t>(data + pos + 16);
+        pos += SnapshotColumnTableEntrySize;
+
+        if (column >= SnapshotColumn_Count) {
+            continue;
+        }
+        if (info.offset % SnapshotColumnAlignment != 0 || info.offset > size
+            || (info.elementSize > 0 && info.numElements > (size - info.offset) / info.elementSize)) {
+            throw std::runtime_error("Invalid column.");
+        }
+        _columns[column] = info;
+    }
+}
+
+uint64_t ColumnarSnapshot::getNumClusters() const
+{
+    auto offsets = getClusterCellOffsets();
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+uint64_t ColumnarSnapshot::getNumCells() const
+{
+    return getCellIds().size();
+}
+
+uint64_t ColumnarSnapshot::getNumParticles() const
+{
+    return getParticleIds().size();
+}
+
+std::span<uint64_t const> ColumnarSnapshot::getClusterCellOffsets() const
+{
+    return getColumn<uint64_t>(SnapshotColumn_ClusterCellOffsets);
+}
+
+std::span<uint64_t const> ColumnarSnapshot::getCellIds() const
+{
+    return getColumn<uint64_t>(SnapshotColumn_CellIds);
+}
+
+std::span<RealVector2D const> ColumnarSnapshot::getCellPositions() const
+{
+    return getColumn<RealVector2D>(SnapshotColumn_CellPositions);
+}
+
+std::span<RealVector2D const> ColumnarSnapshot::getCellVelocities() const
+{
+    return getColumn<RealVector2D>(SnapshotColumn_CellVelocities);
+}
+
+std::span<float const> ColumnarSnapshot::getCellEnergies() const
+{
+    return getColumn<float>(SnapshotColumn_CellEnergies);
+}
+
+std::span<int32_t const> ColumnarSnapshot::getCellColors() const
+{
+    return getColumn<int32_t>(SnapshotColumn_CellColors);
+}
+
+std::span<int32_t const> ColumnarSnapshot::getCellCreatureIds() const
+{
+    return getColumn<int32_t>(SnapshotColumn_CellCreatureIds);
+}
+
+std::span<int32_t const> ColumnarSnapshot::getCellMutationIds() const
+{
+    return getColumn<int32_t>(SnapshotColumn_CellMutationIds);
+}
+
+std::span<uint8_t const> ColumnarSnapshot::getCellFunctionTypes() const
+{
+    return getColumn<uint8_t>(SnapshotColumn_CellFunctionTypes);
+}
+
+std::span<uint64_t const> ColumnarSnapshot::getCellConnectionOffsets() const
+{
+    return getColumn<uint64_t>(SnapshotColumn_CellConnectionOffsets);
+}
+
+std::span<uint64_t const> ColumnarSnapshot::getConnectionCellIds() const
+{
+    return getColumn<uint64_t>(SnapshotColumn_ConnectionCellIds);
+}
+
+std::span<float const> ColumnarSnapshot::getConnectionDistances() const
+{
+    return getColumn<float>(SnapshotColumn_ConnectionDistances);
+}
+
+std::span<uint64_t const> ColumnarSnapshot::getCellGenomeOffsets() const
+{
+    return getColumn<uint64_t>(SnapshotColumn_CellGenomeOffsets);
+}
+
+std::span<uint8_t const> ColumnarSnapshot::getGenomeBytes() const
+{
+    return getColumn<uint8_t>(SnapshotColumn_GenomeBytes);
+}
+
+std::span<uint8_t const> ColumnarSnapshot::getGenome(uint64_t cellIndex) const
+{
+    auto offsets = getCellGenomeOffsets();
+    auto bytes = getGenomeBytes();
+    if (cellIndex + 1 >= offsets.size() || offsets[cellIndex] > offsets[cellIndex + 1] || offsets[cellIndex + 1] > bytes.size()) {
+        return {};
+    }
+    return bytes.subspan(offsets[cellIndex], offsets[cellIndex + 1] - offsets[cellIndex]);
+}
+
+std::span<uint64_t const> ColumnarSnapshot::getParticleIds() const
+{
+    return getColumn<uint64_t>(SnapshotColumn_ParticleIds);
+}
+
+std::span<RealVector2D const> ColumnarSnapshot::getParticlePositions() const
+{
+    return getColumn<RealVector2D>(SnapshotColumn_ParticlePositions);
+}
+
+std::span<RealVector2D const> ColumnarSnapshot::getParticleVelocities() const
+{
+    return getColumn<RealVector2D>(SnapshotColumn_ParticleVelocities);
+}
+
+std::span<float const> ColumnarSnapshot::getParticleEnergies() const
+{
+    return getColumn<float>(SnapshotColumn_ParticleEnergies);
+}
+
+std::span<int32_t const> ColumnarSnapshot::getParticleColors() const
+{
+    return getColumn<int32_t>(SnapshotColumn_ParticleColors);
+}
+
+template <typename T>
+std::span<T const> ColumnarSnapshot::getColumn(SnapshotColumn column) const
+{
+    auto const& info = _columns[column];
+    if (info.numElements == 0 || info.elementSize != sizeof(T)) {
+        return {};
+    }
+    return {reinterpret_cast<T const*>(_file->getData() + info.offset), info.numElements};
+}
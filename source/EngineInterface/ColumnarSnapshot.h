@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <span>
+
+#include "Base/Definitions.h"
+#include "Base/MappedFile.h"
+#include "Definitions.h"
+
+using SnapshotColumn = int;
+enum SnapshotColumn_
+{
+    SnapshotColumn_ClusterCellOffsets,
+    SnapshotColumn_CellIds,
+    SnapshotColumn_CellPositions,
+    SnapshotColumn_CellVelocities,
+    SnapshotColumn_CellEnergies,
+    SnapshotColumn_CellColors,
+    SnapshotColumn_CellCreatureIds,
+    SnapshotColumn_CellMutationIds,
+    SnapshotColumn_CellFunctionTypes,
+    SnapshotColumn_CellConnectionOffsets,
+    SnapshotColumn_ConnectionCellIds,
+    SnapshotColumn_ConnectionDistances,
+    SnapshotColumn_CellGenomeOffsets,
+    SnapshotColumn_GenomeBytes,
+    SnapshotColumn_ParticleIds,
+    SnapshotColumn_ParticlePositions,
+    SnapshotColumn_ParticleVelocities,
+    SnapshotColumn_ParticleEnergies,
+    SnapshotColumn_ParticleColors,
+    SnapshotColumn_Count
+};
+
+/**
+ * Uncompressed snapshot of the simulation content where each attribute is stored in a separate aligned column.
+ * The file is memory-mapped on reading and the columns are accessed as typed views without copying.
+ * Offset columns contain one more entry than their owners, e.g. the cells of cluster i are
+ * [clusterCellOffsets[i], clusterCellOffsets[i + 1]) and its connections and genome bytes are addressed likewise.
+ */
+class ColumnarSnapshot
+{
+public:
+    static bool serializeToFile(std::string const& filename, ClusteredDataDescription const& data);
+
+    explicit ColumnarSnapshot(std::string const& filename);  //throws std::runtime_error if file is invalid
+
+    uint64_t getNumClusters() const;
+    uint64_t getNumCells() const;
+    uint64_t getNumParticles() const;
+
+    std::span<uint64_t const> getClusterCellOffsets() const;
+    std::span<uint64_t const> getCellIds() const;
+    std::span<RealVector2D const> getCellPositions() const;
+    std::span<RealVector2D const> getCellVelocities() const;
+    std::span<float const> getCellEnergies() const;
+    std::span<int32_t const> getCellColors() const;
+    std::span<int32_t const> getCellCreatureIds() const;
+    std::span<int32_t const> getCellMutationIds() const;
+    std::span<uint8_t const> getCellFunctionTypes() const;
+
+    std::span<uint64_t const> getCellConnectionOffsets() const;
+    std::span<uint64_t const> getConnectionCellIds() const;
+    std::span<float const> getConnectionDistances() const;
+
+    std::span<uint64_t const> getCellGenomeOffsets() const;
+    std::span<uint8_t const> getGenomeBytes() const;
+    std::span<uint8_t const> getGenome(uint64_t cellIndex) const;  //empty if cell has no constructor or injector
+
+    std::span<uint64_t const> getParticleIds() const;
+    std::span<RealVector2D const> getParticlePositions() const;
+    std::span<RealVector2D const> getParticleVelocities() const;
+    std::span<float const> getParticleEnergies() const;
+    std::span<int32_t const> getParticleColors() const;
+
+private:
+    struct ColumnInfo
+    {
+        uint32_t elementSize = 0;
+        uint64_t offset = 0;
+        uint64_t numElements = 0;
+    };
+
+    template <typename T>
+    std::span<T const> getColumn(SnapshotColumn column) const;
+
+    std::unique_ptr<MappedFile> _file;
+    ColumnInfo _columns[SnapshotColumn_Count];
+};
@@ -23,6 +23,9 @@ struct Settings;
 class _SimulationController;
 using SimulationController = std::shared_ptr<_SimulationController>;
 
+class _SimulationDataSnapshot;
+using SimulationDataSnapshot = std::shared_ptr<_SimulationDataSnapshot>;
+
 struct TimelineStatistics;
 struct HistogramData;
 struct StatisticsData;
@@ -1,31 +1,58 @@
 #include "DescriptionHelper.h"
 
 #include <cmath>
+#include <optional>
+#include <unordered_map>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/map.hpp>
 
+#include "Base/IdAllocator.h"
 #include "Base/NumberGenerator.h"
+#include "Base/RandomStream.h"
 #include "Base/Math.h"
+#include "Base/ThreadPool.h"
 #include "GenomeDescriptions.h"
+#include "LatticeGenerator.h"
+#include "OccupancyGrid.h"
 #include "SpaceCalculator.h"
+#include "SpatialGrid.h"
 #include "GenomeDescriptionConverter.h"
 
+namespace
+{
+    //bonds are derived from the lattice unless maxConnections prevents some of them, in which case they depend on the bonding order
+    DataDescription createLattice(
+        std::vector<IntVector2D> const& sites,
+        LatticeParameters const& parameters,
+        CellDescription const& cellTemplate,
+        float reconnectionDistance)
+    {
+        if (cellTemplate.maxConnections >= LatticeGenerator::getNumNeighbors(parameters._type)) {
+            return LatticeGenerator::generate(sites, parameters, cellTemplate);
+        }
+        auto result = LatticeGenerator::generate(sites, LatticeParameters(parameters).connectCells(false), cellTemplate);
+        DescriptionHelper::reconnectCells(result, reconnectionDistance);
+        return result;
+    }
+}
+
 DataDescription DescriptionHelper::createRect(CreateRectParameters const& parameters)
 {
-    DataDescription result;
+    std::vector<IntVector2D> sites;
+    sites.reserve(std::max(0, parameters._width * parameters._height));
     for (int i = 0; i < parameters._width; ++i) {
         for (int j = 0; j < parameters._height; ++j) {
-            result.addCell(CellDescription()
-                               .setId(NumberGenerator::getInstance().getId())
-                               .setPos({toFloat(i) * parameters._cellDistance, toFloat(j) * parameters._cellDistance})
-                               .setEnergy(parameters._energy)
-                               .setStiffness(parameters._stiffness)
-                               .setMaxConnections(parameters._maxConnections)
-                               .setColor(parameters._color)
-                               .setBarrier(parameters._barrier));
+            sites.emplace_back(IntVector2D{i, j});
         }
     }
-    reconnectCells(result, parameters._cellDistance * 1.1f);
+    auto cellTemplate = CellDescription()
+                            .setEnergy(parameters._energy)
+                            .setStiffness(parameters._stiffness)
+                            .setMaxConnections(parameters._maxConnections)
+                            .setColor(parameters._color)
+                            .setBarrier(parameters._barrier);
+    auto result = createLattice(
+        sites, LatticeParameters().type(LatticeType_Square).cellDistance(parameters._cellDistance), cellTemplate, parameters._cellDistance * 1.1f);
     if (parameters._removeStickiness) {
         removeStickiness(result);
     }
@@ -35,36 +62,24 @@ DataDescription DescriptionHelper::createRect(CreateRectParameters const& parame
 
 DataDescription DescriptionHelper::createHex(CreateHexParameters const& parameters)
 {
-    DataDescription result;
-    auto incY = sqrt(3.0) * parameters._cellDistance / 2.0;
+    //lattice coordinates (q, r) of the hexagonal lattice: the upper layers have negative r
+    std::vector<IntVector2D> sites;
     for (int j = 0; j < parameters._layers; ++j) {
         for (int i = -(parameters._layers - 1); i < parameters._layers - j; ++i) {
-
-            //create cell: upper layer
-            result.addCell(CellDescription()
-                               .setId(NumberGenerator::getInstance().getId())
-                               .setEnergy(parameters._energy)
-                               .setStiffness(parameters._stiffness)
-                               .setPos({toFloat(i * parameters._cellDistance + j * parameters._cellDistance / 2.0), toFloat(-j * incY)})
-                               .setMaxConnections(parameters._maxConnections)
-                               .setColor(parameters._color)
-                               .setBarrier(parameters._barrier));
-
-            //create cell: under layer (except for 0-layer)
+            sites.emplace_back(IntVector2D{i + j, -j});
             if (j > 0) {
-                result.addCell(CellDescription()
-                                 .setId(NumberGenerator::getInstance().getId())
-                                   .setEnergy(parameters._energy)
-                                   .setStiffness(parameters._stiffness)
-                                   .setPos({toFloat(i * parameters._cellDistance + j * parameters._cellDistance / 2.0), toFloat(j * incY)})
-                                   .setMaxConnections(parameters._maxConnections)
-                                   .setColor(parameters._color)
-                                   .setBarrier(parameters._barrier));
+                sites.emplace_back(IntVector2D{i, j});
             }
         }
     }
-
-    reconnectCells(result, parameters._cellDistance * 1.5f);
+    auto cellTemplate = CellDescription()
+                            .setEnergy(parameters._energy)
+                            .setStiffness(parameters._stiffness)
+                            .setMaxConnections(parameters._maxConnections)
+                            .setColor(parameters._color)
+                            .setBarrier(parameters._barrier);
+    auto result = createLattice(
+        sites, LatticeParameters().type(LatticeType_Hexagonal).cellDistance(parameters._cellDistance), cellTemplate, parameters._cellDistance * 1.5f);
     if (parameters._removeStickiness) {
         removeStickiness(result);
     }
@@ -75,18 +90,15 @@ DataDescription DescriptionHelper::createHex(CreateHexParameters const& paramete
 
 DataDescription DescriptionHelper::createUnconnectedCircle(CreateUnconnectedCircleParameters const& parameters)
 {
-    DataDescription result;
+    auto cellTemplate = CellDescription()
+                            .setEnergy(parameters._energy)
+                            .setStiffness(parameters._stiffness)
+                            .setMaxConnections(parameters._maxConnections)
+                            .setColor(parameters._color)
+                            .setBarrier(parameters._barrier);
 
     if (parameters._radius <= 1 + NEAR_ZERO) {
-        result.addCell(CellDescription()
-                           .setId(NumberGenerator::getInstance().getId())
-                           .setPos(parameters._center)
-                           .setEnergy(parameters._energy)
-                           .setStiffness(parameters._stiffness)
-                           .setMaxConnections(parameters._maxConnections)
-                           .setColor(parameters._color)
-                           .setBarrier(parameters._barrier));
-        return result;
+        return LatticeGenerator::generate(std::vector<RealVector2D>{parameters._center}, cellTemplate);
     }
 
     auto centerRow = toInt(parameters._center.y / parameters._cellDistance);
@@ -94,36 +106,30 @@ DataDescription DescriptionHelper::createUnconnectedCircle(CreateUnconnectedCirc
 
     auto startYRow = centerRow - radiusRow;
     auto radiusRounded = radiusRow * parameters._cellDistance;
-    for (float dx = -radiusRounded; dx <= radiusRounded + NEAR_ZERO; dx += parameters._cellDistance) {
-        int row = 0;
-        for (float dy = -radiusRounded; dy <= radiusRounded + NEAR_ZERO; dy += parameters._cellDistance, ++row) {
+    std::vector<RealVector2D> positions;
+    for (int column = -radiusRow; column <= radiusRow; ++column) {
+        auto dx = toFloat(column) * parameters._cellDistance;
+        for (int row = 0; row <= 2 * radiusRow; ++row) {
+            auto dy = toFloat(row - radiusRow) * parameters._cellDistance;
             float evenRowIncrement = (startYRow + row) % 2 == 0 ? parameters._cellDistance / 2 : 0.0f;
             auto dxMod = dx + evenRowIncrement;
             if (dxMod * dxMod + dy * dy > radiusRounded * radiusRounded + NEAR_ZERO) {
                 continue;
             }
-            result.addCell(CellDescription()
-                               .setId(NumberGenerator::getInstance().getId())
-                               .setEnergy(parameters._energy)
-                               .setStiffness(parameters._stiffness)
-                               .setPos({parameters._center.x + dxMod, parameters._center.y + dy})
-                               .setMaxConnections(parameters._maxConnections)
-                               .setColor(parameters._color)
-                               .setBarrier(parameters._barrier));
-
+            positions.emplace_back(RealVector2D{parameters._center.x + dxMod, parameters._center.y + dy});
         }
     }
-    return result;
+    return LatticeGenerator::generate(positions, cellTemplate);
 }
 
 namespace
 {
     void generateNewIds(DataDescription& data)
     {
-        auto& numberGen = NumberGenerator::getInstance();
+        auto& idAllocator = IdAllocator::getInstance();
         std::unordered_map<uint64_t, uint64_t> newByOldIds;
         for (auto& cell : data.cells) {
-            uint64_t newId = numberGen.getId();
+            uint64_t newId = idAllocator.getId();
             newByOldIds.insert_or_assign(cell.id, newId);
             cell.id = newId;
         }
@@ -137,11 +143,10 @@ namespace
 
     void generateNewIds(ClusterDescription& cluster)
     {
-        auto& numberGen = NumberGenerator::getInstance();
-        //cluster.id = numberGen.getId();
+        auto& idAllocator = IdAllocator::getInstance();
         std::unordered_map<uint64_t, uint64_t> newByOldIds;
         for (auto& cell : cluster.cells) {
-            uint64_t newId = numberGen.getId();
+            uint64_t newId = idAllocator.getId();
             newByOldIds.insert_or_assign(cell.id, newId);
             cell.id = newId;
         }
@@ -181,7 +186,7 @@ void DescriptionHelper::duplicate(ClusteredDataDescription& data, IntVector2D co
                 auto origPos = particle.pos;
                 particle.pos = RealVector2D{origPos.x + incX, origPos.y + incY};
                 if (particle.pos.x < size.x && particle.pos.y < size.y) {
-                    particle.setId(NumberGenerator::getInstance().getId());
+                    particle.setId(IdAllocator::getInstance().getId());
                     result.addParticle(particle);
                 }
             }
@@ -190,40 +195,6 @@ void DescriptionHelper::duplicate(ClusteredDataDescription& data, IntVector2D co
     data = result;
 }
 
-namespace
-{
-    std::vector<int> getCellIndicesWithinRadius(
-        DataDescription const& data,
-        std::unordered_map<int, std::unordered_map<int, std::vector<int>>> const& cellIndicesBySlot,
-        RealVector2D const& pos,
-        float radius)
-    {
-        std::vector<int> result;
-        IntVector2D upperLeftIntPos{toInt(pos.x - radius - 0.5f), toInt(pos.y - radius - 0.5f)};
-        IntVector2D lowerRightIntPos{toInt(pos.x + radius + 0.5f), toInt(pos.y + radius + 0.5f)};
-        for (int x = upperLeftIntPos.x; x <= lowerRightIntPos.x; ++x) {
-            for (int y = upperLeftIntPos.y; y <= lowerRightIntPos.y; ++y) {
-                if (cellIndicesBySlot.find(x) != cellIndicesBySlot.end()) {
-                    if (cellIndicesBySlot.at(x).find(y) != cellIndicesBySlot.at(x).end()) {
-                        for (auto const& cellIndex : cellIndicesBySlot.at(x).at(y)) {
-                            auto const& cell = data.cells.at(cellIndex);
-                            if (Math::length(cell.pos - pos) <= radius) {
-                                result.emplace_back(cellIndex);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        std::sort(result.begin(), result.end(), [&](int index1, int index2) {
-            auto const& cell1 = data.cells.at(index1);
-            auto const& cell2 = data.cells.at(index2);
-            return Math::length(cell1.pos - pos) < Math::length(cell2.pos - pos);
-        });
-        return result;
-    }
-}
-
 DataDescription DescriptionHelper::gridMultiply(DataDescription const& input, GridMultiplyParameters const& parameters)
 {
     DataDescription result;
@@ -253,6 +224,54 @@ DataDescription DescriptionHelper::gridMultiply(DataDescription const& input, Gr
     return result;
 }
 
+namespace
+{
+    auto constexpr MaxPlacementAttempts = 200;
+    auto constexpr MinPlacementDistance = 2.0f;
+
+    struct PlacementCandidate
+    {
+        RealVector2D shift;
+        float angle = 0;
+        RealVector2D velocity;
+        float angularVelocity = 0;
+    };
+
+    PlacementCandidate createPlacementCandidate(
+        DescriptionHelper::RandomMultiplyParameters const& parameters,
+        IntVector2D const& worldSize,
+        int copyIndex,
+        int attempt)
+    {
+        //one stream per candidate such that each candidate is reproducible independently of the evaluation order
+        RandomStream randomStream(parameters._seed, static_cast<uint64_t>(copyIndex) * MaxPlacementAttempts + attempt);
+        PlacementCandidate result;
+        result.shift = {randomStream.getRandomFloat(0, toFloat(worldSize.x)), randomStream.getRandomFloat(0, toFloat(worldSize.y))};
+        result.angle = toFloat(toInt(randomStream.getRandomFloat(parameters._minAngle, parameters._maxAngle)));
+        result.velocity = {
+            randomStream.getRandomFloat(parameters._minVelX, parameters._maxVelX), randomStream.getRandomFloat(parameters._minVelY, parameters._maxVelY)};
+        result.angularVelocity = randomStream.getRandomFloat(parameters._minAngularVel, parameters._maxAngularVel);
+        return result;
+    }
+
+    //tests the transformed cell positions without materializing the copy
+    bool isOverlapping(
+        PlacementCandidate const& candidate,
+        RealVector2D const& center,
+        std::vector<RealVector2D> const& relCellPositions,
+        OccupancyGrid const& occupancy)
+    {
+        auto rotationMatrix = Math::calcRotationMatrix(candidate.angle);
+        auto shiftedCenter = center + candidate.shift;
+        for (auto const& relPos : relCellPositions) {
+            if (occupancy.isOccupied(shiftedCenter + rotationMatrix * relPos)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
 DataDescription DescriptionHelper::randomMultiply(
     DataDescription const& input,
     RandomMultiplyParameters const& parameters,
@@ -261,66 +280,75 @@ DataDescription DescriptionHelper::randomMultiply(
     bool& overlappingCheckSuccessful)
 {
     overlappingCheckSuccessful = true;
-    SpaceCalculator spaceCalculator(worldSize);
-    std::unordered_map<IntVector2D, std::vector<RealVector2D>> cellPosBySlot;
+    DataDescription result = input;
+    generateNewIds(result);
+    if (input.isEmpty()) {
+        return result;
+    }
 
-    //create map for overlapping check
+    //occupancy is built once and extended by the accepted copies
+    std::optional<OccupancyGrid> occupancy;
     if (parameters._overlappingCheck) {
-        int index = 0;
+        occupancy.emplace(worldSize, MinPlacementDistance);
         for (auto const& cell : existentData.cells) {
-            auto intPos = toIntVector2D(spaceCalculator.getCorrectedPosition(cell.pos));
-            cellPosBySlot[intPos].emplace_back(cell.pos);
-            ++index;
+            occupancy->add(cell.pos);
         }
     }
 
-    //do multiplication
-    DataDescription result = input;
-    generateNewIds(result);
-    auto& numberGen = NumberGenerator::getInstance();
+    auto center = input.calcCenter();
+    std::vector<RealVector2D> relCellPositions;
+    relCellPositions.reserve(input.cells.size());
+    for (auto const& cell : input.cells) {
+        relCellPositions.emplace_back(cell.pos - center);
+    }
+
+    auto& threadPool = ThreadPool::getInstance();
+    auto batchSize = std::max(1, threadPool.getNumThreads());
+    std::vector<char> overlappingByAttempt(batchSize);
     for (int i = 0; i < parameters._number; ++i) {
-        bool overlapping = false;
-        DataDescription copy;
-        int attempts = 0;
-        do {
-            copy = input;
-            removeMetadata(copy);
-            copy.shift({toFloat(numberGen.getRandomReal(0, toInt(worldSize.x))), toFloat(numberGen.getRandomReal(0, toInt(worldSize.y)))});
-            copy.rotate(toInt(numberGen.getRandomReal(parameters._minAngle, parameters._maxAngle)));
-            copy.accelerate(
-                {toFloat(numberGen.getRandomReal(parameters._minVelX, parameters._maxVelX)),
-                 toFloat(numberGen.getRandomReal(parameters._minVelY, parameters._maxVelY))},
-                toFloat(numberGen.getRandomReal(parameters._minAngularVel, parameters._maxAngularVel)));
-
-            //overlapping check
-            overlapping = false;
-            if (parameters._overlappingCheck) {
-                for (auto const& cell : copy.cells) {
-                    auto pos = spaceCalculator.getCorrectedPosition(cell.pos);
-                    if (isCellPresent(cellPosBySlot, spaceCalculator, pos, 2.0f)) {
-                        overlapping = true;
+
+        //candidates are tested in parallel batches and the first non-overlapping one in attempt order is accepted
+        auto acceptedAttempt = 0;
+        if (occupancy && overlappingCheckSuccessful) {
+            std::optional<int> nonOverlappingAttempt;
+            for (int batchStart = 0; batchStart < MaxPlacementAttempts && !nonOverlappingAttempt; batchStart += batchSize) {
+                auto batchEnd = std::min(batchStart + batchSize, MaxPlacementAttempts);
+                threadPool.parallelFor(batchEnd - batchStart, [&](int begin, int end) {
+                    for (int j = begin; j < end; ++j) {
+                        auto candidate = createPlacementCandidate(parameters, worldSize, i, batchStart + j);
+                        overlappingByAttempt[j] = isOverlapping(candidate, center, relCellPositions, *occupancy);
+                    }
+                });
+                for (int attempt = batchStart; attempt < batchEnd; ++attempt) {
+                    if (!overlappingByAttempt[attempt - batchStart]) {
+                        nonOverlappingAttempt = attempt;
+                        break;
                     }
                 }
             }
-            ++attempts;
-        } while (overlapping && attempts < 200 && overlappingCheckSuccessful);
-        if (attempts == 200) {
-            overlappingCheckSuccessful = false;
+            if (nonOverlappingAttempt) {
+                acceptedAttempt = *nonOverlappingAttempt;
+            } else {
+                overlappingCheckSuccessful = false;
+                acceptedAttempt = MaxPlacementAttempts - 1;
+            }
         }
 
+        //materialize accepted copy
+        auto candidate = createPlacementCandidate(parameters, worldSize, i, acceptedAttempt);
+        auto copy = input;
+        removeMetadata(copy);
+        copy.shift(candidate.shift);
+        copy.rotate(candidate.angle);
+        copy.accelerate(candidate.velocity, candidate.angularVelocity);
         generateNewIds(copy);
         generateNewCreatureIds(copy);
-        result.add(copy);
-
-        //add copy to existentData for overlapping check
-        if (parameters._overlappingCheck) {
+        if (occupancy) {
             for (auto const& cell : copy.cells) {
-                auto index = toInt(existentData.cells.size());
-                existentData.cells.emplace_back(cell);
-                auto intPos = toIntVector2D(spaceCalculator.getCorrectedPosition(cell.pos));
-                cellPosBySlot[intPos].emplace_back(cell.pos);
+                occupancy->add(cell.pos);
             }
         }
+        result.add(copy);
     }
 
     return result;
@@ -343,25 +371,60 @@ void DescriptionHelper::addIfSpaceAvailable(
     }
 }
 
-void DescriptionHelper::reconnectCells(DataDescription& data, float maxDistance)
+namespace
 {
-    std::unordered_map<int, std::unordered_map<int, std::vector<int>>> cellIndicesBySlot;
+    auto constexpr ReconnectionBlockSize = 1024;
+}
 
-    int index = 0;
+void DescriptionHelper::reconnectCells(DataDescription& data, float maxDistance)
+{
+    auto numCells = toInt(data.cells.size());
+    std::vector<RealVector2D> positions;
+    positions.reserve(numCells);
     for (auto& cell : data.cells) {
         cell.connections.clear();
-        cellIndicesBySlot[toInt(cell.pos.x)][toInt(cell.pos.y)].emplace_back(toInt(index));
-        ++index;
-    }
+        positions.emplace_back(cell.pos);
+    }
+    SpatialGrid grid(std::move(positions), maxDistance);
+
+    //parallel neighbor search: nearby cells of cell i are stored at [nearbyCellOffsets[i], nearbyCellOffsets[i + 1]) sorted by distance
+    auto& threadPool = ThreadPool::getInstance();
+    std::vector<int> nearbyCellOffsets(numCells + 1, 0);
+    threadPool.parallelFor(
+        numCells,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                int count = 0;
+                grid.forEachIndexWithinRadius(grid.getPosition(i), maxDistance, [&count](int) { ++count; });
+                nearbyCellOffsets[i + 1] = count;
+            }
+        },
+        ReconnectionBlockSize);
+    for (int i = 0; i < numCells; ++i) {
+        nearbyCellOffsets[i + 1] += nearbyCellOffsets[i];
+    }
+    std::vector<int> nearbyCellIndices(nearbyCellOffsets.back());
+    threadPool.parallelFor(
+        numCells,
+        [&](int begin, int end) {
+            std::vector<int> indices;
+            for (int i = begin; i < end; ++i) {
+                grid.getIndicesWithinRadius(indices, grid.getPosition(i), maxDistance);
+                std::copy(indices.begin(), indices.end(), nearbyCellIndices.begin() + nearbyCellOffsets[i]);
+            }
+        },
+        ReconnectionBlockSize);
 
+    //serial bonding in cell order such that the result is deterministic
     std::unordered_map<uint64_t, int> cache;
+    cache.reserve(numCells);
     for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
         cache.emplace(cell.id, static_cast<int>(index));
     }
-    for (auto& cell : data.cells) {
-        auto nearbyCellIndices = getCellIndicesWithinRadius(data, cellIndicesBySlot, cell.pos, maxDistance);
-        for (auto const& nearbyCellIndex : nearbyCellIndices) {
-            auto const& nearbyCell = data.cells.at(nearbyCellIndex);
+    for (int i = 0; i < numCells; ++i) {
+        auto& cell = data.cells[i];
+        for (int j = nearbyCellOffsets[i]; j < nearbyCellOffsets[i + 1]; ++j) {
+            auto const& nearbyCell = data.cells[nearbyCellIndices[j]];
             if (cell.id != nearbyCell.id && cell.connections.size() < cell.maxConnections && nearbyCell.connections.size() < nearbyCell.maxConnections
                 && !cell.isConnectedTo(nearbyCell.id)) {
                 data.addConnection(cell.id, nearbyCell.id, &cache);
@@ -388,7 +451,7 @@ void DescriptionHelper::correctConnections(ClusteredDataDescription& data, IntVe
     }
     for (auto& cluster : data.clusters) {
         for (auto& cell: cluster.cells) {
-            std::vector<ConnectionDescription> newConnections;
+            ConnectionDescriptions newConnections;
             float angleToAdd = 0;
             for (auto connection : cell.connections) {
                 auto& connectingCell = cellById.at(connection.cellId);
@@ -408,61 +471,86 @@ void DescriptionHelper::correctConnections(ClusteredDataDescription& data, IntVe
     }
 }
 
-void DescriptionHelper::randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes)
+namespace
 {
-    for (auto& cluster : data.clusters) {
-        auto newColor = colorCodes[NumberGenerator::getInstance().getRandomInt(toInt(colorCodes.size()))];
+    auto constexpr RandomizationBlockSize = 64;
+
+    template <typename Func>
+    void forEachClusterWithRandomStream(ClusteredDataDescription& data, uint64_t seed, Func const& func)
+    {
+        ThreadPool::getInstance().parallelFor(
+            toInt(data.clusters.size()),
+            [&](int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    RandomStream randomStream(seed, i);
+                    func(data.clusters[i], randomStream);
+                }
+            },
+            RandomizationBlockSize);
+    }
+}
+
+void DescriptionHelper::randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, uint64_t seed)
+{
+    forEachClusterWithRandomStream(data, seed, [&](ClusterDescription& cluster, RandomStream& randomStream) {
+        auto newColor = colorCodes[randomStream.getRandomInt(toInt(colorCodes.size()))];
         for (auto& cell : cluster.cells) {
             cell.color = newColor;
         }
-    }
+    });
 }
 
 namespace
 {
-    void colorizeGenomeNodes(std::vector<uint8_t>& genome, int color)
+    std::vector<uint8_t> colorizeGenomeNodes(std::vector<uint8_t> const& genome, int color)
     {
         auto desc = GenomeDescriptionConverter::convertBytesToDescription(genome);
         for (auto& node : desc.cells) {
             node.color = color;
             if (node.hasGenome()) {
-                colorizeGenomeNodes(node.getGenomeRef(), color);
+                node.getGenomeRef() = colorizeGenomeNodes(node.getGenomeRef(), color);
             }
         }
-        genome = GenomeDescriptionConverter::convertDescriptionToBytes(desc);
+        return GenomeDescriptionConverter::convertDescriptionToBytes(desc);
     }
 }
 
-void DescriptionHelper::randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes)
+void DescriptionHelper::randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, uint64_t seed)
 {
-    for (auto& cluster : data.clusters) {
-        auto newColor = colorCodes[NumberGenerator::getInstance().getRandomInt(toInt(colorCodes.size()))];
+    forEachClusterWithRandomStream(data, seed, [&](ClusterDescription& cluster, RandomStream& randomStream) {
+        auto newColor = colorCodes[randomStream.getRandomInt(toInt(colorCodes.size()))];
+        std::unordered_map<GenomeBuffer, GenomeBuffer> colorizedGenomes;  //clones share their genome and are colorized once
         for (auto& cell : cluster.cells) {
             if (cell.hasGenome()) {
-                colorizeGenomeNodes(cell.getGenomeRef(), newColor);
+                auto& genome = cell.getGenomeRef();
+                auto findResult = colorizedGenomes.find(genome);
+                if (findResult == colorizedGenomes.end()) {
+                    findResult = colorizedGenomes.emplace(genome, colorizeGenomeNodes(genome, newColor)).first;
+                }
+                genome = findResult->second;
             }
         }
-    }
+    });
 }
 
-void DescriptionHelper::randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy)
+void DescriptionHelper::randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy, uint64_t seed)
 {
-    for (auto& cluster : data.clusters) {
-        auto energy = NumberGenerator::getInstance().getRandomReal(minEnergy, maxEnergy);
+    forEachClusterWithRandomStream(data, seed, [&](ClusterDescription& cluster, RandomStream& randomStream) {
+        auto energy = randomStream.getRandomFloat(minEnergy, maxEnergy);
         for (auto& cell : cluster.cells) {
             cell.energy = energy;
         }
-    }
+    });
 }
 
-void DescriptionHelper::randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge)
+void DescriptionHelper::randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge, uint64_t seed)
 {
-    for (auto& cluster : data.clusters) {
-        auto age = NumberGenerator::getInstance().getRandomReal(minAge, maxAge);
+    forEachClusterWithRandomStream(data, seed, [&](ClusterDescription& cluster, RandomStream& randomStream) {
+        auto age = randomStream.getRandomInt(minAge, maxAge);
         for (auto& cell : cluster.cells) {
             cell.age = age;
         }
-    }
+    });
 }
 
 void DescriptionHelper::generateExecutionOrderNumbers(DataDescription& data, std::unordered_set<uint64_t> const& cellIds, int maxBranchNumbers)
@@ -667,7 +755,7 @@ namespace
 
 std::vector<CellOrParticleDescription> DescriptionHelper::getConstructorToMainGenomes(DataDescription const& data)
 {
-    std::map<std::vector<uint8_t>, size_t> genomeToCellIndex;
+    std::map<GenomeBuffer, size_t> genomeToCellIndex;
     for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
         if (cell.getCellFunctionType() == CellFunction_Constructor) {
             auto const& genome = std::get<ConstructorDescription>(*cell.cellFunction).genome;
@@ -676,7 +764,7 @@ std::vector<CellOrParticleDescription> DescriptionHelper::getConstructorToMainGe
             }
         }
     }
-    std::vector<std::pair<std::vector<uint8_t>, size_t>> genomeAndCellIndex;
+    std::vector<std::pair<GenomeBuffer, size_t>> genomeAndCellIndex;
     for (auto const& [genome, index] : genomeToCellIndex) {
         genomeAndCellIndex.emplace_back(std::make_pair(genome, index));
     }
@@ -688,7 +776,7 @@ std::vector<CellOrParticleDescription> DescriptionHelper::getConstructorToMainGe
         for (auto it2 = genomeAndCellIndex.begin(); it2 != it; ++it2) {
             auto const& genome1 = it->first;
             auto const& genome2 = it2->first;
-            if (contains(genome2, genome1)) {
+            if (contains(genome2.getData(), genome1.getData())) {
                 alreadyContained = true;
                 break;
             }
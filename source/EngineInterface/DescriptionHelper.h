@@ -79,6 +79,7 @@ public:
         MEMBER_DECLARATION(RandomMultiplyParameters, float, minAngularVel, 0);
         MEMBER_DECLARATION(RandomMultiplyParameters, float, maxAngularVel, 0);
         MEMBER_DECLARATION(RandomMultiplyParameters, bool, overlappingCheck, false);
+        MEMBER_DECLARATION(RandomMultiplyParameters, uint64_t, seed, 0);  //same seed yields same placements
     };
     static DataDescription randomMultiply(
         DataDescription const& input,
@@ -95,10 +96,11 @@ public:
     static void removeStickiness(DataDescription& data);
     static void correctConnections(ClusteredDataDescription& data, IntVector2D const& worldSize);
 
-    static void randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes);
-    static void randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes);
-    static void randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy);
-    static void randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge);
+    //randomization per cluster is parallel and reproducible for a fixed seed
+    static void randomizeCellColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, uint64_t seed);
+    static void randomizeGenomeColors(ClusteredDataDescription& data, std::vector<int> const& colorCodes, uint64_t seed);
+    static void randomizeEnergies(ClusteredDataDescription& data, float minEnergy, float maxEnergy, uint64_t seed);
+    static void randomizeAges(ClusteredDataDescription& data, int minAge, int maxAge, uint64_t seed);
 
     static void generateExecutionOrderNumbers(DataDescription& data, std::unordered_set<uint64_t> const& cellIds, int maxBranchNumbers);
 
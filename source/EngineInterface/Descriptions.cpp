@@ -8,7 +8,8 @@
 
 ConstructorDescription::ConstructorDescription()
 {
-    genome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription());
+    static GenomeBuffer const defaultGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription());
+    genome = defaultGenome;
 }
 
 CellFunction CellDescription::getCellFunctionType() const
@@ -58,7 +59,7 @@ bool CellDescription::hasGenome() const
     return false;
 }
 
-std::vector<uint8_t>& CellDescription::getGenomeRef()
+GenomeBuffer& CellDescription::getGenomeRef()
 {
     auto cellFunctionType = getCellFunctionType();
     if (cellFunctionType == CellFunction_Constructor) {
@@ -285,7 +286,7 @@ DataDescription::addConnection(uint64_t const& cellId1, uint64_t const& cellId2,
             newConnection.cellId = otherCell.id;
             newConnection.distance = toFloat(Math::length(otherCell.pos - cell.pos));
 
-            auto connectedCell = getCellRef(cell.connections.front().cellId, cache);
+            auto const& connectedCell = getCellRef(cell.connections.front().cellId, cache);
             auto connectedCellDelta = connectedCell.pos - cell.pos;
             auto prevAngle = Math::angleOfVector(connectedCellDelta);
             auto angleDiff = newAngle - prevAngle;
@@ -300,10 +301,10 @@ DataDescription::addConnection(uint64_t const& cellId1, uint64_t const& cellId2,
             return;
         }
 
-        auto firstConnectedCell = getCellRef(cell.connections.front().cellId, cache);
+        auto const& firstConnectedCell = getCellRef(cell.connections.front().cellId, cache);
         auto firstConnectedCellDelta = firstConnectedCell.pos - cell.pos;
         auto angle = Math::angleOfVector(firstConnectedCellDelta);
-        auto connectionIt = ++cell.connections.begin();
+        auto connectionIt = std::next(cell.connections.begin());
         while (true) {
             auto nextAngle = angle + connectionIt->angleFromPrevious;
 
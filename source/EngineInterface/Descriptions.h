@@ -3,9 +3,11 @@
 #include <variant>
 
 #include "Base/Definitions.h"
+#include "Base/FixedCapacityVector.h"
 #include "EngineInterface/FundamentalConstants.h"
 
 #include "Definitions.h"
+#include "GenomeBuffer.h"
 
 struct CellMetadataDescription
 {
@@ -51,16 +53,17 @@ struct ConnectionDescription
     }
 };
 
+using ConnectionDescriptions = FixedCapacityVector<ConnectionDescription, MAX_CELL_BONDS>;
+
 struct ActivityDescription
 {
-    std::vector<float> channels;
+    std::array<float, MAX_CHANNELS> channels = {};
 
-    ActivityDescription() { channels.resize(MAX_CHANNELS, 0); }
+    ActivityDescription() = default;
     auto operator<=>(ActivityDescription const&) const = default;
 
-    ActivityDescription& setChannels(std::vector<float> const& value)
+    ActivityDescription& setChannels(std::array<float, MAX_CHANNELS> const& value)
     {
-        CHECK(value.size() == MAX_CHANNELS);
         channels = value;
         return *this;
     }
@@ -69,14 +72,9 @@ struct ActivityDescription
 
 struct NeuronDescription
 {
-    std::vector<std::vector<float>> weights;
-    std::vector<float> biases;
+    std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS> weights = {};
+    std::array<float, MAX_CHANNELS> biases = {};
 
-    NeuronDescription()
-    {
-        weights.resize(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS, 0));
-        biases.resize(MAX_CHANNELS, 0);
-    }
     auto operator<=>(NeuronDescription const&) const = default;
 };
 
@@ -97,7 +95,7 @@ struct ConstructorDescription
 {
     int activationMode = 13;   //0 = manual, 1 = every cycle, 2 = every second cycle, 3 = every third cycle, etc.
     int constructionActivationTime = 100;
-    std::vector<uint8_t> genome;
+    GenomeBuffer genome;
     int genomeGeneration = 0;
     float constructionAngle1 = 0;
     float constructionAngle2 = 0;
@@ -120,7 +118,7 @@ struct ConstructorDescription
         constructionActivationTime = value;
         return *this;
     }
-    ConstructorDescription& setGenome(std::vector<uint8_t> const& value)
+    ConstructorDescription& setGenome(GenomeBuffer const& value)
     {
         genome = value;
         return *this;
@@ -204,7 +202,7 @@ struct InjectorDescription
 {
     InjectorMode mode = InjectorMode_InjectAll;
     int counter = 0;
-    std::vector<uint8_t> genome;
+    GenomeBuffer genome;
     int genomeGeneration = 0;
 
     auto operator<=>(InjectorDescription const&) const = default;
@@ -213,7 +211,7 @@ struct InjectorDescription
         mode = value;
         return *this;
     }
-    InjectorDescription& setGenome(std::vector<uint8_t> const& value)
+    InjectorDescription& setGenome(GenomeBuffer const& value)
     {
         genome = value;
         return *this;
@@ -276,7 +274,7 @@ struct CellDescription
     uint64_t id = 0;
 
     //general
-    std::vector<ConnectionDescription> connections;
+    ConnectionDescriptions connections;
     RealVector2D pos;
     RealVector2D vel;
     float energy = 100.0f;
@@ -349,7 +347,7 @@ struct CellDescription
         maxConnections = value;
         return *this;
     }
-    CellDescription& setConnectingCells(std::vector<ConnectionDescription> const& value)
+    CellDescription& setConnectingCells(ConnectionDescriptions const& value)
     {
         connections = value;
         return *this;
@@ -396,13 +394,9 @@ struct CellDescription
         activity = value;
         return *this;
     }
-    CellDescription& setActivity(std::vector<float> const& value)
+    CellDescription& setActivity(std::array<float, MAX_CHANNELS> const& value)
     {
-        CHECK(value.size() == MAX_CHANNELS);
-
-        ActivityDescription newActivity;
-        newActivity.channels = value;
-        activity = newActivity;
+        activity.channels = value;
         return *this;
     }
     CellDescription& setActivationTime(int value)
@@ -412,7 +406,7 @@ struct CellDescription
     }
 
     bool hasGenome() const;
-    std::vector<uint8_t>& getGenomeRef();
+    GenomeBuffer& getGenomeRef();
 
     bool isConnectedTo(uint64_t id) const;
 };
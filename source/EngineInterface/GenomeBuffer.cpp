@@ -0,0 +1,124 @@
+#include "GenomeBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+    auto constexpr NumPoolShards = 64;
+    auto constexpr MinSweepThreshold = 64;
+
+    size_t calcHash(std::span<uint8_t const> data)
+    {
+        return std::hash<std::string_view>()(std::string_view(reinterpret_cast<char const*>(data.data()), data.size()));
+    }
+}
+
+//weak references to all live storages grouped by hash; expired entries are removed lazily
+class GenomeBuffer::StoragePool
+{
+public:
+    static StoragePool& getInstance()
+    {
+        static StoragePool instance;
+        return instance;
+    }
+
+    template <typename CreateData>
+    std::shared_ptr<Storage const> getOrCreate(std::span<uint8_t const> data, CreateData const& createData)
+    {
+        auto hash = calcHash(data);
+        auto& shard = _shards[hash % NumPoolShards];
+        std::lock_guard lock(shard.mutex);
+
+        auto [begin, end] = shard.storages.equal_range(hash);
+        for (auto it = begin; it != end;) {
+            if (auto storage = it->second.lock()) {
+                if (storage->data.size() == data.size() && std::equal(data.begin(), data.end(), storage->data.begin())) {
+                    return storage;
+                }
+                ++it;
+            } else {
+                it = shard.storages.erase(it);
+            }
+        }
+
+        auto result = std::make_shared<Storage const>(createData(), hash);
+        shard.storages.emplace(hash, result);
+        if (toInt(shard.storages.size()) > shard.sweepThreshold) {
+            std::erase_if(shard.storages, [](auto const& hashAndStorage) { return hashAndStorage.second.expired(); });
+            shard.sweepThreshold = std::max(MinSweepThreshold, toInt(shard.storages.size()) * 2);
+        }
+        return result;
+    }
+
+    size_t getNumStorages()
+    {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard lock(shard.mutex);
+            for (auto const& [hash, storage] : shard.storages) {
+                if (!storage.expired()) {
+                    ++result;
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_multimap<size_t, std::weak_ptr<Storage const>> storages;
+        int sweepThreshold = MinSweepThreshold;
+    };
+    std::array<Shard, NumPoolShards> _shards;
+};
+
+GenomeBuffer::Storage::Storage(std::vector<uint8_t>&& data, size_t hash)
+    : data(std::move(data))
+    , hash(hash)
+{}
+
+GenomeBuffer::GenomeBuffer()
+{
+    static GenomeBuffer const emptyBuffer{std::span<uint8_t const>()};
+    _storage = emptyBuffer._storage;
+}
+
+GenomeBuffer::GenomeBuffer(std::vector<uint8_t> const& data)
+    : GenomeBuffer(std::span<uint8_t const>(data))
+{}
+
+GenomeBuffer::GenomeBuffer(std::vector<uint8_t>&& data)
+{
+    _storage = StoragePool::getInstance().getOrCreate(data, [&] { return std::move(data); });
+}
+
+GenomeBuffer::GenomeBuffer(std::span<uint8_t const> data)
+{
+    _storage = StoragePool::getInstance().getOrCreate(data, [&] { return std::vector<uint8_t>(data.begin(), data.end()); });
+}
+
+GenomeNodeIndex const& GenomeBuffer::getNodeIndex() const
+{
+    std::call_once(_storage->nodeIndexFlag, [this] { _storage->nodeIndex = std::make_unique<GenomeNodeIndex>(_storage->data); });
+    return *_storage->nodeIndex;
+}
+
+std::strong_ordering GenomeBuffer::operator<=>(GenomeBuffer const& other) const
+{
+    if (_storage == other._storage) {
+        return std::strong_ordering::equal;
+    }
+    return _storage->data <=> other._storage->data;
+}
+
+size_t GenomeBuffer::getNumDistinctBuffers()
+{
+    return StoragePool::getInstance().getNumStorages();
+}
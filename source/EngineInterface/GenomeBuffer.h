@@ -0,0 +1,70 @@
+#pragma once
+
+#include <compare>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "GenomeNodeIndex.h"
+
+/**
+ * Immutable genome bytes shared by reference counting. All buffers are hash-consed: constructing a buffer with the
+ * content of an existing one reuses its storage, so clones of a creature hold a single copy of their genome and
+ * equality reduces to a pointer comparison. Mutations are done on a copy which is assigned back (copy on write):
+ *     auto bytes = constructor.genome.getData();
+ *     ...
+ *     constructor.genome = std::move(bytes);
+ * Buffers can be created, copied and destroyed concurrently. The node index is built on first use and shared as well.
+ */
+class GenomeBuffer
+{
+public:
+    using value_type = uint8_t;
+    using const_iterator = std::vector<uint8_t>::const_iterator;
+
+    GenomeBuffer();
+    GenomeBuffer(std::vector<uint8_t> const& data);
+    GenomeBuffer(std::vector<uint8_t>&& data);
+    GenomeBuffer(std::span<uint8_t const> data);  //does not allocate if the content is already present
+
+    std::vector<uint8_t> const& getData() const { return _storage->data; }
+    operator std::vector<uint8_t> const&() const { return _storage->data; }
+
+    size_t size() const { return _storage->data.size(); }
+    bool empty() const { return _storage->data.empty(); }
+    uint8_t const* data() const { return _storage->data.data(); }
+    const_iterator begin() const { return _storage->data.begin(); }
+    const_iterator end() const { return _storage->data.end(); }
+    uint8_t operator[](size_t index) const { return _storage->data[index]; }
+
+    size_t getHash() const { return _storage->hash; }
+    GenomeNodeIndex const& getNodeIndex() const;
+    bool isSharedWith(GenomeBuffer const& other) const { return _storage == other._storage; }
+
+    bool operator==(GenomeBuffer const& other) const { return _storage == other._storage; }
+    std::strong_ordering operator<=>(GenomeBuffer const& other) const;
+
+    static size_t getNumDistinctBuffers();  //number of live storages
+
+private:
+    struct Storage
+    {
+        Storage(std::vector<uint8_t>&& data, size_t hash);
+
+        std::vector<uint8_t> data;
+        size_t hash = 0;
+        mutable std::once_flag nodeIndexFlag;
+        mutable std::unique_ptr<GenomeNodeIndex> nodeIndex;
+    };
+    class StoragePool;
+
+    std::shared_ptr<Storage const> _storage;
+};
+
+template <>
+struct std::hash<GenomeBuffer>
+{
+    size_t operator()(GenomeBuffer const& genome) const { return genome.getHash(); }
+};
@@ -0,0 +1,101 @@
+#include "GenomeCursor.h"
+
+#include <algorithm>
+
+#include "GenomeConstants.h"
+
+namespace
+{
+    class ByteReader
+    {
+    public:
+        ByteReader(std::span<uint8_t const> data, int pos)
+            : _data(data)
+            , _pos(pos)
+        {}
+
+        uint8_t readByte()
+        {
+            if (_pos >= toInt(_data.size())) {
+                return 0;
+            }
+            return _data[_pos++];
+        }
+        bool readBool() { return static_cast<int8_t>(readByte()) > 0; }
+        int readWord() { return static_cast<int>(readByte()) | (static_cast<int>(readByte()) << 8); }
+        void skip(int numBytes) { _pos = std::min(_pos + numBytes, toInt(_data.size())); }
+
+        int getPos() const { return _pos; }
+
+    private:
+        std::span<uint8_t const> _data;
+        int _pos = 0;
+    };
+
+    int getFixedNodeBytes(CellFunction cellFunction)
+    {
+        switch (cellFunction) {
+        case CellFunction_Neuron:
+            return Const::NeuronBytes;
+        case CellFunction_Transmitter:
+            return Const::TransmitterBytes;
+        case CellFunction_Constructor:
+            return Const::ConstructorFixedBytes;
+        case CellFunction_Sensor:
+            return Const::SensorBytes;
+        case CellFunction_Nerve:
+            return Const::NerveBytes;
+        case CellFunction_Attacker:
+            return Const::AttackerBytes;
+        case CellFunction_Injector:
+            return Const::InjectorFixedBytes;
+        case CellFunction_Muscle:
+            return Const::MuscleBytes;
+        case CellFunction_Defender:
+            return Const::DefenderBytes;
+        default:
+            return 0;
+        }
+    }
+}
+
+GenomeCursor::GenomeCursor(std::span<uint8_t const> data)
+    : _data(data)
+{
+    _node.address = std::min(Const::GenomeHeaderSize, toInt(_data.size()));
+    readNode();
+}
+
+void GenomeCursor::next()
+{
+    _node.address += _node.size;
+    ++_node.nodeIndex;
+    readNode();
+}
+
+void GenomeCursor::readNode()
+{
+    _node.size = 0;
+    _node.cellFunction = CellFunction_None;
+    _node.hasSubGenome = false;
+    _node.subGenome = {};
+    if (isAtEnd()) {
+        return;
+    }
+
+    ByteReader reader(_data, _node.address);
+    _node.cellFunction = reader.readByte() % CellFunction_Count;
+    reader.skip(Const::CellBasicBytes - 1);
+    reader.skip(getFixedNodeBytes(_node.cellFunction));
+    if (_node.cellFunction == CellFunction_Constructor || _node.cellFunction == CellFunction_Injector) {
+        auto makeGenomeCopy = reader.readBool();
+        if (!makeGenomeCopy) {
+            auto size = reader.readWord();
+            size = std::min(size, toInt(_data.size()) - reader.getPos());
+            _node.hasSubGenome = true;
+            _node.subGenome = _data.subspan(reader.getPos(), size);
+            reader.skip(size);
+        }
+    }
+    _node.size = reader.getPos() - _node.address;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <span>
+
+#include "Base/Definitions.h"
+#include "CellFunctionConstants.h"
+
+struct GenomeNode
+{
+    int nodeIndex = 0;
+    int address = 0;  //byte position in the genome
+    int size = 0;     //number of bytes in the genome, the last node may be truncated
+    CellFunction cellFunction = CellFunction_None;
+    bool hasSubGenome = false;  //false for constructors and injectors which make a copy of their own genome
+    std::span<uint8_t const> subGenome;
+};
+
+/**
+ * Walks over the nodes of a genome in byte order without allocating. Node boundaries follow the decoding rules of
+ * GenomeDescriptionConverter::convertBytesToDescription: bytes beyond the end are read as zero and sub genome sizes
+ * are clipped to the remaining bytes. The genome data must outlive the cursor.
+ */
+class GenomeCursor
+{
+public:
+    GenomeCursor(std::span<uint8_t const> data);
+
+    bool isAtEnd() const { return _node.address >= toInt(_data.size()); }
+    void next();
+
+    GenomeNode const& getNode() const { return _node; }  //valid if not at end
+    int getAddress() const { return _node.address; }     //equals the genome size at the end
+
+    //calls func(node, depth) for the nodes of the genome and its sub genomes in depth-first order where depth is 0 for
+    //the nodes of the genome itself
+    template <typename Func>
+    static void forEachNodeRecursively(std::span<uint8_t const> data, Func const& func, int depth = 0);
+
+private:
+    void readNode();
+
+    std::span<uint8_t const> _data;
+    GenomeNode _node;
+};
+
+template <typename Func>
+void GenomeCursor::forEachNodeRecursively(std::span<uint8_t const> data, Func const& func, int depth)
+{
+    for (GenomeCursor cursor(data); !cursor.isAtEnd(); cursor.next()) {
+        auto const& node = cursor.getNode();
+        func(node, depth);
+        if (node.hasSubGenome) {
+            forEachNodeRecursively(node.subGenome, func, depth + 1);
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include <variant>
 
 #include "Base/Definitions.h"
+#include "GenomeCursor.h"
 
 namespace
 {
@@ -60,7 +61,7 @@ namespace
         }
     }
 
-    uint8_t readByte(std::vector<uint8_t> const& data, int& pos)
+    uint8_t readByte(std::span<uint8_t const> data, int& pos)
     {
         if (pos >= data.size()) {
             return 0;
@@ -68,68 +69,48 @@ namespace
         uint8_t result = data[pos++];
         return result;
     }
-    std::optional<int> readOptionalByte(std::vector<uint8_t> const& data, int& pos, int moduloValue)
+    std::optional<int> readOptionalByte(std::span<uint8_t const> data, int& pos, int moduloValue)
     {
         auto value = static_cast<int>(readByte(data, pos));
         return value > 127 ? std::nullopt : std::make_optional(value % moduloValue);
     }
-    bool readBool(std::vector<uint8_t> const& data, int& pos)
+    bool readBool(std::span<uint8_t const> data, int& pos)
     {
         return static_cast<int8_t>(readByte(data, pos)) > 0;
     }
-    int readWord(std::vector<uint8_t> const& data, int& pos)
+    int readWord(std::span<uint8_t const> data, int& pos)
     {
         return static_cast<int>(readByte(data, pos)) | (static_cast<int>(readByte(data, pos) << 8));
     }
     //between -1 and 1
-    float readFloat(std::vector<uint8_t> const& data, int& pos)
+    float readFloat(std::span<uint8_t const> data, int& pos)
     {
         return static_cast<float>(static_cast<int8_t>(readByte(data, pos))) / 128;
     }
     //between -180 and 180
-    float readAngle(std::vector<uint8_t> const& data, int& pos)
+    float readAngle(std::span<uint8_t const> data, int& pos)
     {
         return static_cast<float>(static_cast<int8_t>(readByte(data, pos))) / 120 * 180;
     }
     //between 36 and 1060
-    float readEnergy(std::vector<uint8_t> const& data, int& pos)
+    float readEnergy(std::span<uint8_t const> data, int& pos)
     {
         return readFloat(data, pos) * 512 + 548.0f; 
     }
     //between 0 and 1
-    float readDensity(std::vector<uint8_t> const& data, int& pos)
+    float readDensity(std::span<uint8_t const> data, int& pos)
     {
         return (readFloat(data, pos) + 1.0f) / 2;
     }
-    float readNeuronProperty(std::vector<uint8_t> const& data, int& pos) { return readFloat(data, pos) * 4; }
-    float readDistance(std::vector<uint8_t> const& data, int& pos)
+    float readNeuronProperty(std::span<uint8_t const> data, int& pos) { return readFloat(data, pos) * 4; }
+    float readDistance(std::span<uint8_t const> data, int& pos)
     {
         return toFloat(readByte(data, pos)) / 255 + 0.5f;
     }
-    float readStiffness(std::vector<uint8_t> const& data, int& pos)
+    float readStiffness(std::span<uint8_t const> data, int& pos)
     {
         return toFloat(readByte(data, pos)) / 255;
     }
-
-    std::variant<MakeGenomeCopy, std::vector<uint8_t>> readGenome(std::vector<uint8_t> const& data, int& pos)
-    {
-        std::variant<MakeGenomeCopy, std::vector<uint8_t>> result;
-
-        bool makeGenomeCopy = readBool(data, pos);
-        if (makeGenomeCopy) {
-            result = MakeGenomeCopy();
-        } else {
-            auto size = readWord(data, pos);
-            size = std::min(size, toInt(data.size()) - pos);
-            std::vector<uint8_t> copiedGenome;
-            copiedGenome.reserve(size);
-            for (int i = 0; i < size; ++i) {
-                copiedGenome.emplace_back(readByte(data, pos));
-            }
-            result = copiedGenome;
-        }
-        return result;
-    }
 }
 
 std::vector<uint8_t> GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription const& genome)
@@ -215,145 +196,151 @@ std::vector<uint8_t> GenomeDescriptionConverter::convertDescriptionToBytes(Genom
 
 namespace
 {
-    struct ConversionResult
-    {
-        GenomeDescription genome;
-        int lastBytePosition = 0;
-    };
-    
-    ConversionResult
-    convertBytesToDescriptionIntern(
-        std::vector<uint8_t> const& data,
-        size_t maxBytePosition,
-        size_t maxEntries)
+    std::variant<MakeGenomeCopy, std::vector<uint8_t>> getSubGenome(GenomeNode const& node)
     {
-        SimulationParameters parameters;
-        ConversionResult result;
+        if (!node.hasSubGenome) {
+            return MakeGenomeCopy();
+        }
+        return std::vector<uint8_t>(node.subGenome.begin(), node.subGenome.end());
+    }
+}
 
-        int nodeIndex = 0;
-        auto& bytePosition = result.lastBytePosition;
+GenomeDescription GenomeDescriptionConverter::convertBytesToDescription(std::vector<uint8_t> const& data)
+{
+    SimulationParameters parameters;
+    GenomeDescription result;
 
-        result.genome.info.shape = readByte(data, bytePosition) % ConstructionShape_Count;
-        result.genome.info.singleConstruction = readBool(data, bytePosition);
-        result.genome.info.separateConstruction = readBool(data, bytePosition);
-        result.genome.info.angleAlignment = readByte(data, bytePosition) % ConstructorAngleAlignment_Count;
-        result.genome.info.stiffness = readStiffness(data, bytePosition);
-        result.genome.info.connectionDistance = readDistance(data, bytePosition);
-        
-        while (bytePosition < maxBytePosition && nodeIndex < maxEntries) {
-            CellFunction cellFunction = readByte(data, bytePosition) % CellFunction_Count;
+    int bytePosition = 0;
+    result.info.shape = readByte(data, bytePosition) % ConstructionShape_Count;
+    result.info.singleConstruction = readBool(data, bytePosition);
+    result.info.separateConstruction = readBool(data, bytePosition);
+    result.info.angleAlignment = readByte(data, bytePosition) % ConstructorAngleAlignment_Count;
+    result.info.stiffness = readStiffness(data, bytePosition);
+    result.info.connectionDistance = readDistance(data, bytePosition);
 
-            CellGenomeDescription cell;
-            cell.referenceAngle = readAngle(data, bytePosition);
-            cell.energy = readEnergy(data, bytePosition);
-            cell.numRequiredAdditionalConnections = readOptionalByte(data, bytePosition, MAX_CELL_BONDS + 1);
-            cell.executionOrderNumber = readByte(data, bytePosition) % parameters.cellNumExecutionOrderNumbers;
-            cell.color = readByte(data, bytePosition) % MAX_COLORS;
-            cell.inputExecutionOrderNumber = readOptionalByte(data, bytePosition, parameters.cellNumExecutionOrderNumbers);
-            cell.outputBlocked = readBool(data, bytePosition);
+    for (GenomeCursor cursor(data); !cursor.isAtEnd(); cursor.next()) {
+        auto const& node = cursor.getNode();
+        bytePosition = node.address + 1;
 
-            switch (cellFunction) {
-            case CellFunction_Neuron: {
-                NeuronGenomeDescription neuron;
-                for (int row = 0; row < MAX_CHANNELS; ++row) {
-                    for (int col = 0; col < MAX_CHANNELS; ++col) {
-                        neuron.weights[row][col] = readNeuronProperty(data, bytePosition);
-                    }
-                }
-                for (int i = 0; i < MAX_CHANNELS; ++i) {
-                    neuron.biases[i] = readNeuronProperty(data, bytePosition);
-                }
-                cell.cellFunction = neuron;
-            } break;
-            case CellFunction_Transmitter: {
-                TransmitterGenomeDescription transmitter;
-                transmitter.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
-                cell.cellFunction = transmitter;
-            } break;
-            case CellFunction_Constructor: {
-                ConstructorGenomeDescription constructor;
-                constructor.mode = readByte(data, bytePosition);
-                constructor.constructionActivationTime = readWord(data, bytePosition);
-                constructor.constructionAngle1 = readAngle(data, bytePosition);
-                constructor.constructionAngle2 = readAngle(data, bytePosition);
-                constructor.genome = readGenome(data, bytePosition);
-                cell.cellFunction = constructor;
-            } break;
-            case CellFunction_Sensor: {
-                SensorGenomeDescription sensor;
-                auto mode = readByte(data, bytePosition) % SensorMode_Count;
-                auto angle = readAngle(data, bytePosition);
-                if (mode == SensorMode_FixedAngle) {
-                    sensor.fixedAngle = angle;
+        CellGenomeDescription cell;
+        cell.referenceAngle = readAngle(data, bytePosition);
+        cell.energy = readEnergy(data, bytePosition);
+        cell.numRequiredAdditionalConnections = readOptionalByte(data, bytePosition, MAX_CELL_BONDS + 1);
+        cell.executionOrderNumber = readByte(data, bytePosition) % parameters.cellNumExecutionOrderNumbers;
+        cell.color = readByte(data, bytePosition) % MAX_COLORS;
+        cell.inputExecutionOrderNumber = readOptionalByte(data, bytePosition, parameters.cellNumExecutionOrderNumbers);
+        cell.outputBlocked = readBool(data, bytePosition);
+
+        switch (node.cellFunction) {
+        case CellFunction_Neuron: {
+            NeuronGenomeDescription neuron;
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    neuron.weights[row][col] = readNeuronProperty(data, bytePosition);
                 }
-                sensor.minDensity = readDensity(data, bytePosition);
-                sensor.color = readByte(data, bytePosition) % MAX_COLORS;
-                cell.cellFunction = sensor;
-            } break;
-            case CellFunction_Nerve: {
-                NerveGenomeDescription nerve;
-                nerve.pulseMode = readByte(data, bytePosition);
-                nerve.alternationMode = readByte(data, bytePosition);
-                cell.cellFunction = nerve;
-            } break;
-            case CellFunction_Attacker: {
-                AttackerGenomeDescription attacker;
-                attacker.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
-                cell.cellFunction = attacker;
-            } break;
-            case CellFunction_Injector: {
-                InjectorGenomeDescription injector;
-                injector.mode = readByte(data, bytePosition) % InjectorMode_Count;
-                injector.genome = readGenome(data, bytePosition);
-                cell.cellFunction = injector;
-            } break;
-            case CellFunction_Muscle: {
-                MuscleGenomeDescription muscle;
-                muscle.mode = readByte(data, bytePosition) % MuscleMode_Count;
-                cell.cellFunction = muscle;
-            } break;
-            case CellFunction_Defender: {
-                DefenderGenomeDescription defender;
-                defender.mode = readByte(data, bytePosition) % DefenderMode_Count;
-                cell.cellFunction = defender;
-            } break;
-            case CellFunction_Placeholder: {
-                cell.cellFunction = PlaceHolderGenomeDescription();
-            } break;
             }
-            result.genome.cells.emplace_back(cell);
-            ++nodeIndex;
+            for (int i = 0; i < MAX_CHANNELS; ++i) {
+                neuron.biases[i] = readNeuronProperty(data, bytePosition);
+            }
+            cell.cellFunction = neuron;
+        } break;
+        case CellFunction_Transmitter: {
+            TransmitterGenomeDescription transmitter;
+            transmitter.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
+            cell.cellFunction = transmitter;
+        } break;
+        case CellFunction_Constructor: {
+            ConstructorGenomeDescription constructor;
+            constructor.mode = readByte(data, bytePosition);
+            constructor.constructionActivationTime = readWord(data, bytePosition);
+            constructor.constructionAngle1 = readAngle(data, bytePosition);
+            constructor.constructionAngle2 = readAngle(data, bytePosition);
+            constructor.genome = getSubGenome(node);
+            cell.cellFunction = constructor;
+        } break;
+        case CellFunction_Sensor: {
+            SensorGenomeDescription sensor;
+            auto mode = readByte(data, bytePosition) % SensorMode_Count;
+            auto angle = readAngle(data, bytePosition);
+            if (mode == SensorMode_FixedAngle) {
+                sensor.fixedAngle = angle;
+            }
+            sensor.minDensity = readDensity(data, bytePosition);
+            sensor.color = readByte(data, bytePosition) % MAX_COLORS;
+            cell.cellFunction = sensor;
+        } break;
+        case CellFunction_Nerve: {
+            NerveGenomeDescription nerve;
+            nerve.pulseMode = readByte(data, bytePosition);
+            nerve.alternationMode = readByte(data, bytePosition);
+            cell.cellFunction = nerve;
+        } break;
+        case CellFunction_Attacker: {
+            AttackerGenomeDescription attacker;
+            attacker.mode = readByte(data, bytePosition) % EnergyDistributionMode_Count;
+            cell.cellFunction = attacker;
+        } break;
+        case CellFunction_Injector: {
+            InjectorGenomeDescription injector;
+            injector.mode = readByte(data, bytePosition) % InjectorMode_Count;
+            injector.genome = getSubGenome(node);
+            cell.cellFunction = injector;
+        } break;
+        case CellFunction_Muscle: {
+            MuscleGenomeDescription muscle;
+            muscle.mode = readByte(data, bytePosition) % MuscleMode_Count;
+            cell.cellFunction = muscle;
+        } break;
+        case CellFunction_Defender: {
+            DefenderGenomeDescription defender;
+            defender.mode = readByte(data, bytePosition) % DefenderMode_Count;
+            cell.cellFunction = defender;
+        } break;
+        case CellFunction_Placeholder: {
+            cell.cellFunction = PlaceHolderGenomeDescription();
+        } break;
         }
-        return result;
+        result.cells.emplace_back(cell);
     }
-
+    return result;
 }
 
-GenomeDescription GenomeDescriptionConverter::convertBytesToDescription(std::vector<uint8_t> const& data)
+int GenomeDescriptionConverter::convertNodeAddressToNodeIndex(std::vector<uint8_t> const& data, int nodeAddress)
 {
-    return convertBytesToDescriptionIntern(data, data.size(), data.size()).genome;
+    GenomeCursor cursor(data);
+    while (!cursor.isAtEnd() && cursor.getAddress() < nodeAddress) {
+        cursor.next();
+    }
+    return cursor.getNode().nodeIndex;
 }
 
-int GenomeDescriptionConverter::convertNodeAddressToNodeIndex(std::vector<uint8_t> const& data, int nodeAddress)
+int GenomeDescriptionConverter::convertNodeAddressToNodeIndex(GenomeBuffer const& data, int nodeAddress)
 {
-    //wasteful approach but sufficient for GUI
-    return convertBytesToDescriptionIntern(data, nodeAddress, data.size()).genome.cells.size();
+    return data.getNodeIndex().convertNodeAddressToNodeIndex(nodeAddress);
 }
 
 int GenomeDescriptionConverter::convertNodeIndexToNodeAddress(std::vector<uint8_t> const& data, int nodeIndex)
 {
-    //wasteful approach but sufficient for GUI
-    return convertBytesToDescriptionIntern(data, data.size(), nodeIndex).lastBytePosition;
+    GenomeCursor cursor(data);
+    while (!cursor.isAtEnd() && cursor.getNode().nodeIndex < nodeIndex) {
+        cursor.next();
+    }
+    return cursor.getAddress();
+}
+
+int GenomeDescriptionConverter::convertNodeIndexToNodeAddress(GenomeBuffer const& data, int nodeIndex)
+{
+    return data.getNodeIndex().convertNodeIndexToNodeAddress(nodeIndex);
 }
 
 int GenomeDescriptionConverter::getNumNodesRecursively(std::vector<uint8_t> const& data)
 {
-    auto genome = convertBytesToDescriptionIntern(data, data.size(), data.size()).genome;
-    auto result = toInt(genome.cells.size());
-    for (auto const& node : genome.cells) {
-        if (auto subgenome = node.getGenome()) {
-            result += getNumNodesRecursively(*subgenome);
-        }
-    }
+    auto result = 0;
+    GenomeCursor::forEachNodeRecursively(data, [&](GenomeNode const&, int) { ++result; });
     return result;
 }
+
+int GenomeDescriptionConverter::getNumNodesRecursively(GenomeBuffer const& data)
+{
+    return data.getNodeIndex().getNumNodesRecursively();
+}
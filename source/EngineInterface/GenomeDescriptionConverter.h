@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "GenomeBuffer.h"
 #include "GenomeDescriptions.h"
 #include "SimulationParameters.h"
 
@@ -12,7 +13,13 @@ public:
     static std::vector<uint8_t> convertDescriptionToBytes(GenomeDescription const& genome);
     static GenomeDescription convertBytesToDescription(std::vector<uint8_t> const& data);
 
+    //walk over the genome without allocating
     static int convertNodeAddressToNodeIndex(std::vector<uint8_t> const& data, int nodeAddress);
     static int convertNodeIndexToNodeAddress(std::vector<uint8_t> const& data, int nodeIndex);
     static int getNumNodesRecursively(std::vector<uint8_t> const& data);
+
+    //use the node index cached in the buffer
+    static int convertNodeAddressToNodeIndex(GenomeBuffer const& data, int nodeAddress);
+    static int convertNodeIndexToNodeAddress(GenomeBuffer const& data, int nodeIndex);
+    static int getNumNodesRecursively(GenomeBuffer const& data);
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <optional>
@@ -16,14 +17,9 @@ struct MakeGenomeCopy
 
 struct NeuronGenomeDescription
 {
-    std::vector<std::vector<float>> weights;
-    std::vector<float> biases;
+    std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS> weights = {};
+    std::array<float, MAX_CHANNELS> biases = {};
 
-    NeuronGenomeDescription()
-    {
-        weights.resize(MAX_CHANNELS, std::vector<float>(MAX_CHANNELS, 0));
-        biases.resize(MAX_CHANNELS, 0);
-    }
     auto operator<=>(NeuronGenomeDescription const&) const = default;
 };
 
@@ -0,0 +1,45 @@
+#include "GenomeNodeIndex.h"
+
+#include <algorithm>
+
+#include "GenomeCursor.h"
+
+GenomeNodeIndex::GenomeNodeIndex(std::span<uint8_t const> data)
+{
+    _nodeIndexByAddress.resize(data.size() + 1, 0);
+
+    GenomeCursor cursor(data);
+    for (; !cursor.isAtEnd(); cursor.next()) {
+        auto const& node = cursor.getNode();
+        _nodeAddresses.emplace_back(node.address);
+        std::fill(_nodeIndexByAddress.begin() + node.address + 1, _nodeIndexByAddress.begin() + node.address + node.size + 1, toInt(_nodeAddresses.size()));
+        if (node.hasSubGenome) {
+            GenomeCursor::forEachNodeRecursively(node.subGenome, [&](GenomeNode const&, int) { ++_numNodesRecursively; });
+        }
+    }
+    _nodeAddresses.emplace_back(cursor.getAddress());
+    _numNodesRecursively += getNumNodes();
+}
+
+int GenomeNodeIndex::getNumNodes() const
+{
+    return toInt(_nodeAddresses.size()) - 1;
+}
+
+int GenomeNodeIndex::getNumNodesRecursively() const
+{
+    return _numNodesRecursively;
+}
+
+int GenomeNodeIndex::convertNodeAddressToNodeIndex(int nodeAddress) const
+{
+    if (nodeAddress >= toInt(_nodeIndexByAddress.size())) {
+        return getNumNodes();
+    }
+    return _nodeIndexByAddress[std::max(0, nodeAddress)];
+}
+
+int GenomeNodeIndex::convertNodeIndexToNodeAddress(int nodeIndex) const
+{
+    return _nodeAddresses[std::max(0, std::min(nodeIndex, getNumNodes()))];
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Base/Definitions.h"
+
+/**
+ * Node offsets of a genome for translating between node addresses and node indices in constant time.
+ * Addresses are byte positions in the genome; the address of the node index after the last node is the genome size.
+ */
+class GenomeNodeIndex
+{
+public:
+    GenomeNodeIndex(std::span<uint8_t const> data);
+
+    int getNumNodes() const;
+    int getNumNodesRecursively() const;  //including the nodes of all sub genomes
+
+    int convertNodeAddressToNodeIndex(int nodeAddress) const;  //number of nodes starting before nodeAddress
+    int convertNodeIndexToNodeAddress(int nodeIndex) const;
+
+private:
+    std::vector<int> _nodeAddresses;            //one entry per node followed by the end address
+    std::vector<uint16_t> _nodeIndexByAddress;  //one entry per byte position including the end
+    int _numNodesRecursively = 0;
+};
@@ -0,0 +1,184 @@
+#include "LatticeGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "Base/Math.h"
+#include "Base/IdAllocator.h"
+#include "Base/ThreadPool.h"
+
+namespace
+{
+    auto constexpr LatticeBlockSize = 1024;
+    auto constexpr MaxLatticeNeighbors = 6;
+
+    struct LatticeNeighbor
+    {
+        IntVector2D offset;
+        float angle = 0;
+    };
+
+    std::vector<LatticeNeighbor> getNeighborsSortedByAngle(LatticeType type)
+    {
+        auto offsets = type == LatticeType_Square ? std::vector<IntVector2D>{{1, 0}, {0, 1}, {-1, 0}, {0, -1}}
+                                                  : std::vector<IntVector2D>{{1, 0}, {-1, 0}, {0, 1}, {-1, 1}, {0, -1}, {1, -1}};
+        std::vector<LatticeNeighbor> result;
+        for (auto const& offset : offsets) {
+            result.emplace_back(LatticeNeighbor{offset, Math::angleOfVector(LatticeGenerator::getPosition(offset, LatticeParameters().type(type)))});
+        }
+        std::ranges::sort(result, [](auto const& neighbor1, auto const& neighbor2) { return neighbor1.angle < neighbor2.angle; });
+        return result;
+    }
+
+    //simulates the insertions of DataDescription::addConnection when all pairs are bonded in emission order:
+    //a bond inserted between the last and the first bond in angle order becomes the first one
+    int getFirstNeighbor(int index, std::array<int, MaxLatticeNeighbors> const& neighborIndices, int numNeighbors)
+    {
+        std::array<int, MaxLatticeNeighbors> bondingOrder;
+        for (int i = 0; i < numNeighbors; ++i) {
+            bondingOrder[i] = i;
+        }
+        auto getBondingKey = [&](int neighbor) {
+            auto neighborIndex = neighborIndices[neighbor];
+            return std::make_pair(std::min(index, neighborIndex), std::max(index, neighborIndex));
+        };
+        std::sort(bondingOrder.begin(), bondingOrder.begin() + numNeighbors, [&](int neighbor1, int neighbor2) {
+            return getBondingKey(neighbor1) < getBondingKey(neighbor2);
+        });
+
+        int result = 0;
+        std::array<bool, MaxLatticeNeighbors> bonded = {};
+        for (int i = 0; i < numNeighbors; ++i) {
+            auto neighbor = bondingOrder[i];
+            if (i == 0) {
+                result = neighbor;
+            } else if (i >= 2) {
+                auto successor = (neighbor + 1) % numNeighbors;
+                while (!bonded[successor]) {
+                    successor = (successor + 1) % numNeighbors;
+                }
+                if (successor == result) {
+                    result = neighbor;
+                }
+            }
+            bonded[neighbor] = true;
+        }
+        return result;
+    }
+
+}
+
+DataDescription LatticeGenerator::generate(std::vector<IntVector2D> const& sites, LatticeParameters const& parameters, CellDescription const& cellTemplate)
+{
+    CHECK(!parameters._connectCells || cellTemplate.maxConnections >= getNumNeighbors(parameters._type));
+
+    auto numSites = toInt(sites.size());
+    auto firstId = IdAllocator::getInstance().reserveIds(numSites);
+
+    //site indices over the bounding box of the lattice coordinates
+    IntVector2D minSite{0, 0};
+    IntVector2D maxSite{-1, -1};
+    if (numSites > 0) {
+        minSite = sites.front();
+        maxSite = sites.front();
+        for (auto const& site : sites) {
+            minSite = {std::min(minSite.x, site.x), std::min(minSite.y, site.y)};
+            maxSite = {std::max(maxSite.x, site.x), std::max(maxSite.y, site.y)};
+        }
+    }
+    IntVector2D boxSize{maxSite.x - minSite.x + 1, maxSite.y - minSite.y + 1};
+    std::vector<int> siteIndices(boxSize.x * boxSize.y, -1);
+    for (int i = 0; i < numSites; ++i) {
+        siteIndices[(sites[i].y - minSite.y) * boxSize.x + sites[i].x - minSite.x] = i;
+    }
+    auto getSiteIndex = [&](IntVector2D const& site) {
+        if (site.x < minSite.x || site.x > maxSite.x || site.y < minSite.y || site.y > maxSite.y) {
+            return -1;
+        }
+        return siteIndices[(site.y - minSite.y) * boxSize.x + site.x - minSite.x];
+    };
+
+    auto neighbors = getNeighborsSortedByAngle(parameters._type);
+    DataDescription result;
+    result.cells.resize(numSites);
+    ThreadPool::getInstance().parallelFor(
+        numSites,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                auto& cell = result.cells[i];
+                cell = cellTemplate;
+                cell.id = firstId + i;
+                cell.pos = getPosition(sites[i], parameters);
+                if (!parameters._connectCells) {
+                    continue;
+                }
+
+                //present neighbors in ascending angle order
+                std::array<int, MaxLatticeNeighbors> neighborIndices;
+                std::array<float, MaxLatticeNeighbors> neighborAngles;
+                int numNeighbors = 0;
+                for (auto const& neighbor : neighbors) {
+                    auto neighborIndex = getSiteIndex({sites[i].x + neighbor.offset.x, sites[i].y + neighbor.offset.y});
+                    if (neighborIndex != -1) {
+                        neighborIndices[numNeighbors] = neighborIndex;
+                        neighborAngles[numNeighbors] = neighbor.angle;
+                        ++numNeighbors;
+                    }
+                }
+                auto firstNeighbor = getFirstNeighbor(i, neighborIndices, numNeighbors);
+
+                for (int j = 0; j < numNeighbors; ++j) {
+                    auto index = (firstNeighbor + j) % numNeighbors;
+                    auto prevIndex = (index + numNeighbors - 1) % numNeighbors;
+                    ConnectionDescription connection;
+                    connection.cellId = firstId + neighborIndices[index];
+                    connection.distance = parameters._cellDistance;
+                    connection.angleFromPrevious = 360.0f;
+                    if (numNeighbors > 1) {
+                        auto angleDiff = neighborAngles[index] - neighborAngles[prevIndex];
+                        connection.angleFromPrevious = angleDiff < 0 ? angleDiff + 360.0f : angleDiff;
+                    }
+                    cell.connections.emplace_back(connection);
+                }
+            }
+        },
+        LatticeBlockSize);
+    return result;
+}
+
+DataDescription LatticeGenerator::generate(std::vector<RealVector2D> const& positions, CellDescription const& cellTemplate)
+{
+    auto numCells = toInt(positions.size());
+    auto firstId = IdAllocator::getInstance().reserveIds(numCells);
+
+    DataDescription result;
+    result.cells.resize(numCells);
+    ThreadPool::getInstance().parallelFor(
+        numCells,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                auto& cell = result.cells[i];
+                cell = cellTemplate;
+                cell.id = firstId + i;
+                cell.pos = positions[i];
+            }
+        },
+        LatticeBlockSize);
+    return result;
+}
+
+RealVector2D LatticeGenerator::getPosition(IntVector2D const& site, LatticeParameters const& parameters)
+{
+    if (parameters._type == LatticeType_Square) {
+        return {toFloat(site.x) * parameters._cellDistance, toFloat(site.y) * parameters._cellDistance};
+    }
+    return {
+        toFloat((site.x + site.y / 2.0) * parameters._cellDistance),
+        toFloat(site.y * std::sqrt(3.0) / 2.0 * parameters._cellDistance)};
+}
+
+int LatticeGenerator::getNumNeighbors(LatticeType type)
+{
+    return type == LatticeType_Square ? 4 : 6;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Descriptions.h"
+
+using LatticeType = int;
+enum LatticeType_
+{
+    LatticeType_Square,
+    LatticeType_Hexagonal
+};
+
+struct LatticeParameters
+{
+    MEMBER_DECLARATION(LatticeParameters, LatticeType, type, LatticeType_Square);
+    MEMBER_DECLARATION(LatticeParameters, float, cellDistance, 1.0f);
+    MEMBER_DECLARATION(LatticeParameters, bool, connectCells, true);
+};
+
+/**
+ * Creates cells on a regular lattice in parallel. Bonds and their angles are derived from the lattice coordinates
+ * instead of a distance search. Lattice coordinates (q, r) are mapped to
+ * - square lattice: (q, r) * cellDistance
+ * - hexagonal lattice: (q + r / 2, r * sqrt(3) / 2) * cellDistance
+ * The sites are given in the order in which the cells are emitted and should cover their bounding box densely. Missing
+ * sites act as holes. The bonds of each cell are ordered as DataDescription::addConnection would order them when bonding
+ * the cells in emission order.
+ */
+class LatticeGenerator
+{
+public:
+    static DataDescription generate(std::vector<IntVector2D> const& sites, LatticeParameters const& parameters, CellDescription const& cellTemplate);
+
+    //creates unconnected cells at arbitrary positions
+    static DataDescription generate(std::vector<RealVector2D> const& positions, CellDescription const& cellTemplate);
+
+    static RealVector2D getPosition(IntVector2D const& site, LatticeParameters const& parameters);
+    static int getNumNeighbors(LatticeType type);
+};
@@ -0,0 +1,61 @@
+#include "OccupancyGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+OccupancyGrid::OccupancyGrid(IntVector2D const& worldSize, float minDistance)
+    : _spaceCalculator(worldSize)
+    , _minDistance(minDistance)
+{
+    //buckets divide the world evenly and are not smaller than minDistance such that only adjacent buckets need to be checked
+    auto minBucketSize = std::max(1.0f, minDistance);
+    _gridSize = {std::max(1, toInt(toFloat(worldSize.x) / minBucketSize)), std::max(1, toInt(toFloat(worldSize.y) / minBucketSize))};
+    _bucketSize = {toFloat(worldSize.x) / toFloat(_gridSize.x), toFloat(worldSize.y) / toFloat(_gridSize.y)};
+    _occupiedBuckets.resize((toInt(_gridSize.x * _gridSize.y) + 63) / 64, 0);
+}
+
+void OccupancyGrid::add(RealVector2D const& pos)
+{
+    auto correctedPos = _spaceCalculator.getCorrectedPosition(pos);
+    auto bucketIndex = getBucketIndex(getBucket(correctedPos));
+    _occupiedBuckets[bucketIndex / 64] |= uint64_t(1) << (bucketIndex % 64);
+    _positionsByBucket[bucketIndex].emplace_back(correctedPos);
+}
+
+bool OccupancyGrid::isOccupied(RealVector2D const& pos) const
+{
+    auto correctedPos = _spaceCalculator.getCorrectedPosition(pos);
+    auto bucket = getBucket(correctedPos);
+    for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            auto bucketIndex = getBucketIndex({bucket.x + dx, bucket.y + dy});
+            if (!isBucketOccupied(bucketIndex)) {
+                continue;
+            }
+            for (auto const& otherPos : _positionsByBucket.at(bucketIndex)) {
+                if (_spaceCalculator.distance(correctedPos, otherPos) < _minDistance) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+IntVector2D OccupancyGrid::getBucket(RealVector2D const& correctedPos) const
+{
+    return {
+        std::min(_gridSize.x - 1, toInt(correctedPos.x / _bucketSize.x)), std::min(_gridSize.y - 1, toInt(correctedPos.y / _bucketSize.y))};
+}
+
+int OccupancyGrid::getBucketIndex(IntVector2D const& bucket) const
+{
+    auto x = (bucket.x + _gridSize.x) % _gridSize.x;
+    auto y = (bucket.y + _gridSize.y) % _gridSize.y;
+    return y * _gridSize.x + x;
+}
+
+bool OccupancyGrid::isBucketOccupied(int bucketIndex) const
+{
+    return (_occupiedBuckets[bucketIndex / 64] >> (bucketIndex % 64)) & 1;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "SpaceCalculator.h"
+
+/**
+ * Occupancy of the periodic world by positions for checking if a position keeps a minimum distance to all others.
+ * A bitmap over buckets of the minimum distance allows quick rejection of free areas; only occupied buckets store
+ * their positions. isOccupied can be called concurrently as long as no positions are added.
+ */
+class OccupancyGrid
+{
+public:
+    OccupancyGrid(IntVector2D const& worldSize, float minDistance);
+
+    void add(RealVector2D const& pos);
+    bool isOccupied(RealVector2D const& pos) const;  //true if a position is nearer than minDistance
+
+private:
+    IntVector2D getBucket(RealVector2D const& correctedPos) const;
+    int getBucketIndex(IntVector2D const& bucket) const;
+    bool isBucketOccupied(int bucketIndex) const;
+
+    SpaceCalculator _spaceCalculator;
+    float _minDistance = 0;
+    RealVector2D _bucketSize;
+    IntVector2D _gridSize;
+    std::vector<uint64_t> _occupiedBuckets;  //bitmap
+    std::unordered_map<int, std::vector<RealVector2D>> _positionsByBucket;
+};
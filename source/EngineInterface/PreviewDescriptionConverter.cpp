@@ -1,5 +1,7 @@
 #include "PreviewDescriptionConverter.h"
 
+#include <string_view>
+
 #include <boost/range/combine.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 
@@ -85,6 +87,66 @@ namespace
         return true;
     }
 
+    //layout of a genome and its sub genomes before it is moved to its final position and angle
+    struct GenomeLayout
+    {
+        std::vector<CellPreviewDescriptionIntern> cellsIntern;
+        RealVector2D direction;
+        bool separateConstruction = true;
+    };
+}
+
+struct SubGenomeLayoutCache
+{
+    struct Entry
+    {
+        std::vector<uint8_t> genomeData;
+        float lastReferenceAngle = 0;
+        GenomeLayout layout;
+        bool used = true;
+    };
+
+    std::optional<GenomeLayout> find(std::vector<uint8_t> const& genomeData, float lastReferenceAngle, int nodeIndex)
+    {
+        auto [begin, end] = entries.equal_range(calcHash(genomeData));
+        for (auto it = begin; it != end; ++it) {
+            auto& entry = it->second;
+            if (entry.lastReferenceAngle == lastReferenceAngle && entry.genomeData == genomeData) {
+                entry.used = true;
+                auto result = entry.layout;
+                for (auto& cell : result.cellsIntern) {
+                    cell.nodeIndex = nodeIndex;
+                }
+                return result;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void insert(std::vector<uint8_t> const& genomeData, float lastReferenceAngle, GenomeLayout const& layout)
+    {
+        entries.emplace(calcHash(genomeData), Entry{genomeData, lastReferenceAngle, layout});
+    }
+
+    //keeps only the layouts which have been used since the last call
+    void removeUnused()
+    {
+        std::erase_if(entries, [](auto const& hashAndEntry) { return !hashAndEntry.second.used; });
+        for (auto& [hash, entry] : entries) {
+            entry.used = false;
+        }
+    }
+
+    static size_t calcHash(std::vector<uint8_t> const& genomeData)
+    {
+        return std::hash<std::string_view>()(std::string_view(reinterpret_cast<char const*>(genomeData.data()), genomeData.size()));
+    }
+
+    std::unordered_multimap<size_t, Entry> entries;
+};
+
+namespace
+{
     struct ProcessedGenomeDescriptionResult
     {
         std::vector<CellPreviewDescriptionIntern> cellsIntern;
@@ -184,21 +246,30 @@ namespace
         return result;
     }
 
-    std::vector<CellPreviewDescriptionIntern> convertToPreviewDescriptionIntern(
+    GenomeLayout getSubGenomeLayout(
+        std::vector<uint8_t> const& genomeData,
+        int nodeIndex,
+        float lastReferenceAngle,
+        SimulationParameters const& parameters,
+        SubGenomeLayoutCache* cache);
+
+    GenomeLayout calcGenomeLayout(
         GenomeDescription const& genome,
         std::optional<int> const& uniformNodeIndex,
         std::optional<float> const& lastReferenceAngle,
-        std::optional<RealVector2D> const& desiredEndPos,
-        std::optional<float> const& desiredEndAngle,
-        SimulationParameters const& parameters)
+        SimulationParameters const& parameters,
+        SubGenomeLayoutCache* cache)
     {
+        GenomeLayout result;
+        result.separateConstruction = genome.info.separateConstruction;
         if (genome.cells.empty()) {
-            return {};
+            return result;
         }
 
         ProcessedGenomeDescriptionResult processedGenome = processMainGenomeDescription(genome, uniformNodeIndex, lastReferenceAngle, parameters);
 
-        std::vector<CellPreviewDescriptionIntern> result = processedGenome.cellsIntern;
+        result.cellsIntern = processedGenome.cellsIntern;
+        result.direction = processedGenome.direction;
 
         //process sub genomes
         size_t indexOffset = 0;
@@ -215,7 +286,6 @@ namespace
                     ++index;
                     continue;
                 }
-                auto subGenome = GenomeDescriptionConverter::convertBytesToDescription(data);
 
                 //angles of connected cells
                 std::vector<float> angles;
@@ -247,28 +317,50 @@ namespace
                 }
                 targetAngle += constructor.constructionAngle1;
                 auto direction = Math::unitVectorOfAngle(targetAngle);
-                auto previewPart = convertToPreviewDescriptionIntern(
-                    subGenome, cellIntern.nodeIndex, constructor.constructionAngle2, cellIntern.pos + direction, targetAngle, parameters);
-                insert(result, previewPart);
+                auto subGenomeLayout = getSubGenomeLayout(data, cellIntern.nodeIndex, constructor.constructionAngle2, parameters, cache);
+                auto& previewPart = subGenomeLayout.cellsIntern;
+                if (previewPart.empty()) {
+                    ++index;
+                    continue;
+                }
+
+                //transform to desired position and angle
+                auto actualEndAngle = Math::angleOfVector(subGenomeLayout.direction);
+                auto angleDiff = Math::subtractAngle(targetAngle, actualEndAngle);
+                rotate(previewPart, previewPart.back().pos, angleDiff + 180.0f);
+                translate(previewPart, cellIntern.pos + direction - previewPart.back().pos);
+
+                insert(result.cellsIntern, previewPart);
                 indexOffset += previewPart.size();
-                if (!subGenome.info.separateConstruction) {
+                if (!subGenomeLayout.separateConstruction) {
                     auto cellIndex1 = previewPart.size() - 1;
                     auto cellIndex2 = index + indexOffset;
-                    result.at(cellIndex1).connectionIndices.insert(toInt(cellIndex2));
-                    result.at(cellIndex2).connectionIndices.insert(toInt(cellIndex1));
+                    result.cellsIntern.at(cellIndex1).connectionIndices.insert(toInt(cellIndex2));
+                    result.cellsIntern.at(cellIndex2).connectionIndices.insert(toInt(cellIndex1));
                 }
             }
             ++index;
         }
+        return result;
+    }
 
-        //transform to desired position and angle
-        if (desiredEndAngle) {
-            auto actualEndAngle = Math::angleOfVector(processedGenome.direction);
-            auto angleDiff = Math::subtractAngle(*desiredEndAngle, actualEndAngle);
-            rotate(result, result.back().pos, angleDiff + 180.0f);
+    //sub genome layouts are cached untransformed since they only depend on the genome data and the last reference angle
+    GenomeLayout getSubGenomeLayout(
+        std::vector<uint8_t> const& genomeData,
+        int nodeIndex,
+        float lastReferenceAngle,
+        SimulationParameters const& parameters,
+        SubGenomeLayoutCache* cache)
+    {
+        if (cache) {
+            if (auto result = cache->find(genomeData, lastReferenceAngle, nodeIndex)) {
+                return *result;
+            }
         }
-        if (desiredEndPos) {
-            translate(result, *desiredEndPos - result.back().pos);
+        auto subGenome = GenomeDescriptionConverter::convertBytesToDescription(genomeData);
+        auto result = calcGenomeLayout(subGenome, nodeIndex, lastReferenceAngle, parameters, cache);
+        if (cache) {
+            cache->insert(genomeData, lastReferenceAngle, result);
         }
         return result;
     }
@@ -308,6 +400,50 @@ namespace
 PreviewDescription
 PreviewDescriptionConverter::convert(GenomeDescription const& genome, std::optional<int> selectedNode, SimulationParameters const& parameters)
 {
-    auto cellInternDescriptions = convertToPreviewDescriptionIntern(genome, std::nullopt, std::nullopt, std::nullopt, std::nullopt, parameters);
-    return createPreviewDescription(cellInternDescriptions, parameters);
+    auto layout = calcGenomeLayout(genome, std::nullopt, std::nullopt, parameters, nullptr);
+    return createPreviewDescription(layout.cellsIntern, parameters);
+}
+
+PreviewDescriptionCache::PreviewDescriptionCache()
+    : _subGenomeLayoutCache(std::make_unique<SubGenomeLayoutCache>())
+{}
+
+PreviewDescriptionCache::~PreviewDescriptionCache() = default;
+
+PreviewDescription const& PreviewDescriptionCache::getPreviewDescription(GenomeDescription const& genome, SimulationParameters const& parameters)
+{
+    return getPreviewDescription(GenomeDescriptionConverter::convertDescriptionToBytes(genome), parameters, [&] { return genome; });
+}
+
+PreviewDescription const& PreviewDescriptionCache::getPreviewDescription(GenomeBuffer const& genomeData, SimulationParameters const& parameters)
+{
+    return getPreviewDescription(genomeData, parameters, [&] { return GenomeDescriptionConverter::convertBytesToDescription(genomeData); });
+}
+
+PreviewDescription const& PreviewDescriptionCache::getPreviewDescription(
+    GenomeBuffer const& genomeData,
+    SimulationParameters const& parameters,
+    std::function<GenomeDescription()> const& getGenome)
+{
+    auto parametersChanged = false;
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        if (_connectingCellMaxDistance[i] != parameters.cellFunctionConstructorConnectingCellMaxDistance[i]) {
+            _connectingCellMaxDistance[i] = parameters.cellFunctionConstructorConnectingCellMaxDistance[i];
+            parametersChanged = true;
+        }
+    }
+    if (parametersChanged) {
+        _subGenomeLayoutCache->entries.clear();
+    }
+
+    if (!parametersChanged && _previewDescription && _genomeData == genomeData) {
+        return *_previewDescription;
+    }
+
+    auto layout = calcGenomeLayout(getGenome(), std::nullopt, std::nullopt, parameters, _subGenomeLayoutCache.get());
+    _subGenomeLayoutCache->removeUnused();
+
+    _previewDescription = createPreviewDescription(layout.cellsIntern, parameters);
+    _genomeData = genomeData;
+    return *_previewDescription;
 }
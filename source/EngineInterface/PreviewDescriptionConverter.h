@@ -1,5 +1,9 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+
+#include "GenomeBuffer.h"
 #include "GenomeDescriptions.h"
 #include "SimulationParameters.h"
 #include "PreviewDescriptions.h"
@@ -11,3 +15,30 @@ public:
     static PreviewDescription convert(GenomeDescription const& genome, std::optional<int> selectedNode, SimulationParameters const& parameters);
 };
 
+struct SubGenomeLayoutCache;
+
+/**
+ * Returns the preview of the last requested genome without recalculation as long as the genome content (compared via the
+ * hash-consed GenomeBuffer) and the relevant simulation parameters are unchanged.
+ * Layouts of sub genomes are cached as well and reused if only other parts of the genome change.
+ */
+class PreviewDescriptionCache
+{
+public:
+    PreviewDescriptionCache();
+    ~PreviewDescriptionCache();
+
+    PreviewDescription const& getPreviewDescription(GenomeDescription const& genome, SimulationParameters const& parameters);
+    PreviewDescription const& getPreviewDescription(GenomeBuffer const& genomeData, SimulationParameters const& parameters);
+
+private:
+    PreviewDescription const& getPreviewDescription(
+        GenomeBuffer const& genomeData,
+        SimulationParameters const& parameters,
+        std::function<GenomeDescription()> const& getGenome);
+
+    std::optional<PreviewDescription> _previewDescription;
+    GenomeBuffer _genomeData;
+    float _connectingCellMaxDistance[MAX_COLORS] = {};
+    std::unique_ptr<SubGenomeLayoutCache> _subGenomeLayoutCache;
+};
@@ -7,6 +7,8 @@ struct CellPreviewDescription
     int executionOrderNumber = 0;
     int color = 0;
     int nodeIndex = 0;
+
+    auto operator<=>(CellPreviewDescription const&) const = default;
 };
 
 struct ConnectionPreviewDescription
@@ -15,10 +17,14 @@ struct ConnectionPreviewDescription
     RealVector2D cell2;
     bool arrowToCell1 = false;
     bool arrowToCell2 = false;
+
+    auto operator<=>(ConnectionPreviewDescription const&) const = default;
 };
 
 struct PreviewDescription
 {
     std::vector<CellPreviewDescription> cells;
     std::vector<ConnectionPreviewDescription> connections;
+
+    auto operator<=>(PreviewDescription const&) const = default;
 };
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Descriptions.h"
+#include "SelectionShallowData.h"
+#include "StatisticsData.h"
+
+/**
+ * Summary of the simulation state which is published by the worker thread at regular intervals,
+ * so that it can be read every frame without interrupting the simulation.
+ */
+struct PublishedFrame
+{
+    uint64_t version = 0;  //0 = nothing published yet
+    uint64_t timestep = 0;
+    StatisticsData statistics;
+    SelectionShallowData selection;
+
+    uint64_t inspectionRequest = 0;  //latest request of inspected entities contained in this frame
+    DataDescription inspectedData;
+};
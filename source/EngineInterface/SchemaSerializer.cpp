@@ -0,0 +1,1106 @@
+#include "SchemaSerializer.h"
+
+#include <bit>
+#include <cstring>
+
+namespace
+{
+    auto constexpr Id_Particle_Id = 0;
+    auto constexpr Id_Particle_Pos = 1;
+    auto constexpr Id_Particle_Vel = 2;
+    auto constexpr Id_Particle_Energy = 3;
+    auto constexpr Id_Particle_Color = 4;
+
+    auto constexpr Id_Cell_Id = 0;
+    auto constexpr Id_Cell_Connections = 1;
+    auto constexpr Id_Cell_Pos = 2;
+    auto constexpr Id_Cell_Vel = 3;
+    auto constexpr Id_Cell_Energy = 4;
+    auto constexpr Id_Cell_Stiffness = 5;
+    auto constexpr Id_Cell_Color = 6;
+    auto constexpr Id_Cell_MaxConnections = 7;
+    auto constexpr Id_Cell_Barrier = 8;
+    auto constexpr Id_Cell_Age = 9;
+    auto constexpr Id_Cell_LivingState = 10;
+    auto constexpr Id_Cell_CreatureId = 11;
+    auto constexpr Id_Cell_MutationId = 12;
+    auto constexpr Id_Cell_ExecutionOrderNumber = 13;
+    auto constexpr Id_Cell_InputExecutionOrderNumber = 14;
+    auto constexpr Id_Cell_OutputBlocked = 15;
+    auto constexpr Id_Cell_CellFunction = 16;
+    auto constexpr Id_Cell_Activity = 17;
+    auto constexpr Id_Cell_ActivationTime = 18;
+    auto constexpr Id_Cell_MetadataName = 19;
+    auto constexpr Id_Cell_MetadataDescription = 20;
+
+    auto constexpr Id_Neuron_Weights = 0;
+    auto constexpr Id_Neuron_Biases = 1;
+
+    auto constexpr Id_Transmitter_Mode = 0;
+
+    auto constexpr Id_Constructor_ActivationMode = 0;
+    auto constexpr Id_Constructor_ConstructionActivationTime = 1;
+    auto constexpr Id_Constructor_Genome = 2;
+    auto constexpr Id_Constructor_GenomeGeneration = 3;
+    auto constexpr Id_Constructor_ConstructionAngle1 = 4;
+    auto constexpr Id_Constructor_ConstructionAngle2 = 5;
+    auto constexpr Id_Constructor_GenomeReadPosition = 6;
+    auto constexpr Id_Constructor_OffspringCreatureId = 7;
+    auto constexpr Id_Constructor_OffspringMutationId = 8;
+
+    auto constexpr Id_Sensor_FixedAngle = 0;
+    auto constexpr Id_Sensor_MinDensity = 1;
+    auto constexpr Id_Sensor_Color = 2;
+
+    auto constexpr Id_Nerve_PulseMode = 0;
+    auto constexpr Id_Nerve_AlternationMode = 1;
+
+    auto constexpr Id_Attacker_Mode = 0;
+
+    auto constexpr Id_Injector_Mode = 0;
+    auto constexpr Id_Injector_Counter = 1;
+    auto constexpr Id_Injector_Genome = 2;
+    auto constexpr Id_Injector_GenomeGeneration = 3;
+
+    auto constexpr Id_Muscle_Mode = 0;
+    auto constexpr Id_Muscle_LastBendingDirection = 1;
+    auto constexpr Id_Muscle_LastBendingSourceIndex = 2;
+    auto constexpr Id_Muscle_ConsecutiveBendingAngle = 3;
+
+    auto constexpr Id_Defender_Mode = 0;
+
+    Schema createSchema()
+    {
+        Schema result(SchemaObjectType_Count);
+        result[SchemaObjectType_Particle] = {
+            {Id_Particle_Id, SchemaFieldType_UInt64},
+            {Id_Particle_Pos, SchemaFieldType_Vector2D},
+            {Id_Particle_Vel, SchemaFieldType_Vector2D},
+            {Id_Particle_Energy, SchemaFieldType_Float},
+            {Id_Particle_Color, SchemaFieldType_Int}};
+        result[SchemaObjectType_Cell] = {
+            {Id_Cell_Id, SchemaFieldType_UInt64},
+            {Id_Cell_Connections, SchemaFieldType_Connections},
+            {Id_Cell_Pos, SchemaFieldType_Vector2D},
+            {Id_Cell_Vel, SchemaFieldType_Vector2D},
+            {Id_Cell_Energy, SchemaFieldType_Float},
+            {Id_Cell_Stiffness, SchemaFieldType_Float},
+            {Id_Cell_Color, SchemaFieldType_Int},
+            {Id_Cell_MaxConnections, SchemaFieldType_Int},
+            {Id_Cell_Barrier, SchemaFieldType_Bool},
+            {Id_Cell_Age, SchemaFieldType_Int},
+            {Id_Cell_LivingState, SchemaFieldType_Int},
+            {Id_Cell_CreatureId, SchemaFieldType_Int},
+            {Id_Cell_MutationId, SchemaFieldType_Int},
+            {Id_Cell_ExecutionOrderNumber, SchemaFieldType_Int},
+            {Id_Cell_InputExecutionOrderNumber, SchemaFieldType_OptionalInt},
+            {Id_Cell_OutputBlocked, SchemaFieldType_Bool},
+            {Id_Cell_CellFunction, SchemaFieldType_CellFunction},
+            {Id_Cell_Activity, SchemaFieldType_FloatArray},
+            {Id_Cell_ActivationTime, SchemaFieldType_Int},
+            {Id_Cell_MetadataName, SchemaFieldType_Bytes},
+            {Id_Cell_MetadataDescription, SchemaFieldType_Bytes}};
+        result[SchemaObjectType_Neuron] = {{Id_Neuron_Weights, SchemaFieldType_FloatArray}, {Id_Neuron_Biases, SchemaFieldType_FloatArray}};
+        result[SchemaObjectType_Transmitter] = {{Id_Transmitter_Mode, SchemaFieldType_Int}};
+        result[SchemaObjectType_Constructor] = {
+            {Id_Constructor_ActivationMode, SchemaFieldType_Int},
+            {Id_Constructor_ConstructionActivationTime, SchemaFieldType_Int},
+            {Id_Constructor_Genome, SchemaFieldType_Bytes},
+            {Id_Constructor_GenomeGeneration, SchemaFieldType_Int},
+            {Id_Constructor_ConstructionAngle1, SchemaFieldType_Float},
+            {Id_Constructor_ConstructionAngle2, SchemaFieldType_Float},
+            {Id_Constructor_GenomeReadPosition, SchemaFieldType_Int},
+            {Id_Constructor_OffspringCreatureId, SchemaFieldType_Int},
+            {Id_Constructor_OffspringMutationId, SchemaFieldType_Int}};
+        result[SchemaObjectType_Sensor] = {
+            {Id_Sensor_FixedAngle, SchemaFieldType_OptionalFloat}, {Id_Sensor_MinDensity, SchemaFieldType_Float}, {Id_Sensor_Color, SchemaFieldType_Int}};
+        result[SchemaObjectType_Nerve] = {{Id_Nerve_PulseMode, SchemaFieldType_Int}, {Id_Nerve_AlternationMode, SchemaFieldType_Int}};
+        result[SchemaObjectType_Attacker] = {{Id_Attacker_Mode, SchemaFieldType_Int}};
+        result[SchemaObjectType_Injector] = {
+            {Id_Injector_Mode, SchemaFieldType_Int},
+            {Id_Injector_Counter, SchemaFieldType_Int},
+            {Id_Injector_Genome, SchemaFieldType_Bytes},
+            {Id_Injector_GenomeGeneration, SchemaFieldType_Int}};
+        result[SchemaObjectType_Muscle] = {
+            {Id_Muscle_Mode, SchemaFieldType_Int},
+            {Id_Muscle_LastBendingDirection, SchemaFieldType_Int},
+            {Id_Muscle_LastBendingSourceIndex, SchemaFieldType_Int},
+            {Id_Muscle_ConsecutiveBendingAngle, SchemaFieldType_Float}};
+        result[SchemaObjectType_Defender] = {{Id_Defender_Mode, SchemaFieldType_Int}};
+        result[SchemaObjectType_Placeholder] = {};
+        return result;
+    }
+
+    SchemaObjectType getSchemaObjectType(CellFunction cellFunction)
+    {
+        return SchemaObjectType_Neuron + cellFunction;
+    }
+
+    //writing
+    void writeByte(std::string& output, uint8_t value)
+    {
+        output.push_back(static_cast<char>(value));
+    }
+    void writeUInt32(std::string& output, uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i) {
+            output.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+        }
+    }
+    void writeUInt64(std::string& output, uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i) {
+            output.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+        }
+    }
+    void writeBool(std::string& output, bool value) { writeByte(output, value ? 1 : 0); }
+    void writeInt(std::string& output, int value) { writeUInt32(output, static_cast<uint32_t>(value)); }
+    void writeFloat(std::string& output, float value) { writeUInt32(output, std::bit_cast<uint32_t>(value)); }
+    void writeVector2D(std::string& output, RealVector2D const& value)
+    {
+        writeFloat(output, value.x);
+        writeFloat(output, value.y);
+    }
+    void writeOptionalInt(std::string& output, std::optional<int> const& value)
+    {
+        writeBool(output, value.has_value());
+        writeInt(output, value.value_or(0));
+    }
+    void writeOptionalFloat(std::string& output, std::optional<float> const& value)
+    {
+        writeBool(output, value.has_value());
+        writeFloat(output, value.value_or(0.0f));
+    }
+    void writeFloatArray(std::string& output, float const* values, int size)
+    {
+        writeUInt32(output, size);
+        for (int i = 0; i < size; ++i) {
+            writeFloat(output, values[i]);
+        }
+    }
+    void writeBytes(std::string& output, void const* data, size_t size)
+    {
+        writeUInt32(output, static_cast<uint32_t>(size));
+        output.append(static_cast<char const*>(data), size);
+    }
+
+    //reading
+    class ByteReader
+    {
+    public:
+        ByteReader(std::string_view data)
+            : _data(data)
+        {}
+
+        uint8_t readByte()
+        {
+            checkAvailable(1);
+            return static_cast<uint8_t>(_data[_pos++]);
+        }
+        uint32_t readUInt32()
+        {
+            checkAvailable(4);
+            uint32_t result = 0;
+            for (int i = 0; i < 4; ++i) {
+                result |= static_cast<uint32_t>(static_cast<uint8_t>(_data[_pos++])) << (i * 8);
+            }
+            return result;
+        }
+        uint64_t readUInt64()
+        {
+            checkAvailable(8);
+            uint64_t result = 0;
+            for (int i = 0; i < 8; ++i) {
+                result |= static_cast<uint64_t>(static_cast<uint8_t>(_data[_pos++])) << (i * 8);
+            }
+            return result;
+        }
+        bool readBool() { return readByte() != 0; }
+        int readInt() { return static_cast<int>(readUInt32()); }
+        float readFloat() { return std::bit_cast<float>(readUInt32()); }
+        RealVector2D readVector2D()
+        {
+            auto x = readFloat();
+            auto y = readFloat();
+            return {x, y};
+        }
+        std::optional<int> readOptionalInt()
+        {
+            auto hasValue = readBool();
+            auto value = readInt();
+            return hasValue ? std::make_optional(value) : std::nullopt;
+        }
+        std::optional<float> readOptionalFloat()
+        {
+            auto hasValue = readBool();
+            auto value = readFloat();
+            return hasValue ? std::make_optional(value) : std::nullopt;
+        }
+
+        //returns number of values in file, values beyond maxSize are skipped
+        int readFloatArray(float* values, int maxSize)
+        {
+            auto size = toInt(readUInt32());
+            for (int i = 0; i < size; ++i) {
+                auto value = readFloat();
+                if (i < maxSize) {
+                    values[i] = value;
+                }
+            }
+            return size;
+        }
+        template <typename Container>
+        void readBytes(Container& target)
+        {
+            auto size = readUInt32();
+            checkAvailable(size);
+            target.resize(size);
+            if (size > 0) {
+                std::memcpy(target.data(), _data.data() + _pos, size);
+            }
+            _pos += size;
+        }
+        //genomes are hash-consed directly from the input without an intermediate copy
+        GenomeBuffer readGenome()
+        {
+            auto size = readUInt32();
+            checkAvailable(size);
+            GenomeBuffer result(std::span<uint8_t const>(reinterpret_cast<uint8_t const*>(_data.data()) + _pos, size));
+            _pos += size;
+            return result;
+        }
+
+        uint64_t getPosition() const { return _pos; }
+
+        //a corrupt count would otherwise cause an excessive allocation before reading fails
+        void checkCount(uint64_t count, uint64_t minElementSize) const
+        {
+            if (count > (_data.size() - _pos) / std::max(minElementSize, uint64_t(1))) {
+                throw std::runtime_error("Unexpected end of data.");
+            }
+        }
+
+        void skip(uint64_t numBytes)
+        {
+            checkAvailable(numBytes);
+            _pos += numBytes;
+        }
+
+    private:
+        void checkAvailable(uint64_t numBytes) const
+        {
+            if (_pos + numBytes > _data.size()) {
+                throw std::runtime_error("Unexpected end of data.");
+            }
+        }
+
+        std::string_view _data;
+        uint64_t _pos = 0;
+    };
+
+    struct DecodingContext
+    {
+        Schema const& fileSchema;
+        std::vector<std::vector<bool>> isFieldKnown;  //true if field id and type of file schema match the current schema
+
+        DecodingContext(Schema const& fileSchema_)
+            : fileSchema(fileSchema_)
+        {
+            auto const& schema = SchemaSerializer::getSchema();
+            isFieldKnown.resize(fileSchema.size());
+            for (size_t objectType = 0; objectType < fileSchema.size(); ++objectType) {
+                for (auto const& fileField : fileSchema[objectType]) {
+                    auto isKnown = false;
+                    if (objectType < schema.size()) {
+                        for (auto const& field : schema[objectType]) {
+                            if (field.id == fileField.id && field.type == fileField.type) {
+                                isKnown = true;
+                            }
+                        }
+                    }
+                    isFieldKnown[objectType].emplace_back(isKnown);
+                }
+            }
+        }
+    };
+
+    void skipField(ByteReader& reader, SchemaFieldType type, DecodingContext const& context);
+
+    uint64_t getMinFieldSize(SchemaFieldType type)
+    {
+        switch (type) {
+        case SchemaFieldType_Bool:
+        case SchemaFieldType_CellFunction:
+            return 1;
+        case SchemaFieldType_Int:
+        case SchemaFieldType_Float:
+        case SchemaFieldType_FloatArray:
+        case SchemaFieldType_Bytes:
+        case SchemaFieldType_Connections:
+            return 4;
+        case SchemaFieldType_OptionalInt:
+        case SchemaFieldType_OptionalFloat:
+            return 5;
+        case SchemaFieldType_UInt64:
+        case SchemaFieldType_Vector2D:
+            return 8;
+        default:
+            return 0;
+        }
+    }
+
+    uint64_t getMinObjectSize(SchemaObjectType objectType, DecodingContext const& context)
+    {
+        uint64_t result = 0;
+        if (objectType < toInt(context.fileSchema.size())) {
+            for (auto const& field : context.fileSchema[objectType]) {
+                result += getMinFieldSize(field.type);
+            }
+        }
+        return result;
+    }
+
+    void skipObject(ByteReader& reader, SchemaObjectType objectType, DecodingContext const& context)
+    {
+        if (objectType >= toInt(context.fileSchema.size())) {
+            throw std::runtime_error("Unknown object type.");
+        }
+        for (auto const& field : context.fileSchema[objectType]) {
+            skipField(reader, field.type, context);
+        }
+    }
+
+    void skipField(ByteReader& reader, SchemaFieldType type, DecodingContext const& context)
+    {
+        switch (type) {
+        case SchemaFieldType_Bool:
+            reader.skip(1);
+            break;
+        case SchemaFieldType_Int:
+        case SchemaFieldType_Float:
+            reader.skip(4);
+            break;
+        case SchemaFieldType_UInt64:
+        case SchemaFieldType_Vector2D:
+            reader.skip(8);
+            break;
+        case SchemaFieldType_OptionalInt:
+        case SchemaFieldType_OptionalFloat:
+            reader.skip(5);
+            break;
+        case SchemaFieldType_FloatArray:
+            reader.skip(uint64_t(reader.readUInt32()) * 4);
+            break;
+        case SchemaFieldType_Bytes:
+            reader.skip(reader.readUInt32());
+            break;
+        case SchemaFieldType_Connections:
+            reader.skip(uint64_t(reader.readUInt32()) * 16);
+            break;
+        case SchemaFieldType_CellFunction: {
+            CellFunction cellFunction = reader.readByte();
+            if (cellFunction != CellFunction_None) {
+                skipObject(reader, getSchemaObjectType(cellFunction), context);
+            }
+        } break;
+        default:
+            throw std::runtime_error("Unknown field type.");
+        }
+    }
+
+    template <typename Object>
+    void encodeField(std::string& output, Object const& object, int fieldId);
+
+    template <typename Object>
+    void decodeField(ByteReader& reader, Object& object, int fieldId, DecodingContext const& context);
+
+    template <typename Object>
+    void encodeObject(std::string& output, Object const& object, SchemaObjectType objectType)
+    {
+        for (auto const& field : SchemaSerializer::getSchema()[objectType]) {
+            encodeField(output, object, field.id);
+        }
+    }
+
+    template <typename Object>
+    void decodeObject(ByteReader& reader, Object& object, SchemaObjectType objectType, DecodingContext const& context)
+    {
+        if (objectType >= toInt(context.fileSchema.size())) {
+            throw std::runtime_error("Unknown object type.");
+        }
+        auto const& fileFields = context.fileSchema[objectType];
+        auto const& isFieldKnown = context.isFieldKnown[objectType];
+        for (size_t i = 0; i < fileFields.size(); ++i) {
+            if (isFieldKnown[i]) {
+                decodeField(reader, object, fileFields[i].id, context);
+            } else {
+                skipField(reader, fileFields[i].type, context);
+            }
+        }
+    }
+
+    //particle
+    template <>
+    void encodeField(std::string& output, ParticleDescription const& particle, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Particle_Id:
+            writeUInt64(output, particle.id);
+            break;
+        case Id_Particle_Pos:
+            writeVector2D(output, particle.pos);
+            break;
+        case Id_Particle_Vel:
+            writeVector2D(output, particle.vel);
+            break;
+        case Id_Particle_Energy:
+            writeFloat(output, particle.energy);
+            break;
+        case Id_Particle_Color:
+            writeInt(output, particle.color);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, ParticleDescription& particle, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Particle_Id:
+            particle.id = reader.readUInt64();
+            break;
+        case Id_Particle_Pos:
+            particle.pos = reader.readVector2D();
+            break;
+        case Id_Particle_Vel:
+            particle.vel = reader.readVector2D();
+            break;
+        case Id_Particle_Energy:
+            particle.energy = reader.readFloat();
+            break;
+        case Id_Particle_Color:
+            particle.color = reader.readInt();
+            break;
+        }
+    }
+
+    //cell functions
+    template <>
+    void encodeField(std::string& output, NeuronDescription const& neuron, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Neuron_Weights: {
+            writeUInt32(output, MAX_CHANNELS * MAX_CHANNELS);
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    writeFloat(output, neuron.weights[row][col]);
+                }
+            }
+        } break;
+        case Id_Neuron_Biases:
+            writeFloatArray(output, neuron.biases.data(), MAX_CHANNELS);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, NeuronDescription& neuron, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Neuron_Weights: {
+            float weights[MAX_CHANNELS * MAX_CHANNELS] = {};
+            reader.readFloatArray(weights, MAX_CHANNELS * MAX_CHANNELS);
+            for (int row = 0; row < MAX_CHANNELS; ++row) {
+                for (int col = 0; col < MAX_CHANNELS; ++col) {
+                    neuron.weights[row][col] = weights[col + row * MAX_CHANNELS];
+                }
+            }
+        } break;
+        case Id_Neuron_Biases:
+            reader.readFloatArray(neuron.biases.data(), MAX_CHANNELS);
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, TransmitterDescription const& transmitter, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Transmitter_Mode:
+            writeInt(output, transmitter.mode);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, TransmitterDescription& transmitter, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Transmitter_Mode:
+            transmitter.mode = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, ConstructorDescription const& constructor, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Constructor_ActivationMode:
+            writeInt(output, constructor.activationMode);
+            break;
+        case Id_Constructor_ConstructionActivationTime:
+            writeInt(output, constructor.constructionActivationTime);
+            break;
+        case Id_Constructor_Genome:
+            writeBytes(output, constructor.genome.data(), constructor.genome.size());
+            break;
+        case Id_Constructor_GenomeGeneration:
+            writeInt(output, constructor.genomeGeneration);
+            break;
+        case Id_Constructor_ConstructionAngle1:
+            writeFloat(output, constructor.constructionAngle1);
+            break;
+        case Id_Constructor_ConstructionAngle2:
+            writeFloat(output, constructor.constructionAngle2);
+            break;
+        case Id_Constructor_GenomeReadPosition:
+            writeInt(output, constructor.genomeReadPosition);
+            break;
+        case Id_Constructor_OffspringCreatureId:
+            writeInt(output, constructor.offspringCreatureId);
+            break;
+        case Id_Constructor_OffspringMutationId:
+            writeInt(output, constructor.offspringMutationId);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, ConstructorDescription& constructor, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Constructor_ActivationMode:
+            constructor.activationMode = reader.readInt();
+            break;
+        case Id_Constructor_ConstructionActivationTime:
+            constructor.constructionActivationTime = reader.readInt();
+            break;
+        case Id_Constructor_Genome:
+            constructor.genome = reader.readGenome();
+            break;
+        case Id_Constructor_GenomeGeneration:
+            constructor.genomeGeneration = reader.readInt();
+            break;
+        case Id_Constructor_ConstructionAngle1:
+            constructor.constructionAngle1 = reader.readFloat();
+            break;
+        case Id_Constructor_ConstructionAngle2:
+            constructor.constructionAngle2 = reader.readFloat();
+            break;
+        case Id_Constructor_GenomeReadPosition:
+            constructor.genomeReadPosition = reader.readInt();
+            break;
+        case Id_Constructor_OffspringCreatureId:
+            constructor.offspringCreatureId = reader.readInt();
+            break;
+        case Id_Constructor_OffspringMutationId:
+            constructor.offspringMutationId = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, SensorDescription const& sensor, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Sensor_FixedAngle:
+            writeOptionalFloat(output, sensor.fixedAngle);
+            break;
+        case Id_Sensor_MinDensity:
+            writeFloat(output, sensor.minDensity);
+            break;
+        case Id_Sensor_Color:
+            writeInt(output, sensor.color);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, SensorDescription& sensor, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Sensor_FixedAngle:
+            sensor.fixedAngle = reader.readOptionalFloat();
+            break;
+        case Id_Sensor_MinDensity:
+            sensor.minDensity = reader.readFloat();
+            break;
+        case Id_Sensor_Color:
+            sensor.color = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, NerveDescription const& nerve, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Nerve_PulseMode:
+            writeInt(output, nerve.pulseMode);
+            break;
+        case Id_Nerve_AlternationMode:
+            writeInt(output, nerve.alternationMode);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, NerveDescription& nerve, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Nerve_PulseMode:
+            nerve.pulseMode = reader.readInt();
+            break;
+        case Id_Nerve_AlternationMode:
+            nerve.alternationMode = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, AttackerDescription const& attacker, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Attacker_Mode:
+            writeInt(output, attacker.mode);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, AttackerDescription& attacker, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Attacker_Mode:
+            attacker.mode = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, InjectorDescription const& injector, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Injector_Mode:
+            writeInt(output, injector.mode);
+            break;
+        case Id_Injector_Counter:
+            writeInt(output, injector.counter);
+            break;
+        case Id_Injector_Genome:
+            writeBytes(output, injector.genome.data(), injector.genome.size());
+            break;
+        case Id_Injector_GenomeGeneration:
+            writeInt(output, injector.genomeGeneration);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, InjectorDescription& injector, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Injector_Mode:
+            injector.mode = reader.readInt();
+            break;
+        case Id_Injector_Counter:
+            injector.counter = reader.readInt();
+            break;
+        case Id_Injector_Genome:
+            injector.genome = reader.readGenome();
+            break;
+        case Id_Injector_GenomeGeneration:
+            injector.genomeGeneration = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, MuscleDescription const& muscle, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Muscle_Mode:
+            writeInt(output, muscle.mode);
+            break;
+        case Id_Muscle_LastBendingDirection:
+            writeInt(output, muscle.lastBendingDirection);
+            break;
+        case Id_Muscle_LastBendingSourceIndex:
+            writeInt(output, muscle.lastBendingSourceIndex);
+            break;
+        case Id_Muscle_ConsecutiveBendingAngle:
+            writeFloat(output, muscle.consecutiveBendingAngle);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, MuscleDescription& muscle, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Muscle_Mode:
+            muscle.mode = reader.readInt();
+            break;
+        case Id_Muscle_LastBendingDirection:
+            muscle.lastBendingDirection = reader.readInt();
+            break;
+        case Id_Muscle_LastBendingSourceIndex:
+            muscle.lastBendingSourceIndex = reader.readInt();
+            break;
+        case Id_Muscle_ConsecutiveBendingAngle:
+            muscle.consecutiveBendingAngle = reader.readFloat();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, DefenderDescription const& defender, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Defender_Mode:
+            writeInt(output, defender.mode);
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, DefenderDescription& defender, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Defender_Mode:
+            defender.mode = reader.readInt();
+            break;
+        }
+    }
+
+    template <>
+    void encodeField(std::string& output, PlaceHolderDescription const& placeHolder, int fieldId)
+    {}
+
+    template <>
+    void decodeField(ByteReader& reader, PlaceHolderDescription& placeHolder, int fieldId, DecodingContext const& context)
+    {}
+
+    template <typename CellFunctionDesc>
+    void decodeCellFunction(ByteReader& reader, CellDescription& cell, CellFunction cellFunction, DecodingContext const& context)
+    {
+        CellFunctionDesc cellFunctionDesc;
+        decodeObject(reader, cellFunctionDesc, getSchemaObjectType(cellFunction), context);
+        cell.cellFunction = std::move(cellFunctionDesc);
+    }
+
+    //cell
+    template <>
+    void encodeField(std::string& output, CellDescription const& cell, int fieldId)
+    {
+        switch (fieldId) {
+        case Id_Cell_Id:
+            writeUInt64(output, cell.id);
+            break;
+        case Id_Cell_Connections: {
+            writeUInt32(output, toInt(cell.connections.size()));
+            for (auto const& connection : cell.connections) {
+                writeUInt64(output, connection.cellId);
+                writeFloat(output, connection.distance);
+                writeFloat(output, connection.angleFromPrevious);
+            }
+        } break;
+        case Id_Cell_Pos:
+            writeVector2D(output, cell.pos);
+            break;
+        case Id_Cell_Vel:
+            writeVector2D(output, cell.vel);
+            break;
+        case Id_Cell_Energy:
+            writeFloat(output, cell.energy);
+            break;
+        case Id_Cell_Stiffness:
+            writeFloat(output, cell.stiffness);
+            break;
+        case Id_Cell_Color:
+            writeInt(output, cell.color);
+            break;
+        case Id_Cell_MaxConnections:
+            writeInt(output, cell.maxConnections);
+            break;
+        case Id_Cell_Barrier:
+            writeBool(output, cell.barrier);
+            break;
+        case Id_Cell_Age:
+            writeInt(output, cell.age);
+            break;
+        case Id_Cell_LivingState:
+            writeInt(output, cell.livingState);
+            break;
+        case Id_Cell_CreatureId:
+            writeInt(output, cell.creatureId);
+            break;
+        case Id_Cell_MutationId:
+            writeInt(output, cell.mutationId);
+            break;
+        case Id_Cell_ExecutionOrderNumber:
+            writeInt(output, cell.executionOrderNumber);
+            break;
+        case Id_Cell_InputExecutionOrderNumber:
+            writeOptionalInt(output, cell.inputExecutionOrderNumber);
+            break;
+        case Id_Cell_OutputBlocked:
+            writeBool(output, cell.outputBlocked);
+            break;
+        case Id_Cell_CellFunction: {
+            auto cellFunction = cell.getCellFunctionType();
+            writeByte(output, static_cast<uint8_t>(cellFunction));
+            if (cell.cellFunction.has_value()) {
+                std::visit(
+                    [&](auto const& cellFunctionDesc) { encodeObject(output, cellFunctionDesc, getSchemaObjectType(cellFunction)); }, *cell.cellFunction);
+            }
+        } break;
+        case Id_Cell_Activity:
+            writeFloatArray(output, cell.activity.channels.data(), MAX_CHANNELS);
+            break;
+        case Id_Cell_ActivationTime:
+            writeInt(output, cell.activationTime);
+            break;
+        case Id_Cell_MetadataName:
+            writeBytes(output, cell.metadata.name.data(), cell.metadata.name.size());
+            break;
+        case Id_Cell_MetadataDescription:
+            writeBytes(output, cell.metadata.description.data(), cell.metadata.description.size());
+            break;
+        }
+    }
+
+    template <>
+    void decodeField(ByteReader& reader, CellDescription& cell, int fieldId, DecodingContext const& context)
+    {
+        switch (fieldId) {
+        case Id_Cell_Id:
+            cell.id = reader.readUInt64();
+            break;
+        case Id_Cell_Connections: {
+            auto numConnections = reader.readUInt32();
+            reader.checkCount(numConnections, 16);
+            cell.connections.resize(numConnections);
+            for (auto& connection : cell.connections) {
+                connection.cellId = reader.readUInt64();
+                connection.distance = reader.readFloat();
+                connection.angleFromPrevious = reader.readFloat();
+            }
+        } break;
+        case Id_Cell_Pos:
+            cell.pos = reader.readVector2D();
+            break;
+        case Id_Cell_Vel:
+            cell.vel = reader.readVector2D();
+            break;
+        case Id_Cell_Energy:
+            cell.energy = reader.readFloat();
+            break;
+        case Id_Cell_Stiffness:
+            cell.stiffness = reader.readFloat();
+            break;
+        case Id_Cell_Color:
+            cell.color = reader.readInt();
+            break;
+        case Id_Cell_MaxConnections:
+            cell.maxConnections = reader.readInt();
+            break;
+        case Id_Cell_Barrier:
+            cell.barrier = reader.readBool();
+            break;
+        case Id_Cell_Age:
+            cell.age = reader.readInt();
+            break;
+        case Id_Cell_LivingState:
+            cell.livingState = reader.readInt();
+            break;
+        case Id_Cell_CreatureId:
+            cell.creatureId = reader.readInt();
+            break;
+        case Id_Cell_MutationId:
+            cell.mutationId = reader.readInt();
+            break;
+        case Id_Cell_ExecutionOrderNumber:
+            cell.executionOrderNumber = reader.readInt();
+            break;
+        case Id_Cell_InputExecutionOrderNumber:
+            cell.inputExecutionOrderNumber = reader.readOptionalInt();
+            break;
+        case Id_Cell_OutputBlocked:
+            cell.outputBlocked = reader.readBool();
+            break;
+        case Id_Cell_CellFunction: {
+            CellFunction cellFunction = reader.readByte();
+            switch (cellFunction) {
+            case CellFunction_Neuron:
+                decodeCellFunction<NeuronDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Transmitter:
+                decodeCellFunction<TransmitterDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Constructor:
+                decodeCellFunction<ConstructorDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Sensor:
+                decodeCellFunction<SensorDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Nerve:
+                decodeCellFunction<NerveDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Attacker:
+                decodeCellFunction<AttackerDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Injector:
+                decodeCellFunction<InjectorDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Muscle:
+                decodeCellFunction<MuscleDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Defender:
+                decodeCellFunction<DefenderDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_Placeholder:
+                decodeCellFunction<PlaceHolderDescription>(reader, cell, cellFunction, context);
+                break;
+            case CellFunction_None:
+                cell.cellFunction.reset();
+                break;
+            default:
+                skipObject(reader, getSchemaObjectType(cellFunction), context);
+                break;
+            }
+        } break;
+        case Id_Cell_Activity:
+            reader.readFloatArray(cell.activity.channels.data(), MAX_CHANNELS);
+            break;
+        case Id_Cell_ActivationTime:
+            cell.activationTime = reader.readInt();
+            break;
+        case Id_Cell_MetadataName:
+            reader.readBytes(cell.metadata.name);
+            break;
+        case Id_Cell_MetadataDescription:
+            reader.readBytes(cell.metadata.description);
+            break;
+        }
+    }
+}
+
+Schema const& SchemaSerializer::getSchema()
+{
+    static Schema const schema = createSchema();
+    return schema;
+}
+
+void SchemaSerializer::serializeSchema(std::string& output, Schema const& schema)
+{
+    writeUInt32(output, toInt(schema.size()));
+    for (auto const& fields : schema) {
+        writeUInt32(output, toInt(fields.size()));
+        for (auto const& field : fields) {
+            writeUInt32(output, field.id);
+            writeByte(output, static_cast<uint8_t>(field.type));
+        }
+    }
+}
+
+Schema SchemaSerializer::deserializeSchema(std::string const& input)
+{
+    ByteReader reader(input);
+    auto numObjectTypes = reader.readUInt32();
+    reader.checkCount(numObjectTypes, 4);
+    Schema result(numObjectTypes);
+    for (auto& fields : result) {
+        auto numFields = reader.readUInt32();
+        reader.checkCount(numFields, 5);
+        fields.resize(numFields);
+        for (auto& field : fields) {
+            field.id = reader.readInt();
+            field.type = reader.readByte();
+        }
+    }
+    return result;
+}
+
+void SchemaSerializer::serializeClusters(std::string& output, std::vector<ClusterDescription> const& clusters, std::span<uint64_t const> indices)
+{
+    writeUInt64(output, indices.size());
+    for (auto const& index : indices) {
+        auto const& cells = clusters[index].cells;
+        writeUInt32(output, toInt(cells.size()));
+        for (auto const& cell : cells) {
+            encodeObject(output, cell, SchemaObjectType_Cell);
+        }
+    }
+}
+
+void SchemaSerializer::serializeParticles(std::string& output, std::vector<ParticleDescription> const& particles, std::span<uint64_t const> indices)
+{
+    writeUInt64(output, indices.size());
+    for (auto const& index : indices) {
+        encodeObject(output, particles[index], SchemaObjectType_Particle);
+    }
+}
+
+std::vector<ClusterDescription> SchemaSerializer::deserializeClusters(std::string_view input, Schema const& schema)
+{
+    DecodingContext context(schema);
+    ByteReader reader(input);
+
+    auto numClusters = reader.readUInt64();
+    reader.checkCount(numClusters, 4);
+    std::vector<ClusterDescription> result(numClusters);
+    auto minCellSize = getMinObjectSize(SchemaObjectType_Cell, context);
+    for (auto& cluster : result) {
+        auto numCells = reader.readUInt32();
+        reader.checkCount(numCells, minCellSize);
+        cluster.cells.resize(numCells);
+        for (auto& cell : cluster.cells) {
+            decodeObject(reader, cell, SchemaObjectType_Cell, context);
+        }
+    }
+    return result;
+}
+
+std::vector<ParticleDescription> SchemaSerializer::deserializeParticles(std::string_view input, Schema const& schema)
+{
+    DecodingContext context(schema);
+    ByteReader reader(input);
+
+    auto numParticles = reader.readUInt64();
+    reader.checkCount(numParticles, getMinObjectSize(SchemaObjectType_Particle, context));
+    std::vector<ParticleDescription> result(numParticles);
+    for (auto& particle : result) {
+        decodeObject(reader, particle, SchemaObjectType_Particle, context);
+    }
+    return result;
+}
+
+int SchemaSerializer::getNumCellFields()
+{
+    return toInt(getSchema()[SchemaObjectType_Cell].size());
+}
+
+void SchemaSerializer::serializeCellField(std::string& output, CellDescription const& cell, int fieldIndex)
+{
+    encodeField(output, cell, getSchema()[SchemaObjectType_Cell].at(fieldIndex).id);
+}
+
+size_t SchemaSerializer::deserializeCellField(std::string_view input, CellDescription& cell, int fieldIndex)
+{
+    static DecodingContext const context(getSchema());
+    ByteReader reader(input);
+    decodeField(reader, cell, getSchema()[SchemaObjectType_Cell].at(fieldIndex).id, context);
+    return reader.getPosition();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+#include "Base/Definitions.h"
+#include "Descriptions.h"
+
+using SchemaObjectType = int;
+enum SchemaObjectType_
+{
+    SchemaObjectType_Particle,
+    SchemaObjectType_Cell,
+    SchemaObjectType_Neuron,
+    SchemaObjectType_Transmitter,
+    SchemaObjectType_Constructor,
+    SchemaObjectType_Sensor,
+    SchemaObjectType_Nerve,
+    SchemaObjectType_Attacker,
+    SchemaObjectType_Injector,
+    SchemaObjectType_Muscle,
+    SchemaObjectType_Defender,
+    SchemaObjectType_Placeholder,
+    SchemaObjectType_Count
+};
+
+using SchemaFieldType = int;
+enum SchemaFieldType_
+{
+    SchemaFieldType_Bool,
+    SchemaFieldType_Int,
+    SchemaFieldType_Float,
+    SchemaFieldType_UInt64,
+    SchemaFieldType_Vector2D,
+    SchemaFieldType_OptionalInt,
+    SchemaFieldType_OptionalFloat,
+    SchemaFieldType_FloatArray,
+    SchemaFieldType_Bytes,
+    SchemaFieldType_Connections,
+    SchemaFieldType_CellFunction,
+    SchemaFieldType_Count
+};
+
+struct SchemaField
+{
+    int id = 0;
+    SchemaFieldType type = SchemaFieldType_Int;
+};
+
+//field table indexed by SchemaObjectType
+using Schema = std::vector<std::vector<SchemaField>>;
+
+/**
+ * Encodes descriptions as dense records whose layout is given by a schema.
+ * The schema is stored once per file. Fields which are unknown to the reader are skipped and
+ * fields which are missing in the file keep their default values.
+ */
+class SchemaSerializer
+{
+public:
+    static Schema const& getSchema();
+
+    static void serializeSchema(std::string& output, Schema const& schema);
+    static Schema deserializeSchema(std::string const& input);
+
+    //serializes the entries referenced by indices in the given order
+    static void serializeClusters(std::string& output, std::vector<ClusterDescription> const& clusters, std::span<uint64_t const> indices);
+    static void serializeParticles(std::string& output, std::vector<ParticleDescription> const& particles, std::span<uint64_t const> indices);
+
+    static std::vector<ClusterDescription> deserializeClusters(std::string_view input, Schema const& schema);
+    static std::vector<ParticleDescription> deserializeParticles(std::string_view input, Schema const& schema);
+
+    //single fields of cell records in the current schema, e.g. for field-wise deltas
+    static int getNumCellFields();
+    static void serializeCellField(std::string& output, CellDescription const& cell, int fieldIndex);
+    static size_t deserializeCellField(std::string_view input, CellDescription& cell, int fieldIndex);  //returns the number of bytes read
+};
@@ -1,8 +1,14 @@
 #include "Serializer.h"
 
+#include <bit>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <filesystem>
+#include <fstream>
 
 #include <optional>
 #include <cereal/archives/portable_binary.hpp>
@@ -16,15 +22,19 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/range/adaptors.hpp>
+#include <zlib.h>
 #include <zstr.hpp>
 
 #include "Base/Resources.h"
+#include "Colors.h"
+#include "Base/ThreadPool.h"
 #include "Descriptions.h"
 #include "SimulationParameters.h"
 #include "AuxiliaryDataParser.h"
 #include "GenomeConstants.h"
 #include "GenomeDescriptions.h"
 #include "GenomeDescriptionConverter.h"
+#include "SchemaSerializer.h"
 #include "Gui/VersionChecker.h"
 
 #define SPLIT_SERIALIZATION(Classname) \
@@ -176,6 +186,46 @@ namespace cereal
         }
     }
 
+    //fixed-size and fixed-capacity containers are stored like std::vector for compatibility with files of previous versions
+    template <class Archive, typename T, size_t N>
+    void save(Archive& ar, std::array<T, N> const& data)
+    {
+        ar(make_size_tag(static_cast<size_type>(N)));
+        for (auto const& element : data) {
+            ar(element);
+        }
+    }
+    template <class Archive, typename T, size_t N>
+    void load(Archive& ar, std::array<T, N>& data)
+    {
+        size_type size;
+        ar(make_size_tag(size));
+        if (size != N) {
+            throw std::runtime_error("Unexpected array size.");
+        }
+        for (auto& element : data) {
+            ar(element);
+        }
+    }
+    template <class Archive, typename T, size_t N>
+    void save(Archive& ar, FixedCapacityVector<T, N> const& data)
+    {
+        ar(make_size_tag(static_cast<size_type>(data.size())));
+        for (auto const& element : data) {
+            ar(element);
+        }
+    }
+    template <class Archive, typename T, size_t N>
+    void load(Archive& ar, FixedCapacityVector<T, N>& data)
+    {
+        size_type size;
+        ar(make_size_tag(size));
+        data.resize(size);
+        for (auto& element : data) {
+            ar(element);
+        }
+    }
+
     template <class Archive>
     void serialize(Archive& ar, IntVector2D& data)
     {
@@ -652,6 +702,560 @@ namespace cereal
     }
 }
 
+namespace
+{
+    //layout of chunked files:
+    //  header | summary | schema | chunk 0 | ... | chunk n-1 | chunk table | tile index
+    //the summary has a fixed size and is stored uncompressed (see Serializer::peekSimulationSummary)
+    //each chunk contains a zlib-compressed group of clusters or particles of the same tile of the world: the original indices
+    //of its entries followed by dense records described by the schema (see SchemaSerializer)
+    //the chunk table contains the bounds of each chunk and is followed by the tile index
+    char const ChunkedFileMagic[8] = {'A', 'L', 'I', 'E', 'N', 'C', 'H', 'K'};
+    uint32_t constexpr ChunkedFileFormatVersion = 1;
+    auto constexpr ChunkedFileProgramVersionSize = 32;
+    auto constexpr ChunkedFileTableOffsetPos = sizeof(ChunkedFileMagic) + sizeof(uint32_t) + ChunkedFileProgramVersionSize;
+    auto constexpr ChunkedFileSummaryPos = ChunkedFileTableOffsetPos + sizeof(uint64_t);
+    auto constexpr ThumbnailSize = 64;
+
+    auto constexpr ChunkTargetNumCells = 50000;
+    auto constexpr ChunkTargetNumParticles = 200000;
+    auto constexpr TileGridSize = 16;  //number of tiles per axis
+
+    using ChunkType = int;
+    enum ChunkType_
+    {
+        ChunkType_Clusters,
+        ChunkType_Particles
+    };
+
+    //range in ChunkLayout::clusterOrder or ChunkLayout::particleOrder
+    struct ChunkRange
+    {
+        ChunkType type = ChunkType_Clusters;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+    };
+
+    struct ChunkInfo
+    {
+        ChunkType type = ChunkType_Clusters;
+        uint64_t numEntries = 0;
+        uint64_t offset = 0;
+        uint64_t compressedSize = 0;
+        uint64_t uncompressedSize = 0;
+        RealRect bounds;   //bounds of all contained cells or particles
+    };
+
+    struct TileGrid
+    {
+        RealVector2D tileSize{1.0f, 1.0f};
+
+        TileGrid() = default;
+        TileGrid(IntVector2D const& worldSize)
+            : tileSize{std::max(1.0f, toFloat(worldSize.x) / TileGridSize), std::max(1.0f, toFloat(worldSize.y) / TileGridSize)}
+        {}
+
+        int getTile(RealVector2D const& pos) const
+        {
+            auto x = std::clamp(toInt(std::floor(pos.x / tileSize.x)), 0, TileGridSize - 1);
+            auto y = std::clamp(toInt(std::floor(pos.y / tileSize.y)), 0, TileGridSize - 1);
+            return x + y * TileGridSize;
+        }
+
+        std::vector<int> getTiles(RealRect const& rect) const
+        {
+            std::vector<int> result;
+            auto topLeft = getTile(rect.topLeft);
+            auto bottomRight = getTile(rect.bottomRight);
+            for (int y = topLeft / TileGridSize; y <= bottomRight / TileGridSize; ++y) {
+                for (int x = topLeft % TileGridSize; x <= bottomRight % TileGridSize; ++x) {
+                    result.emplace_back(x + y * TileGridSize);
+                }
+            }
+            return result;
+        }
+    };
+
+    struct ChunkLayout
+    {
+        std::vector<uint64_t> clusterOrder;
+        std::vector<uint64_t> particleOrder;
+        std::vector<ChunkRange> ranges;
+
+        std::span<uint64_t const> getIndices(ChunkRange const& range) const
+        {
+            auto const& order = range.type == ChunkType_Clusters ? clusterOrder : particleOrder;
+            return std::span<uint64_t const>(order).subspan(range.begin, range.end - range.begin);
+        }
+    };
+
+    //chunk indices for each tile
+    using TileIndex = std::vector<std::vector<uint32_t>>;
+
+    struct ChunkedFileDirectory
+    {
+        Schema schema;
+        std::vector<ChunkInfo> chunkInfos;
+        uint64_t numClusters = 0;
+        uint64_t numParticles = 0;
+        TileGrid tileGrid;
+        TileIndex tileIndex;
+    };
+
+    struct DecodedChunk
+    {
+        std::vector<uint64_t> indices;
+        std::vector<ClusterDescription> clusters;
+        std::vector<ParticleDescription> particles;
+    };
+
+    template <typename T>
+    void writeValue(std::ostream& stream, T value)
+    {
+        uint8_t bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = static_cast<uint8_t>((static_cast<uint64_t>(value) >> (i * 8)) & 0xff);
+        }
+        stream.write(reinterpret_cast<char const*>(bytes), sizeof(T));
+    }
+
+    template <typename T>
+    T readValue(std::istream& stream)
+    {
+        uint8_t bytes[sizeof(T)];
+        stream.read(reinterpret_cast<char*>(bytes), sizeof(T));
+        if (!stream) {
+            throw std::runtime_error("Unexpected end of file.");
+        }
+        uint64_t result = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            result |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+        }
+        return static_cast<T>(result);
+    }
+
+    void writeRect(std::ostream& stream, RealRect const& rect)
+    {
+        for (auto value : {rect.topLeft.x, rect.topLeft.y, rect.bottomRight.x, rect.bottomRight.y}) {
+            writeValue<uint32_t>(stream, std::bit_cast<uint32_t>(value));
+        }
+    }
+
+    RealRect readRect(std::istream& stream)
+    {
+        RealRect result;
+        for (auto value : {&result.topLeft.x, &result.topLeft.y, &result.bottomRight.x, &result.bottomRight.y}) {
+            *value = std::bit_cast<float>(readValue<uint32_t>(stream));
+        }
+        return result;
+    }
+
+    void appendUInt64(std::string& output, uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i) {
+            output.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+        }
+    }
+
+    uint64_t extractUInt64(std::string const& input, uint64_t pos)
+    {
+        if (pos + 8 > input.size()) {
+            throw std::runtime_error("Unexpected end of chunk.");
+        }
+        uint64_t result = 0;
+        for (int i = 0; i < 8; ++i) {
+            result |= static_cast<uint64_t>(static_cast<uint8_t>(input[pos + i])) << (i * 8);
+        }
+        return result;
+    }
+
+    bool isInside(RealRect const& rect, RealVector2D const& pos)
+    {
+        return pos.x >= rect.topLeft.x && pos.x <= rect.bottomRight.x && pos.y >= rect.topLeft.y && pos.y <= rect.bottomRight.y;
+    }
+
+    bool isOverlapping(RealRect const& rect1, RealRect const& rect2)
+    {
+        return rect1.topLeft.x <= rect2.bottomRight.x && rect2.topLeft.x <= rect1.bottomRight.x && rect1.topLeft.y <= rect2.bottomRight.y
+            && rect2.topLeft.y <= rect1.bottomRight.y;
+    }
+
+    void extendRect(RealRect& rect, RealVector2D const& pos)
+    {
+        rect.topLeft = {std::min(rect.topLeft.x, pos.x), std::min(rect.topLeft.y, pos.y)};
+        rect.bottomRight = {std::max(rect.bottomRight.x, pos.x), std::max(rect.bottomRight.y, pos.y)};
+    }
+
+    RealRect getEmptyRect()
+    {
+        auto max = std::numeric_limits<float>::max();
+        return {{max, max}, {-max, -max}};
+    }
+
+    //stable counting sort of the entries by their tiles
+    std::vector<uint64_t> sortByTile(std::vector<int> const& tiles)
+    {
+        std::vector<uint64_t> tileOffsets(TileGridSize * TileGridSize + 1, 0);
+        for (auto const& tile : tiles) {
+            ++tileOffsets[tile + 1];
+        }
+        for (size_t i = 1; i < tileOffsets.size(); ++i) {
+            tileOffsets[i] += tileOffsets[i - 1];
+        }
+        std::vector<uint64_t> result(tiles.size());
+        for (uint64_t i = 0; i < tiles.size(); ++i) {
+            result[tileOffsets[tiles[i]]++] = i;
+        }
+        return result;
+    }
+
+    //chunks are cut when the target size is reached or a new tile begins
+    template <typename GetSizeFunc>
+    void appendChunkRanges(
+        std::vector<ChunkRange>& result,
+        ChunkType type,
+        std::vector<uint64_t> const& order,
+        std::vector<int> const& tiles,
+        int targetSize,
+        GetSizeFunc const& getSize)
+    {
+        ChunkRange range{type, 0, 0};
+        int size = 0;
+        for (uint64_t i = 0; i < order.size(); ++i) {
+            if (range.begin != range.end && (size >= targetSize || tiles[order[i]] != tiles[order[i - 1]])) {
+                result.emplace_back(range);
+                range.begin = range.end;
+                size = 0;
+            }
+            size += getSize(order[i]);
+            ++range.end;
+        }
+        if (range.begin != range.end) {
+            result.emplace_back(range);
+        }
+    }
+
+    ChunkLayout partitionIntoChunks(ClusteredDataDescription const& data, TileGrid const& tileGrid)
+    {
+        ChunkLayout result;
+
+        std::vector<int> clusterTiles(data.clusters.size());
+        ThreadPool::getInstance().parallelFor(toInt(data.clusters.size()), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                auto const& cells = data.clusters[i].cells;
+                clusterTiles[i] = cells.empty() ? 0 : tileGrid.getTile(data.clusters[i].getClusterPosFromCells());
+            }
+        });
+        result.clusterOrder = sortByTile(clusterTiles);
+        appendChunkRanges(result.ranges, ChunkType_Clusters, result.clusterOrder, clusterTiles, ChunkTargetNumCells, [&](uint64_t index) {
+            return toInt(data.clusters[index].cells.size());
+        });
+
+        std::vector<int> particleTiles(data.particles.size());
+        ThreadPool::getInstance().parallelFor(toInt(data.particles.size()), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                particleTiles[i] = tileGrid.getTile(data.particles[i].pos);
+            }
+        });
+        result.particleOrder = sortByTile(particleTiles);
+        appendChunkRanges(result.ranges, ChunkType_Particles, result.particleOrder, particleTiles, ChunkTargetNumParticles, [](uint64_t) { return 1; });
+
+        return result;
+    }
+
+    RealRect calcChunkBounds(ClusteredDataDescription const& data, ChunkLayout const& layout, ChunkRange const& range)
+    {
+        auto result = getEmptyRect();
+        for (auto const& index : layout.getIndices(range)) {
+            if (range.type == ChunkType_Clusters) {
+                for (auto const& cell : data.clusters[index].cells) {
+                    extendRect(result, cell.pos);
+                }
+            } else {
+                extendRect(result, data.particles[index].pos);
+            }
+        }
+        return result;
+    }
+
+    std::string serializeChunk(ClusteredDataDescription const& data, ChunkLayout const& layout, ChunkRange const& range)
+    {
+        auto indices = layout.getIndices(range);
+        std::string result;
+        appendUInt64(result, indices.size());
+        for (auto const& index : indices) {
+            appendUInt64(result, index);
+        }
+        if (range.type == ChunkType_Clusters) {
+            SchemaSerializer::serializeClusters(result, data.clusters, indices);
+        } else {
+            SchemaSerializer::serializeParticles(result, data.particles, indices);
+        }
+        return result;
+    }
+
+    DecodedChunk deserializeChunk(std::string const& chunkData, ChunkInfo const& chunkInfo, ChunkedFileDirectory const& directory)
+    {
+        DecodedChunk result;
+        std::string_view records = chunkData;
+        result.indices.resize(extractUInt64(chunkData, 0));
+        for (uint64_t i = 0; i < result.indices.size(); ++i) {
+            result.indices[i] = extractUInt64(chunkData, (i + 1) * 8);
+        }
+        records.remove_prefix((result.indices.size() + 1) * 8);
+
+        if (chunkInfo.type == ChunkType_Clusters) {
+            result.clusters = SchemaSerializer::deserializeClusters(records, directory.schema);
+        } else {
+            result.particles = SchemaSerializer::deserializeParticles(records, directory.schema);
+        }
+        if (result.indices.size() != result.clusters.size() + result.particles.size()) {
+            throw std::runtime_error("Invalid chunk.");
+        }
+        return result;
+    }
+
+    std::string compressChunk(std::string const& data)
+    {
+        auto compressedSize = compressBound(static_cast<uLong>(data.size()));
+        std::string result(compressedSize, '\0');
+        auto status = compress2(
+            reinterpret_cast<Bytef*>(result.data()),
+            &compressedSize,
+            reinterpret_cast<Bytef const*>(data.data()),
+            static_cast<uLong>(data.size()),
+            Z_DEFAULT_COMPRESSION);
+        if (status != Z_OK) {
+            throw std::runtime_error("Chunk could not be compressed.");
+        }
+        result.resize(compressedSize);
+        return result;
+    }
+
+    std::string decompressChunk(std::string const& data, uint64_t uncompressedSize)
+    {
+        std::string result(uncompressedSize, '\0');
+        auto size = static_cast<uLongf>(uncompressedSize);
+        auto status = uncompress(reinterpret_cast<Bytef*>(result.data()), &size, reinterpret_cast<Bytef const*>(data.data()), static_cast<uLong>(data.size()));
+        if (status != Z_OK || size != uncompressedSize) {
+            throw std::runtime_error("Chunk could not be decompressed.");
+        }
+        return result;
+    }
+
+    void checkProgramVersion(std::string const& version)
+    {
+        if (!VersionChecker::isVersionValid(version)) {
+            throw std::runtime_error("No version detected.");
+        }
+        if (VersionChecker::isVersionOutdated(version)) {
+            throw std::runtime_error("Version not supported.");
+        }
+    }
+
+    //number of chunks which are held in memory at the same time during reading and writing
+    int getChunkBatchSize()
+    {
+        return ThreadPool::getInstance().getNumThreads() * 2;
+    }
+
+    //summary layout (preceded by its size in bytes):
+    //  world size 2 x u32 | timestep u64 | number of colors u32 | cells per color | particles per color | content hash u32
+    //  | thumbnail width u32 | thumbnail height u32 | RGB thumbnail of ThumbnailSize x ThumbnailSize pixels
+    SimulationSummary calcSummary(DeserializedSimulation const& data)
+    {
+        SimulationSummary result;
+        result.programVersion = Const::ProgramVersion;
+        result.worldSize = {data.auxiliaryData.generalSettings.worldSizeX, data.auxiliaryData.generalSettings.worldSizeY};
+        result.timestep = data.auxiliaryData.timestep;
+
+        result.thumbnailSize = {ThumbnailSize, ThumbnailSize};
+        result.thumbnail.resize(ThumbnailSize * ThumbnailSize * 3, 0);
+        RealVector2D scale{
+            toFloat(ThumbnailSize) / toFloat(std::max(1, result.worldSize.x)), toFloat(ThumbnailSize) / toFloat(std::max(1, result.worldSize.y))};
+        auto plot = [&](RealVector2D const& pos, int color) {
+            auto x = std::clamp(toInt(pos.x * scale.x), 0, ThumbnailSize - 1);
+            auto y = std::clamp(toInt(pos.y * scale.y), 0, ThumbnailSize - 1);
+            auto rgb = Const::IndividualCellColors[color];
+            auto pixel = &result.thumbnail[(x + y * ThumbnailSize) * 3];
+            pixel[0] = static_cast<uint8_t>((rgb >> 16) & 0xff);
+            pixel[1] = static_cast<uint8_t>((rgb >> 8) & 0xff);
+            pixel[2] = static_cast<uint8_t>(rgb & 0xff);
+        };
+        for (auto const& cluster : data.mainData.clusters) {
+            for (auto const& cell : cluster.cells) {
+                auto color = std::clamp(cell.color, 0, MAX_COLORS - 1);
+                ++result.numCellsPerColor[color];
+                plot(cell.pos, color);
+            }
+        }
+        for (auto const& particle : data.mainData.particles) {
+            ++result.numParticlesPerColor[std::clamp(particle.color, 0, MAX_COLORS - 1)];
+        }
+        return result;
+    }
+
+    void writeSummary(std::ostream& stream, SimulationSummary const& summary)
+    {
+        std::stringstream block;
+        writeValue<uint32_t>(block, summary.worldSize.x);
+        writeValue<uint32_t>(block, summary.worldSize.y);
+        writeValue<uint64_t>(block, summary.timestep);
+        writeValue<uint32_t>(block, MAX_COLORS);
+        for (auto const& numCells : summary.numCellsPerColor) {
+            writeValue<uint64_t>(block, numCells);
+        }
+        for (auto const& numParticles : summary.numParticlesPerColor) {
+            writeValue<uint64_t>(block, numParticles);
+        }
+        writeValue<uint32_t>(block, summary.contentHash);
+        writeValue<uint32_t>(block, summary.thumbnailSize.x);
+        writeValue<uint32_t>(block, summary.thumbnailSize.y);
+        std::string thumbnail(reinterpret_cast<char const*>(summary.thumbnail.data()), summary.thumbnail.size());
+        thumbnail.resize(ThumbnailSize * ThumbnailSize * 3, '\0');
+        block.write(thumbnail.data(), thumbnail.size());
+
+        auto blockData = block.str();
+        writeValue<uint64_t>(stream, blockData.size());
+        stream.write(blockData.data(), blockData.size());
+    }
+
+    void readSummary(std::istream& stream, SimulationSummary& summary)
+    {
+        auto blockSize = readValue<uint64_t>(stream);
+        auto blockEnd = static_cast<uint64_t>(stream.tellg()) + blockSize;
+
+        summary.worldSize.x = readValue<uint32_t>(stream);
+        summary.worldSize.y = readValue<uint32_t>(stream);
+        summary.timestep = readValue<uint64_t>(stream);
+        auto numColors = readValue<uint32_t>(stream);
+        for (uint32_t i = 0; i < numColors; ++i) {
+            auto numCells = readValue<uint64_t>(stream);
+            summary.numCellsPerColor[std::min(toInt(i), MAX_COLORS - 1)] += numCells;
+        }
+        for (uint32_t i = 0; i < numColors; ++i) {
+            auto numParticles = readValue<uint64_t>(stream);
+            summary.numParticlesPerColor[std::min(toInt(i), MAX_COLORS - 1)] += numParticles;
+        }
+        summary.contentHash = readValue<uint32_t>(stream);
+        summary.thumbnailSize.x = readValue<uint32_t>(stream);
+        summary.thumbnailSize.y = readValue<uint32_t>(stream);
+        if (summary.thumbnailSize.x < 0 || summary.thumbnailSize.x > ThumbnailSize || summary.thumbnailSize.y < 0 || summary.thumbnailSize.y > ThumbnailSize) {
+            throw std::runtime_error("Invalid thumbnail size.");
+        }
+        summary.thumbnail.resize(summary.thumbnailSize.x * summary.thumbnailSize.y * 3);
+        stream.read(reinterpret_cast<char*>(summary.thumbnail.data()), summary.thumbnail.size());
+
+        stream.seekg(blockEnd);
+        if (!stream) {
+            throw std::runtime_error("Unexpected end of file.");
+        }
+    }
+
+    ChunkedFileDirectory readChunkedFileDirectory(std::istream& stream)
+    {
+        ChunkedFileDirectory result;
+
+        //header
+        char magic[sizeof(ChunkedFileMagic)];
+        stream.read(magic, sizeof(magic));
+        if (readValue<uint32_t>(stream) != ChunkedFileFormatVersion) {
+            throw std::runtime_error("Format version not supported.");
+        }
+        std::string programVersion(ChunkedFileProgramVersionSize, '\0');
+        stream.read(programVersion.data(), ChunkedFileProgramVersionSize);
+        programVersion.resize(programVersion.find('\0') != std::string::npos ? programVersion.find('\0') : programVersion.size());
+        checkProgramVersion(programVersion);
+        auto tableOffset = readValue<uint64_t>(stream);
+
+        //summary
+        stream.seekg(readValue<uint64_t>(stream), std::ios::cur);
+
+        //schema
+        std::string schemaData(readValue<uint64_t>(stream), '\0');
+        stream.read(schemaData.data(), schemaData.size());
+        if (!stream) {
+            throw std::runtime_error("Unexpected end of file.");
+        }
+        result.schema = SchemaSerializer::deserializeSchema(schemaData);
+
+        //chunk table
+        stream.seekg(tableOffset);
+        result.chunkInfos.resize(readValue<uint64_t>(stream));
+        for (auto& chunkInfo : result.chunkInfos) {
+            chunkInfo.type = readValue<uint8_t>(stream);
+            chunkInfo.numEntries = readValue<uint64_t>(stream);
+            chunkInfo.offset = readValue<uint64_t>(stream);
+            chunkInfo.compressedSize = readValue<uint64_t>(stream);
+            chunkInfo.uncompressedSize = readValue<uint64_t>(stream);
+            chunkInfo.bounds = readRect(stream);
+            auto& numEntries = chunkInfo.type == ChunkType_Clusters ? result.numClusters : result.numParticles;
+            numEntries += chunkInfo.numEntries;
+        }
+
+        //tile index
+        result.tileGrid.tileSize.x = std::bit_cast<float>(readValue<uint32_t>(stream));
+        result.tileGrid.tileSize.y = std::bit_cast<float>(readValue<uint32_t>(stream));
+        result.tileIndex.resize(TileGridSize * TileGridSize);
+        for (auto& chunkIndices : result.tileIndex) {
+            chunkIndices.resize(readValue<uint32_t>(stream));
+            for (auto& chunkIndex : chunkIndices) {
+                chunkIndex = readValue<uint32_t>(stream);
+                if (chunkIndex >= result.chunkInfos.size()) {
+                    throw std::runtime_error("Invalid tile index.");
+                }
+            }
+        }
+        return result;
+    }
+
+    //chunks are read in batches and decompressed in parallel, func is called for each chunk in the given order
+    void readChunks(
+        std::istream& stream,
+        ChunkedFileDirectory const& directory,
+        std::vector<uint32_t> const& chunkIndices,
+        std::function<void(DecodedChunk&&)> const& func)
+    {
+        auto batchSize = getChunkBatchSize();
+        for (size_t batchBegin = 0; batchBegin < chunkIndices.size(); batchBegin += batchSize) {
+            auto batchEnd = std::min(batchBegin + batchSize, chunkIndices.size());
+
+            std::vector<std::string> compressedChunks(batchEnd - batchBegin);
+            for (size_t i = 0; i < compressedChunks.size(); ++i) {
+                auto const& chunkInfo = directory.chunkInfos.at(chunkIndices.at(batchBegin + i));
+                compressedChunks.at(i).resize(chunkInfo.compressedSize);
+                stream.seekg(chunkInfo.offset);
+                stream.read(compressedChunks.at(i).data(), chunkInfo.compressedSize);
+                if (!stream) {
+                    throw std::runtime_error("Unexpected end of file.");
+                }
+            }
+
+            std::vector<DecodedChunk> decodedChunks(compressedChunks.size());
+            ThreadPool::getInstance().parallelFor(toInt(compressedChunks.size()), [&](int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    auto const& chunkInfo = directory.chunkInfos.at(chunkIndices.at(batchBegin + i));
+                    auto chunkData = decompressChunk(compressedChunks.at(i), chunkInfo.uncompressedSize);
+                    compressedChunks.at(i).clear();
+                    decodedChunks.at(i) = deserializeChunk(chunkData, chunkInfo, directory);
+                }
+            });
+
+            for (auto& decodedChunk : decodedChunks) {
+                func(std::move(decodedChunk));
+            }
+        }
+    }
+
+    void filterRegion(ClusteredDataDescription& data, RealRect const& region)
+    {
+        std::erase_if(data.clusters, [&](ClusterDescription const& cluster) {
+            return std::none_of(cluster.cells.begin(), cluster.cells.end(), [&](CellDescription const& cell) { return isInside(region, cell.pos); });
+        });
+        std::erase_if(data.particles, [&](ParticleDescription const& particle) { return !isInside(region, particle.pos); });
+    }
+}
+
 bool Serializer::serializeSimulationToFiles(std::string const& filename, DeserializedSimulation const& data)
 {
     try {
@@ -659,12 +1263,8 @@ bool Serializer::serializeSimulationToFiles(std::string const& filename, Deseria
         std::filesystem::path settingsFilename(filename);
         settingsFilename.replace_extension(std::filesystem::path(".settings.json"));
 
-        {
-            zstr::ofstream stream(filename, std::ios::binary);
-            if (!stream) {
-                return false;
-            }
-            serializeDataDescription(data.mainData, stream);
+        if (!serializeDataDescriptionToChunkedFile(data, filename)) {
+            return false;
         }
         {
             std::ofstream stream(settingsFilename.string(), std::ios::binary);
@@ -703,6 +1303,64 @@ bool Serializer::deserializeSimulationFromFiles(DeserializedSimulation& data, st
     }
 }
 
+bool Serializer::deserializeSimulationRegionFromFiles(DeserializedSimulation& data, std::string const& filename, RealRect const& region)
+{
+    try {
+        std::filesystem::path settingsFilename(filename);
+        settingsFilename.replace_extension(std::filesystem::path(".settings.json"));
+
+        if (isChunkedFile(filename)) {
+            deserializeDataDescriptionRegionFromChunkedFile(data.mainData, filename, region);
+        } else {
+            if (!deserializeDataDescription(data.mainData, filename)) {
+                return false;
+            }
+            filterRegion(data.mainData, region);
+        }
+        {
+            std::ifstream stream(settingsFilename.string(), std::ios::binary);
+            if (!stream) {
+                return false;
+            }
+            deserializeAuxiliaryData(data.auxiliaryData, stream);
+            stream.close();
+        }
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool Serializer::peekSimulationSummary(SimulationSummary& summary, std::string const& filename)
+{
+    try {
+        std::ifstream stream(filename, std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        char magic[sizeof(ChunkedFileMagic)];
+        stream.read(magic, sizeof(magic));
+        if (!stream || !std::equal(std::begin(magic), std::end(magic), std::begin(ChunkedFileMagic))) {
+            return false;
+        }
+        auto formatVersion = readValue<uint32_t>(stream);
+        if (formatVersion != ChunkedFileFormatVersion) {
+            return false;
+        }
+        std::string programVersion(ChunkedFileProgramVersionSize, '\0');
+        stream.read(programVersion.data(), ChunkedFileProgramVersionSize);
+        programVersion.resize(programVersion.find('\0') != std::string::npos ? programVersion.find('\0') : programVersion.size());
+
+        summary = SimulationSummary();
+        summary.programVersion = programVersion;
+        stream.seekg(ChunkedFileSummaryPos);
+        readSummary(stream, summary);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 bool Serializer::serializeSimulationToStrings(SerializedSimulation& output, DeserializedSimulation const& input)
 {
     try {
@@ -860,6 +1518,10 @@ void Serializer::serializeDataDescription(ClusteredDataDescription const& data,
 
 bool Serializer::deserializeDataDescription(ClusteredDataDescription& data, std::string const& filename)
 {
+    if (isChunkedFile(filename)) {
+        deserializeDataDescriptionFromChunkedFile(data, filename);
+        return true;
+    }
     zstr::ifstream stream(filename, std::ios::binary);
     if (!stream) {
         return false;
@@ -873,14 +1535,191 @@ void Serializer::deserializeDataDescription(ClusteredDataDescription& data, std:
     cereal::PortableBinaryInputArchive archive(stream);
     std::string version;
     archive(version);
+    checkProgramVersion(version);
+    archive(data);
+}
+
+bool Serializer::isChunkedFile(std::string const& filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    char magic[sizeof(ChunkedFileMagic)];
+    stream.read(magic, sizeof(magic));
+    return stream && std::equal(std::begin(magic), std::end(magic), std::begin(ChunkedFileMagic));
+}
+
+bool Serializer::serializeDataDescriptionToChunkedFile(DeserializedSimulation const& simulation, std::string const& filename)
+{
+    auto const& data = simulation.mainData;
 
-    if (!VersionChecker::isVersionValid(version)) {
-        throw std::runtime_error("No version detected.");
+    std::ofstream stream(filename, std::ios::binary);
+    if (!stream) {
+        return false;
     }
-    if (VersionChecker::isVersionOutdated(version)) {
-        throw std::runtime_error("Version not supported.");
+
+    //header (the chunk table offset and the content hash in the summary are patched at the end)
+    std::string programVersion = Const::ProgramVersion;
+    programVersion.resize(ChunkedFileProgramVersionSize, '\0');
+    stream.write(ChunkedFileMagic, sizeof(ChunkedFileMagic));
+    writeValue<uint32_t>(stream, ChunkedFileFormatVersion);
+    stream.write(programVersion.data(), ChunkedFileProgramVersionSize);
+    writeValue<uint64_t>(stream, 0);
+
+    //summary
+    auto summary = calcSummary(simulation);
+    writeSummary(stream, summary);
+
+    //schema
+    std::string schema;
+    SchemaSerializer::serializeSchema(schema, SchemaSerializer::getSchema());
+    writeValue<uint64_t>(stream, schema.size());
+    stream.write(schema.data(), schema.size());
+
+    //chunks are serialized and compressed in parallel batches and written in order
+    TileGrid tileGrid(summary.worldSize);
+    auto layout = partitionIntoChunks(data, tileGrid);
+    std::vector<ChunkInfo> chunkInfos;
+    chunkInfos.reserve(layout.ranges.size());
+    auto batchSize = getChunkBatchSize();
+    for (size_t batchBegin = 0; batchBegin < layout.ranges.size(); batchBegin += batchSize) {
+        auto batchEnd = std::min(batchBegin + batchSize, layout.ranges.size());
+
+        std::vector<std::string> compressedChunks(batchEnd - batchBegin);
+        std::vector<uint64_t> uncompressedSizes(batchEnd - batchBegin);
+        std::vector<RealRect> bounds(batchEnd - batchBegin);
+        std::vector<uint32_t> hashes(batchEnd - batchBegin);
+        ThreadPool::getInstance().parallelFor(toInt(batchEnd - batchBegin), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                auto const& range = layout.ranges.at(batchBegin + i);
+                auto uncompressedChunk = serializeChunk(data, layout, range);
+                uncompressedSizes.at(i) = uncompressedChunk.size();
+                hashes.at(i) = static_cast<uint32_t>(crc32(0, reinterpret_cast<Bytef const*>(uncompressedChunk.data()), static_cast<uInt>(uncompressedChunk.size())));
+                compressedChunks.at(i) = compressChunk(uncompressedChunk);
+                bounds.at(i) = calcChunkBounds(data, layout, range);
+            }
+        });
+
+        for (size_t i = 0; i < compressedChunks.size(); ++i) {
+            auto const& range = layout.ranges.at(batchBegin + i);
+            ChunkInfo chunkInfo;
+            chunkInfo.type = range.type;
+            chunkInfo.numEntries = range.end - range.begin;
+            chunkInfo.offset = static_cast<uint64_t>(stream.tellp());
+            chunkInfo.compressedSize = compressedChunks.at(i).size();
+            chunkInfo.uncompressedSize = uncompressedSizes.at(i);
+            chunkInfo.bounds = bounds.at(i);
+            chunkInfos.emplace_back(chunkInfo);
+            summary.contentHash = static_cast<uint32_t>(crc32_combine(summary.contentHash, hashes.at(i), static_cast<z_off_t>(uncompressedSizes.at(i))));
+            stream.write(compressedChunks.at(i).data(), compressedChunks.at(i).size());
+        }
     }
-    archive(data);
+
+    //chunk table
+    auto tableOffset = static_cast<uint64_t>(stream.tellp());
+    writeValue<uint64_t>(stream, chunkInfos.size());
+    for (auto const& chunkInfo : chunkInfos) {
+        writeValue<uint8_t>(stream, chunkInfo.type);
+        writeValue<uint64_t>(stream, chunkInfo.numEntries);
+        writeValue<uint64_t>(stream, chunkInfo.offset);
+        writeValue<uint64_t>(stream, chunkInfo.compressedSize);
+        writeValue<uint64_t>(stream, chunkInfo.uncompressedSize);
+        writeRect(stream, chunkInfo.bounds);
+    }
+
+    //tile index: a chunk is listed in all tiles overlapped by its bounds
+    TileIndex tileIndex(TileGridSize * TileGridSize);
+    for (size_t i = 0; i < chunkInfos.size(); ++i) {
+        if (chunkInfos.at(i).numEntries == 0) {
+            continue;
+        }
+        for (auto const& tile : tileGrid.getTiles(chunkInfos.at(i).bounds)) {
+            tileIndex.at(tile).emplace_back(toInt(i));
+        }
+    }
+    writeValue<uint32_t>(stream, std::bit_cast<uint32_t>(tileGrid.tileSize.x));
+    writeValue<uint32_t>(stream, std::bit_cast<uint32_t>(tileGrid.tileSize.y));
+    for (auto const& chunkIndices : tileIndex) {
+        writeValue<uint32_t>(stream, toInt(chunkIndices.size()));
+        for (auto const& chunkIndex : chunkIndices) {
+            writeValue<uint32_t>(stream, chunkIndex);
+        }
+    }
+
+    stream.seekp(ChunkedFileTableOffsetPos);
+    writeValue<uint64_t>(stream, tableOffset);
+    writeSummary(stream, summary);
+
+    stream.close();
+    return !stream.fail();
+}
+
+void Serializer::deserializeDataDescriptionFromChunkedFile(ClusteredDataDescription& data, std::string const& filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("File could not be opened.");
+    }
+    auto directory = readChunkedFileDirectory(stream);
+
+    //entries are moved to their original positions
+    data.clear();
+    data.clusters.resize(directory.numClusters);
+    data.particles.resize(directory.numParticles);
+    std::vector<uint32_t> chunkIndices(directory.chunkInfos.size());
+    std::iota(chunkIndices.begin(), chunkIndices.end(), 0);
+    readChunks(stream, directory, chunkIndices, [&](DecodedChunk&& chunk) {
+        for (size_t i = 0; i < chunk.clusters.size(); ++i) {
+            data.clusters.at(chunk.indices.at(i)) = std::move(chunk.clusters.at(i));
+        }
+        for (size_t i = 0; i < chunk.particles.size(); ++i) {
+            data.particles.at(chunk.indices.at(i)) = std::move(chunk.particles.at(i));
+        }
+    });
+}
+
+void Serializer::deserializeDataDescriptionRegionFromChunkedFile(ClusteredDataDescription& data, std::string const& filename, RealRect const& region)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("File could not be opened.");
+    }
+    auto directory = readChunkedFileDirectory(stream);
+
+    //only chunks overlapping the region are decoded
+    std::set<uint32_t> chunkIndexSet;
+    for (auto const& tile : directory.tileGrid.getTiles(region)) {
+        for (auto const& chunkIndex : directory.tileIndex.at(tile)) {
+            if (isOverlapping(directory.chunkInfos.at(chunkIndex).bounds, region)) {
+                chunkIndexSet.insert(chunkIndex);
+            }
+        }
+    }
+    std::vector<uint32_t> chunkIndices(chunkIndexSet.begin(), chunkIndexSet.end());
+
+    //the selected entries are sorted by their original positions
+    std::vector<std::pair<uint64_t, ClusterDescription>> clusters;
+    std::vector<std::pair<uint64_t, ParticleDescription>> particles;
+    readChunks(stream, directory, chunkIndices, [&](DecodedChunk&& chunk) {
+        for (size_t i = 0; i < chunk.clusters.size(); ++i) {
+            clusters.emplace_back(chunk.indices.at(i), std::move(chunk.clusters.at(i)));
+        }
+        for (size_t i = 0; i < chunk.particles.size(); ++i) {
+            particles.emplace_back(chunk.indices.at(i), std::move(chunk.particles.at(i)));
+        }
+    });
+    auto compareIndices = [](auto const& entry1, auto const& entry2) { return entry1.first < entry2.first; };
+    std::sort(clusters.begin(), clusters.end(), compareIndices);
+    std::sort(particles.begin(), particles.end(), compareIndices);
+
+    data.clear();
+    data.clusters.reserve(clusters.size());
+    for (auto& [index, cluster] : clusters) {
+        data.clusters.emplace_back(std::move(cluster));
+    }
+    data.particles.reserve(particles.size());
+    for (auto& [index, particle] : particles) {
+        data.particles.emplace_back(std::move(particle));
+    }
+    filterRegion(data, region);
 }
 
 void Serializer::serializeAuxiliaryData(AuxiliaryData const& auxiliaryData, std::ostream& stream)
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
+
 #include "Base/Definitions.h"
 
 #include "Definitions.h"
 #include "AuxiliaryData.h"
 #include "Descriptions.h"
+#include "FundamentalConstants.h"
 
 struct DeserializedSimulation
 {
@@ -12,6 +15,19 @@ struct DeserializedSimulation
     ClusteredDataDescription mainData;
 };
 
+//uncompressed part of simulation files which can be read without decoding the content
+struct SimulationSummary
+{
+    std::string programVersion;
+    IntVector2D worldSize;
+    uint64_t timestep = 0;
+    std::array<uint64_t, MAX_COLORS> numCellsPerColor = {};
+    std::array<uint64_t, MAX_COLORS> numParticlesPerColor = {};
+    uint32_t contentHash = 0;    //CRC-32 of the uncompressed content
+    IntVector2D thumbnailSize;   //{0, 0} if no thumbnail is present
+    std::vector<uint8_t> thumbnail;  //RGB values, row by row
+};
+
 struct SerializedSimulation
 {
     std::string auxiliaryData;  //JSON
@@ -24,6 +40,12 @@ public:
     static bool serializeSimulationToFiles(std::string const& filename, DeserializedSimulation const& data);
     static bool deserializeSimulationFromFiles(DeserializedSimulation& data, std::string const& filename);
 
+    //reads only the summary, returns false for files without summary (e.g. from older versions)
+    static bool peekSimulationSummary(SimulationSummary& summary, std::string const& filename);
+
+    //loads the particles and the clusters with at least one cell inside the region
+    static bool deserializeSimulationRegionFromFiles(DeserializedSimulation& data, std::string const& filename, RealRect const& region);
+
     static bool serializeSimulationToStrings(SerializedSimulation& output, DeserializedSimulation const& input);
     static bool deserializeSimulationFromStrings(DeserializedSimulation& output, SerializedSimulation const& input);
 
@@ -41,6 +63,11 @@ private:
     static bool deserializeDataDescription(ClusteredDataDescription& data, std::string const& filename);
     static void deserializeDataDescription(ClusteredDataDescription& data, std::istream& stream);
 
+    static bool isChunkedFile(std::string const& filename);
+    static bool serializeDataDescriptionToChunkedFile(DeserializedSimulation const& simulation, std::string const& filename);
+    static void deserializeDataDescriptionFromChunkedFile(ClusteredDataDescription& data, std::string const& filename);
+    static void deserializeDataDescriptionRegionFromChunkedFile(ClusteredDataDescription& data, std::string const& filename, RealRect const& region);
+
     static void serializeAuxiliaryData(AuxiliaryData const& auxiliaryData, std::ostream& stream);
     static void deserializeAuxiliaryData(AuxiliaryData& auxiliaryData, std::istream& stream);
 
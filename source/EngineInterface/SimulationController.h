@@ -1,6 +1,11 @@
 #pragma once
+
+#include <chrono>
+#include <future>
+
 #include "Definitions.h"
 #include "OverlayDescriptions.h"
+#include "PublishedFrame.h"
 #include "SelectionShallowData.h"
 #include "Settings.h"
 #include "ShallowUpdateSelectionData.h"
@@ -31,15 +36,31 @@ public:
     virtual void setSyncSimulationWithRenderingRatio(int value) = 0;
 
     virtual ClusteredDataDescription getClusteredSimulationData() = 0;
+    virtual SimulationDataSnapshot getSimulationDataSnapshot() = 0;  //only copies the data, conversion is done by the caller
     virtual DataDescription getSimulationData() = 0;
     virtual ClusteredDataDescription getSelectedClusteredSimulationData(bool includeClusters) = 0;
     virtual DataDescription getSelectedSimulationData(bool includeClusters) = 0;
     virtual DataDescription getInspectedSimulationData(std::vector<uint64_t> objectsIds) = 0;
 
+    //queries which are executed between time steps without blocking the caller, equal pending queries share their result
+    virtual std::shared_future<DataDescription> getSimulationData_async() = 0;
+    virtual std::shared_future<DataDescription> getSelectedSimulationData_async(bool includeClusters) = 0;
+    virtual std::shared_future<DataDescription> getInspectedSimulationData_async(std::vector<uint64_t> objectsIds) = 0;
+    virtual std::shared_future<SelectionShallowData> getSelectionShallowData_async() = 0;
+    virtual std::shared_future<StatisticsData> getStatistics_async() = 0;
+
+    //frames are published by the simulation thread and can be read by a single consumer thread without blocking
+    virtual PublishedFrame const& getPublishedFrame() = 0;  //reference is valid until the next call
+    virtual std::chrono::milliseconds getPublishingInterval() const = 0;
+    virtual void setPublishingInterval(std::chrono::milliseconds const& value) = 0;
+    virtual uint64_t setInspectedEntityIdsForPublishing(std::vector<uint64_t> const& entityIds) = 0;  //returns the inspection request of the frames containing them
+
     virtual void addAndSelectSimulationData(DataDescription const& dataToAdd) = 0;
+    virtual void addAndSelectSimulationData_async(DataDescription const& dataToAdd) = 0;
     virtual void setClusteredSimulationData(ClusteredDataDescription const& dataToUpdate) = 0;
     virtual void setSimulationData(DataDescription const& dataToUpdate) = 0;
     virtual void removeSelectedObjects(bool includeClusters) = 0;
+    virtual void removeSelectedObjects_async(bool includeClusters) = 0;
     virtual void relaxSelectedObjects(bool includeClusters) = 0;
     virtual void uniformVelocitiesForSelectedObjects(bool includeClusters) = 0;
     virtual void makeSticky(bool includeClusters) = 0;
@@ -74,12 +95,18 @@ public:
 
     virtual void applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius) = 0;
 
+    //async edits are queued and executed before the next time step or access
     virtual void switchSelection(RealVector2D const& pos, float radius) = 0;
+    virtual void switchSelection_async(RealVector2D const& pos, float radius) = 0;
     virtual void swapSelection(RealVector2D const& pos, float radius) = 0;
+    virtual void swapSelection_async(RealVector2D const& pos, float radius) = 0;
     virtual SelectionShallowData getSelectionShallowData() = 0;
     virtual void shallowUpdateSelectedObjects(ShallowUpdateSelectionData const& updateData) = 0;
+    virtual void shallowUpdateSelectedObjects_async(ShallowUpdateSelectionData const& updateData) = 0;
     virtual void setSelection(RealVector2D const& startPos, RealVector2D const& endPos) = 0;
+    virtual void setSelection_async(RealVector2D const& startPos, RealVector2D const& endPos) = 0;
     virtual void removeSelection() = 0;
+    virtual void removeSelection_async() = 0;
     virtual bool updateSelectionIfNecessary() = 0;
 
     virtual GeneralSettings getGeneralSettings() const = 0;
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Definitions.h"
+
+/**
+ * Host copy of the simulation content which is taken under the engine guard. The expensive conversion into
+ * descriptions is deferred, so it can be done on another thread while the simulation continues.
+ */
+class _SimulationDataSnapshot
+{
+public:
+    virtual ~_SimulationDataSnapshot() = default;
+
+    virtual uint64_t getNumCells() const = 0;
+    virtual uint64_t getNumParticles() const = 0;
+
+    //can be called from any thread
+    virtual ClusteredDataDescription convertToClusteredDataDescription() const = 0;
+    virtual DataDescription convertToDataDescription() const = 0;
+};
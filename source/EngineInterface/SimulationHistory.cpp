@@ -0,0 +1,363 @@
+#include "SimulationHistory.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include <zlib.h>
+
+#include "Base/ThreadPool.h"
+#include "SchemaSerializer.h"
+
+namespace
+{
+    auto constexpr DeltaBlockSize = 4096;
+
+    int getCellFunctionFieldIndex()
+    {
+        static int const result = [] {
+            auto const& fields = SchemaSerializer::getSchema()[SchemaObjectType_Cell];
+            CHECK(fields.size() <= 32);
+            for (int i = 0; i < toInt(fields.size()); ++i) {
+                if (fields[i].type == SchemaFieldType_CellFunction) {
+                    return i;
+                }
+            }
+            return -1;
+        }();
+        return result;
+    }
+
+    uint64_t estimateMemoryUsage(DataDescription const& data)
+    {
+        uint64_t result = data.cells.capacity() * sizeof(CellDescription) + data.particles.capacity() * sizeof(ParticleDescription);
+        for (auto const& cell : data.cells) {
+            result += cell.connections.capacity() * sizeof(ConnectionDescription);
+        }
+        return result;
+    }
+
+    std::string compress(std::string const& data)
+    {
+        auto compressedSize = compressBound(static_cast<uLong>(data.size()));
+        std::string result(compressedSize, '\0');
+        auto status = compress2(
+            reinterpret_cast<Bytef*>(result.data()),
+            &compressedSize,
+            reinterpret_cast<Bytef const*>(data.data()),
+            static_cast<uLong>(data.size()),
+            Z_BEST_SPEED);
+        if (status != Z_OK) {
+            throw std::runtime_error("History entry could not be compressed.");
+        }
+        result.resize(compressedSize);
+        return result;
+    }
+
+    std::string decompress(std::string const& data, uint64_t uncompressedSize)
+    {
+        std::string result(uncompressedSize, '\0');
+        auto size = static_cast<uLongf>(uncompressedSize);
+        auto status = uncompress(reinterpret_cast<Bytef*>(result.data()), &size, reinterpret_cast<Bytef const*>(data.data()), static_cast<uLong>(data.size()));
+        if (status != Z_OK || size != uncompressedSize) {
+            throw std::runtime_error("History entry could not be decompressed.");
+        }
+        return result;
+    }
+}
+
+uint64_t SimulationHistory::Delta::getMemoryUsage() const
+{
+    std::lock_guard lock(mutex);
+    return sizeof(Delta) + (addedCellIds.capacity() + addedParticleIds.capacity()) * sizeof(uint64_t) + cellChanges.capacity() * sizeof(CellChange)
+        + cellFunctionChanges.capacity() * sizeof(CellFunctionChange) + packedData.capacity();
+}
+
+SimulationHistory::SimulationHistory(uint64_t memoryBudget)
+    : _memoryBudget(memoryBudget)
+{}
+
+uint64_t SimulationHistory::getMemoryBudget() const
+{
+    return _memoryBudget;
+}
+
+void SimulationHistory::setMemoryBudget(uint64_t value)
+{
+    _memoryBudget = value;
+    evictStates();
+}
+
+void SimulationHistory::push(uint64_t timestep, DataDescription data)
+{
+    if (_keyframe) {
+        _deltas.emplace_back(createDelta(*_keyframe, data));
+        if (_deltas.size() > NumUncompressedDeltas) {
+            compressInBackground(_deltas.at(_deltas.size() - NumUncompressedDeltas - 1));
+        }
+    }
+    _keyframeMemoryUsage = estimateMemoryUsage(data);
+    _keyframe = State{timestep, std::move(data)};
+    evictStates();
+}
+
+SimulationHistory::State SimulationHistory::pop()
+{
+    CHECK(_keyframe.has_value());
+    auto result = std::move(*_keyframe);
+    if (!_deltas.empty()) {
+        auto const& delta = *_deltas.back();
+        State predecessor{delta.timestep, result.data};
+        applyDelta(delta, predecessor.data);
+        _keyframeMemoryUsage = estimateMemoryUsage(predecessor.data);
+        _keyframe = std::move(predecessor);
+        _deltas.pop_back();
+    } else {
+        _keyframe.reset();
+        _keyframeMemoryUsage = 0;
+    }
+    return result;
+}
+
+void SimulationHistory::clear()
+{
+    _keyframe.reset();
+    _keyframeMemoryUsage = 0;
+    _deltas.clear();
+}
+
+bool SimulationHistory::empty() const
+{
+    return !_keyframe.has_value();
+}
+
+int SimulationHistory::size() const
+{
+    return _keyframe ? toInt(_deltas.size()) + 1 : 0;
+}
+
+uint64_t SimulationHistory::getMemoryUsage() const
+{
+    auto result = _keyframeMemoryUsage;
+    for (auto const& delta : _deltas) {
+        result += delta->getMemoryUsage();
+    }
+    return result;
+}
+
+int SimulationHistory::getNumCompressedDeltas() const
+{
+    int result = 0;
+    for (auto const& delta : _deltas) {
+        std::lock_guard lock(delta->mutex);
+        if (delta->isCompressed) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+void SimulationHistory::waitForCompressions()
+{
+    for (auto& compression : _compressions) {
+        compression.wait();
+    }
+    _compressions.clear();
+}
+
+SimulationHistory::DeltaPtr SimulationHistory::createDelta(State const& state, DataDescription const& successorData) const
+{
+    auto result = std::make_shared<Delta>();
+    result->timestep = state.timestep;
+
+    //cells
+    std::unordered_map<uint64_t, int> successorCellIndexById;
+    successorCellIndexById.reserve(successorData.cells.size());
+    for (int i = 0; i < toInt(successorData.cells.size()); ++i) {
+        successorCellIndexById.emplace(successorData.cells[i].id, i);
+    }
+    std::unordered_set<uint64_t> cellIds;
+    cellIds.reserve(state.data.cells.size());
+    for (auto const& cell : state.data.cells) {
+        cellIds.insert(cell.id);
+    }
+    for (auto const& cell : successorData.cells) {
+        if (!cellIds.contains(cell.id)) {
+            result->addedCellIds.emplace_back(cell.id);
+        }
+    }
+
+    //fields are compared in their encoded form in parallel blocks which are concatenated afterwards
+    struct Block
+    {
+        std::vector<CellChange> cellChanges;
+        std::vector<CellFunctionChange> cellFunctionChanges;
+        std::string packedData;
+    };
+    auto numCells = toInt(state.data.cells.size());
+    auto numFields = SchemaSerializer::getNumCellFields();
+    auto cellFunctionFieldIndex = getCellFunctionFieldIndex();
+    std::vector<Block> blocks((numCells + DeltaBlockSize - 1) / DeltaBlockSize);
+    ThreadPool::getInstance().parallelFor(toInt(blocks.size()), [&](int begin, int end) {
+        std::string encodedField;
+        std::string encodedSuccessorField;
+        for (int blockIndex = begin; blockIndex < end; ++blockIndex) {
+            auto& block = blocks[blockIndex];
+            for (int i = blockIndex * DeltaBlockSize; i < std::min(numCells, (blockIndex + 1) * DeltaBlockSize); ++i) {
+                auto const& cell = state.data.cells[i];
+                CellChange cellChange{.id = cell.id};
+                auto findResult = successorCellIndexById.find(cell.id);
+                auto successorCell = findResult != successorCellIndexById.end() ? &successorData.cells[findResult->second] : nullptr;
+                cellChange.isRemoved = successorCell == nullptr;
+
+                for (int fieldIndex = 0; fieldIndex < numFields; ++fieldIndex) {
+                    if (fieldIndex == cellFunctionFieldIndex) {
+                        continue;
+                    }
+                    encodedField.clear();
+                    SchemaSerializer::serializeCellField(encodedField, cell, fieldIndex);
+                    if (successorCell) {
+                        encodedSuccessorField.clear();
+                        SchemaSerializer::serializeCellField(encodedSuccessorField, *successorCell, fieldIndex);
+                        if (encodedField == encodedSuccessorField) {
+                            continue;
+                        }
+                    }
+                    cellChange.fieldMask |= 1u << fieldIndex;
+                    block.packedData += encodedField;
+                }
+                if (!successorCell || cell.cellFunction != successorCell->cellFunction || cell.genomeSize != successorCell->genomeSize) {
+                    cellChange.cellFunctionIndex = toInt(block.cellFunctionChanges.size());
+                    block.cellFunctionChanges.emplace_back(CellFunctionChange{cell.cellFunction, cell.genomeSize});
+                }
+                if (cellChange.fieldMask != 0 || cellChange.cellFunctionIndex != -1) {
+                    block.cellChanges.emplace_back(cellChange);
+                }
+            }
+        }
+    });
+    for (auto& block : blocks) {
+        auto cellFunctionIndexOffset = toInt(result->cellFunctionChanges.size());
+        for (auto& cellChange : block.cellChanges) {
+            if (cellChange.cellFunctionIndex != -1) {
+                cellChange.cellFunctionIndex += cellFunctionIndexOffset;
+            }
+        }
+        result->cellChanges.insert(result->cellChanges.end(), block.cellChanges.begin(), block.cellChanges.end());
+        std::ranges::move(block.cellFunctionChanges, std::back_inserter(result->cellFunctionChanges));
+        result->packedData += block.packedData;
+    }
+
+    //particles are stored as whole records
+    std::unordered_map<uint64_t, int> successorParticleIndexById;
+    successorParticleIndexById.reserve(successorData.particles.size());
+    for (int i = 0; i < toInt(successorData.particles.size()); ++i) {
+        successorParticleIndexById.emplace(successorData.particles[i].id, i);
+    }
+    std::vector<uint64_t> changedParticleIndices;
+    std::unordered_set<uint64_t> particleIds;
+    particleIds.reserve(state.data.particles.size());
+    for (int i = 0; i < toInt(state.data.particles.size()); ++i) {
+        auto const& particle = state.data.particles[i];
+        particleIds.insert(particle.id);
+        auto findResult = successorParticleIndexById.find(particle.id);
+        if (findResult == successorParticleIndexById.end() || successorData.particles[findResult->second] != particle) {
+            changedParticleIndices.emplace_back(i);
+        }
+    }
+    for (auto const& particle : successorData.particles) {
+        if (!particleIds.contains(particle.id)) {
+            result->addedParticleIds.emplace_back(particle.id);
+        }
+    }
+    result->particleDataOffset = result->packedData.size();
+    SchemaSerializer::serializeParticles(result->packedData, state.data.particles, changedParticleIndices);
+
+    result->packedData.shrink_to_fit();
+    result->uncompressedSize = result->packedData.size();
+    return result;
+}
+
+void SimulationHistory::applyDelta(Delta const& delta, DataDescription& data) const
+{
+    std::lock_guard lock(delta.mutex);
+    std::string decompressedData;
+    if (delta.isCompressed) {
+        decompressedData = decompress(delta.packedData, delta.uncompressedSize);
+    }
+    std::string_view packedData = delta.isCompressed ? decompressedData : delta.packedData;
+
+    //cells
+    std::unordered_set<uint64_t> addedCellIds(delta.addedCellIds.begin(), delta.addedCellIds.end());
+    std::erase_if(data.cells, [&](auto const& cell) { return addedCellIds.contains(cell.id); });
+
+    std::unordered_map<uint64_t, int> cellIndexById;
+    cellIndexById.reserve(data.cells.size());
+    for (int i = 0; i < toInt(data.cells.size()); ++i) {
+        cellIndexById.emplace(data.cells[i].id, i);
+    }
+    auto numFields = SchemaSerializer::getNumCellFields();
+    uint64_t pos = 0;
+    for (auto const& cellChange : delta.cellChanges) {
+        CellDescription* cell;
+        if (cellChange.isRemoved) {
+            cell = &data.cells.emplace_back();
+        } else {
+            cell = &data.cells.at(cellIndexById.at(cellChange.id));
+        }
+        for (int fieldIndex = 0; fieldIndex < numFields; ++fieldIndex) {
+            if (cellChange.fieldMask & (1u << fieldIndex)) {
+                pos += SchemaSerializer::deserializeCellField(packedData.substr(pos), *cell, fieldIndex);
+            }
+        }
+        if (cellChange.cellFunctionIndex != -1) {
+            auto const& cellFunctionChange = delta.cellFunctionChanges.at(cellChange.cellFunctionIndex);
+            cell->cellFunction = cellFunctionChange.cellFunction;
+            cell->genomeSize = cellFunctionChange.genomeSize;
+        }
+    }
+
+    //particles
+    std::unordered_set<uint64_t> addedParticleIds(delta.addedParticleIds.begin(), delta.addedParticleIds.end());
+    std::erase_if(data.particles, [&](auto const& particle) { return addedParticleIds.contains(particle.id); });
+
+    std::unordered_map<uint64_t, int> particleIndexById;
+    particleIndexById.reserve(data.particles.size());
+    for (int i = 0; i < toInt(data.particles.size()); ++i) {
+        particleIndexById.emplace(data.particles[i].id, i);
+    }
+    for (auto const& particle : SchemaSerializer::deserializeParticles(packedData.substr(delta.particleDataOffset), SchemaSerializer::getSchema())) {
+        auto findResult = particleIndexById.find(particle.id);
+        if (findResult != particleIndexById.end()) {
+            data.particles[findResult->second] = particle;
+        } else {
+            data.particles.emplace_back(particle);
+        }
+    }
+}
+
+void SimulationHistory::compressInBackground(DeltaPtr const& delta)
+{
+    std::erase_if(_compressions, [](auto const& compression) { return compression.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+
+    if (delta->isCompressionScheduled) {
+        return;
+    }
+    delta->isCompressionScheduled = true;
+
+    //the packed data is only modified by this task, hence it can be read without lock
+    _compressions.emplace_back(ThreadPool::getInstance().submit([delta] {
+        auto compressedData = compress(delta->packedData);
+        std::lock_guard lock(delta->mutex);
+        delta->packedData = std::move(compressedData);
+        delta->isCompressed = true;
+    }));
+}
+
+void SimulationHistory::evictStates()
+{
+    auto memoryUsage = getMemoryUsage();
+    while (memoryUsage > _memoryBudget && !_deltas.empty()) {
+        memoryUsage -= _deltas.front()->getMemoryUsage();
+        _deltas.pop_front();
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "Base/Definitions.h"
+#include "Descriptions.h"
+
+/**
+ * In-memory history of simulation states for stepping backward. Only the most recent state (keyframe) is stored in full.
+ * Each older state is kept as a delta against its successor: ids of cells and particles to remove, the differing cell
+ * fields in packed record form and the records of cells and particles which no longer exist in the successor.
+ * Cell functions are kept as descriptions, so genomes are shared by content with the simulation data (see GenomeBuffer).
+ * Deltas which are no longer among the most recent ones are compressed in the background. If the estimated memory usage
+ * exceeds the budget, the oldest states are evicted. The order of cells and particles of restored states may differ.
+ */
+class SimulationHistory
+{
+public:
+    static uint64_t constexpr DefaultMemoryBudget = 1024ull * 1024 * 1024;  //in bytes
+    static int constexpr NumUncompressedDeltas = 4;
+
+    struct State
+    {
+        uint64_t timestep = 0;
+        DataDescription data;
+    };
+
+    explicit SimulationHistory(uint64_t memoryBudget = DefaultMemoryBudget);
+
+    SimulationHistory(SimulationHistory const&) = delete;
+    void operator=(SimulationHistory const&) = delete;
+
+    uint64_t getMemoryBudget() const;
+    void setMemoryBudget(uint64_t value);
+
+    void push(uint64_t timestep, DataDescription data);
+    State pop();  //returns the most recent state
+    void clear();
+
+    bool empty() const;
+    int size() const;
+    uint64_t getMemoryUsage() const;  //estimated in bytes
+    int getNumCompressedDeltas() const;
+    void waitForCompressions();
+
+private:
+    struct CellChange
+    {
+        uint64_t id = 0;
+        uint32_t fieldMask = 0;  //fields contained in the packed data
+        int cellFunctionIndex = -1;  //index of the previous cell function or -1 if unchanged
+        bool isRemoved = false;  //true if the cell does not exist in the successor
+    };
+    struct CellFunctionChange
+    {
+        CellFunctionDescription cellFunction;
+        int genomeSize = 0;
+    };
+    struct Delta
+    {
+        uint64_t timestep = 0;
+        std::vector<uint64_t> addedCellIds;  //ids of cells which are created in the successor
+        std::vector<uint64_t> addedParticleIds;
+        std::vector<CellChange> cellChanges;
+        std::vector<CellFunctionChange> cellFunctionChanges;
+        uint64_t particleDataOffset = 0;  //packed cell fields are followed by packed particle records
+        bool isCompressionScheduled = false;
+
+        mutable std::mutex mutex;  //guards the packed data against background compression
+        std::string packedData;
+        uint64_t uncompressedSize = 0;
+        bool isCompressed = false;
+
+        uint64_t getMemoryUsage() const;
+    };
+    using DeltaPtr = std::shared_ptr<Delta>;
+
+    DeltaPtr createDelta(State const& state, DataDescription const& successorData) const;
+    void applyDelta(Delta const& delta, DataDescription& data) const;
+
+    void compressInBackground(DeltaPtr const& delta);
+    void evictStates();
+
+    uint64_t _memoryBudget = DefaultMemoryBudget;
+
+    std::optional<State> _keyframe;
+    uint64_t _keyframeMemoryUsage = 0;
+    std::deque<DeltaPtr> _deltas;
+
+    std::vector<std::future<void>> _compressions;
+};
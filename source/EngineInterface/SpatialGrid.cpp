@@ -0,0 +1,144 @@
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+namespace
+{
+    auto constexpr MaxBucketsPerPosition = 4;
+    auto constexpr MinNumBuckets = 1024;
+}
+
+SpatialGrid::SpatialGrid(std::vector<RealVector2D> positions, float bucketSize)
+    : _positions(std::move(positions))
+    , _bucketSize(std::max(bucketSize, NEAR_ZERO))
+{
+    auto numPositions = toInt(_positions.size());
+    if (numPositions == 0) {
+        _gridSize = {0, 0};
+        _bucketOffsets = {0};
+        return;
+    }
+
+    //bounding box
+    RealVector2D minPos = _positions.front();
+    RealVector2D maxPos = _positions.front();
+    for (auto const& pos : _positions) {
+        minPos = {std::min(minPos.x, pos.x), std::min(minPos.y, pos.y)};
+        maxPos = {std::max(maxPos.x, pos.x), std::max(maxPos.y, pos.y)};
+    }
+    _origin = minPos;
+
+    //enlarge buckets for sparse position sets such that memory stays linear in the number of positions
+    auto maxNumBuckets = std::max(MinNumBuckets, numPositions * MaxBucketsPerPosition);
+    while (true) {
+        auto numBucketsX = std::floor((maxPos.x - minPos.x) / _bucketSize) + 1;
+        auto numBucketsY = std::floor((maxPos.y - minPos.y) / _bucketSize) + 1;
+        if (toDouble(numBucketsX) * toDouble(numBucketsY) <= toDouble(maxNumBuckets)) {
+            _gridSize = {toInt(numBucketsX), toInt(numBucketsY)};
+            break;
+        }
+        _bucketSize *= 2;
+    }
+
+    //counting sort of the position indices by bucket
+    auto numBuckets = _gridSize.x * _gridSize.y;
+    std::vector<int> bucketIndices(numPositions);
+    _bucketOffsets.assign(numBuckets + 1, 0);
+    for (int i = 0; i < numPositions; ++i) {
+        auto bucket = getBucket(_positions[i]);
+        bucketIndices[i] = getBucketIndex(std::min(bucket.x, _gridSize.x - 1), std::min(bucket.y, _gridSize.y - 1));
+        ++_bucketOffsets[bucketIndices[i] + 1];
+    }
+    for (int i = 0; i < numBuckets; ++i) {
+        _bucketOffsets[i + 1] += _bucketOffsets[i];
+    }
+    _sortedIndices.resize(numPositions);
+    std::vector<int> insertionOffsets(_bucketOffsets.begin(), _bucketOffsets.end() - 1);
+    for (int i = 0; i < numPositions; ++i) {
+        _sortedIndices[insertionOffsets[bucketIndices[i]]++] = i;
+    }
+}
+
+int SpatialGrid::getNumPositions() const
+{
+    return toInt(_positions.size());
+}
+
+RealVector2D const& SpatialGrid::getPosition(int index) const
+{
+    return _positions[index];
+}
+
+std::vector<int> SpatialGrid::getIndicesWithinRadius(RealVector2D const& pos, float radius) const
+{
+    std::vector<int> result;
+    getIndicesWithinRadius(result, pos, radius);
+    return result;
+}
+
+void SpatialGrid::getIndicesWithinRadius(std::vector<int>& result, RealVector2D const& pos, float radius) const
+{
+    result.clear();
+    forEachIndexWithinRadius(pos, radius, [&](int index) { result.emplace_back(index); });
+    sortByDistance(result, pos);
+}
+
+std::vector<int> SpatialGrid::getNearestIndices(RealVector2D const& pos, int k) const
+{
+    std::vector<int> result;
+    k = std::min(k, getNumPositions());
+    if (k <= 0) {
+        return result;
+    }
+
+    //visit square rings of buckets around pos until no unvisited bucket can contain a nearer position
+    auto center = getBucket(pos);
+    auto maxRing = std::max(std::max(center.x, _gridSize.x - 1 - center.x), std::max(center.y, _gridSize.y - 1 - center.y));
+    auto addBucket = [&](int x, int y) {
+        if (x < 0 || y < 0 || x >= _gridSize.x || y >= _gridSize.y) {
+            return;
+        }
+        auto bucketIndex = getBucketIndex(x, y);
+        result.insert(result.end(), _sortedIndices.begin() + _bucketOffsets[bucketIndex], _sortedIndices.begin() + _bucketOffsets[bucketIndex + 1]);
+    };
+    for (int ring = 0; ring <= maxRing; ++ring) {
+        for (int y = center.y - ring; y <= center.y + ring; ++y) {
+            auto onHorizontalEdge = y == center.y - ring || y == center.y + ring;
+            auto xInc = onHorizontalEdge || ring == 0 ? 1 : 2 * ring;
+            for (int x = center.x - ring; x <= center.x + ring; x += xInc) {
+                addBucket(x, y);
+            }
+        }
+        if (toInt(result.size()) >= k) {
+            sortByDistance(result, pos);
+            if (Math::length(_positions[result[k - 1]] - pos) < toFloat(ring) * _bucketSize) {
+                break;
+            }
+        }
+    }
+    sortByDistance(result, pos);
+    result.resize(k);
+    return result;
+}
+
+IntVector2D SpatialGrid::getBucket(RealVector2D const& pos) const
+{
+    auto clampCoordinate = [](float value, int gridSize) {
+        return toInt(std::floor(std::max(-1.0f, std::min(toFloat(gridSize), value))));
+    };
+    return {clampCoordinate((pos.x - _origin.x) / _bucketSize, _gridSize.x), clampCoordinate((pos.y - _origin.y) / _bucketSize, _gridSize.y)};
+}
+
+int SpatialGrid::getBucketIndex(int x, int y) const
+{
+    return y * _gridSize.x + x;
+}
+
+void SpatialGrid::sortByDistance(std::vector<int>& indices, RealVector2D const& pos) const
+{
+    std::sort(indices.begin(), indices.end(), [&](int index1, int index2) {
+        auto distance1 = Math::length(_positions[index1] - pos);
+        auto distance2 = Math::length(_positions[index2] - pos);
+        return distance1 < distance2 || (distance1 == distance2 && index1 < index2);
+    });
+}
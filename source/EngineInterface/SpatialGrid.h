@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "Base/Definitions.h"
+#include "Base/Math.h"
+
+/**
+ * Flat uniform grid over a fixed set of positions. The position indices are sorted by bucket (counting sort) and each
+ * bucket is addressed by an offset into the sorted index array. Queries are const and can be called concurrently.
+ */
+class SpatialGrid
+{
+public:
+    SpatialGrid(std::vector<RealVector2D> positions, float bucketSize);
+
+    int getNumPositions() const;
+    RealVector2D const& getPosition(int index) const;
+
+    //returns indices of all positions with distance <= radius sorted by distance (ties by index)
+    std::vector<int> getIndicesWithinRadius(RealVector2D const& pos, float radius) const;
+    void getIndicesWithinRadius(std::vector<int>& result, RealVector2D const& pos, float radius) const;
+
+    //returns indices of the k nearest positions sorted by distance (ties by index)
+    std::vector<int> getNearestIndices(RealVector2D const& pos, int k) const;
+
+    //calls func(index) for each position with distance <= radius in unspecified order
+    template <typename Func>
+    void forEachIndexWithinRadius(RealVector2D const& pos, float radius, Func const& func) const;
+
+private:
+    IntVector2D getBucket(RealVector2D const& pos) const;  //not clamped to the grid
+    int getBucketIndex(int x, int y) const;
+    void sortByDistance(std::vector<int>& indices, RealVector2D const& pos) const;
+
+    std::vector<RealVector2D> _positions;
+    RealVector2D _origin;
+    float _bucketSize = 1.0f;
+    IntVector2D _gridSize;
+    std::vector<int> _bucketOffsets;  //size = number of buckets + 1
+    std::vector<int> _sortedIndices;
+};
+
+template <typename Func>
+void SpatialGrid::forEachIndexWithinRadius(RealVector2D const& pos, float radius, Func const& func) const
+{
+    if (_positions.empty()) {
+        return;
+    }
+    auto upperLeft = getBucket({pos.x - radius, pos.y - radius});
+    auto lowerRight = getBucket({pos.x + radius, pos.y + radius});
+    upperLeft = {std::max(0, upperLeft.x), std::max(0, upperLeft.y)};
+    lowerRight = {std::min(_gridSize.x - 1, lowerRight.x), std::min(_gridSize.y - 1, lowerRight.y)};
+    for (int y = upperLeft.y; y <= lowerRight.y; ++y) {
+        for (int x = upperLeft.x; x <= lowerRight.x; ++x) {
+            auto bucketIndex = getBucketIndex(x, y);
+            for (int i = _bucketOffsets[bucketIndex]; i < _bucketOffsets[bucketIndex + 1]; ++i) {
+                auto index = _sortedIndices[i];
+                if (Math::length(_positions[index] - pos) <= radius) {
+                    func(index);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#include "TimelineBuffer.h"
+
+#include <algorithm>
+
+TimelineBuffer::TimelineBuffer(int numChannels, int capacity)
+    : _numChannels(numChannels)
+    , _capacity(capacity)
+    , _values(static_cast<size_t>(numChannels) * 2 * capacity)
+{
+    CHECK(numChannels > 0 && capacity > 0);
+}
+
+void TimelineBuffer::clear()
+{
+    _start = 0;
+    _size = 0;
+}
+
+void TimelineBuffer::push(std::span<double const> values)
+{
+    CHECK(toInt(values.size()) == _numChannels);
+
+    auto pos = _start + _size;
+    if (pos >= _capacity) {
+        pos -= _capacity;
+    }
+    if (isFull()) {
+        _start = _start + 1 < _capacity ? _start + 1 : 0;
+    } else {
+        ++_size;
+    }
+    for (int channel = 0; channel < _numChannels; ++channel) {
+        auto block = getBlock(channel);
+        block[pos] = values[channel];
+        block[pos + _capacity] = values[channel];
+    }
+}
+
+std::span<double const> TimelineBuffer::getChannel(int channel) const
+{
+    return {getBlock(channel) + _start, static_cast<size_t>(_size)};
+}
+
+double* TimelineBuffer::getBlock(int channel)
+{
+    return _values.data() + static_cast<size_t>(channel) * 2 * _capacity;
+}
+
+double const* TimelineBuffer::getBlock(int channel) const
+{
+    return _values.data() + static_cast<size_t>(channel) * 2 * _capacity;
+}
+
+int TimelineBuffer::getLowerBound(double time) const
+{
+    auto timePoints = getTimePoints();
+    return toInt(std::ranges::lower_bound(timePoints, time) - timePoints.begin());
+}
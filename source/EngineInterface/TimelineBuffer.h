@@ -0,0 +1,45 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Base/Definitions.h"
+
+/**
+ * Fixed-capacity ring buffer for a set of time series (channels) which are stored column by column. Each value is
+ * written twice (mirrored by the capacity), so the stored entries of a channel always form one contiguous span which
+ * can be handed to ImPlot without copying. Channel 0 holds the time points, which must not decrease.
+ */
+class TimelineBuffer
+{
+public:
+    TimelineBuffer() = default;
+    TimelineBuffer(int numChannels, int capacity);
+
+    int getNumChannels() const { return _numChannels; }
+    int getCapacity() const { return _capacity; }
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    bool isFull() const { return _size == _capacity; }
+    void clear();
+
+    //values contains one value per channel; the oldest entry is evicted if the buffer is full
+    void push(std::span<double const> values);
+
+    std::span<double const> getChannel(int channel) const;
+    std::span<double const> getTimePoints() const { return getChannel(0); }
+    double getValue(int channel, int index) const { return getChannel(channel)[index]; }
+    double getLastValue(int channel) const { return getValue(channel, _size - 1); }
+
+    int getLowerBound(double time) const;  //index of the first entry with time point >= time
+
+private:
+    double* getBlock(int channel);
+    double const* getBlock(int channel) const;
+
+    int _numChannels = 0;
+    int _capacity = 0;
+    int _start = 0;
+    int _size = 0;
+    std::vector<double> _values;  //numChannels blocks of size 2 * capacity
+};
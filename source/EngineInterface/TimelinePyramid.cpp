@@ -0,0 +1,108 @@
+#include "TimelinePyramid.h"
+
+#include <algorithm>
+
+TimelinePyramid::TimelinePyramid(int numChannels, int capacity)
+    : _numChannels(numChannels)
+    , _capacity(capacity)
+{
+    CHECK(capacity >= ReductionFactor && capacity % ReductionFactor == 0);
+    _levels.emplace_back(createLevel(false));
+}
+
+void TimelinePyramid::clear()
+{
+    _levels.clear();
+    _levels.emplace_back(createLevel(false));
+}
+
+void TimelinePyramid::push(std::span<double const> values)
+{
+    pushIntoLevel(0, values, values, values);
+}
+
+int TimelinePyramid::getCompleteLevel() const
+{
+    for (int level = 0; level < getNumLevels(); ++level) {
+        if (_levels[level].numPushed <= static_cast<uint64_t>(_capacity)) {
+            return level;
+        }
+    }
+    return getNumLevels() - 1;
+}
+
+TimelinePyramid::Level TimelinePyramid::createLevel(bool withBounds) const
+{
+    Level result;
+    result.mean = TimelineBuffer(_numChannels, _capacity);
+    if (withBounds) {
+        result.min = TimelineBuffer(_numChannels, _capacity);
+        result.max = TimelineBuffer(_numChannels, _capacity);
+    }
+    result.pendingSum.resize(_numChannels, 0.0);
+    result.pendingMin.resize(_numChannels, 0.0);
+    result.pendingMax.resize(_numChannels, 0.0);
+    return result;
+}
+
+void TimelinePyramid::addLevel()
+{
+    //the level below is full and has not evicted entries yet, hence the new level covers the whole history
+    auto sourceLevel = getNumLevels() - 1;
+    _levels.emplace_back(createLevel(true));
+
+    auto const& source = _levels[sourceLevel];
+    std::vector<double> mean(_numChannels);
+    std::vector<double> min(_numChannels);
+    std::vector<double> max(_numChannels);
+    for (int i = 0; i < source.mean.size(); ++i) {
+        for (int channel = 0; channel < _numChannels; ++channel) {
+            mean[channel] = source.mean.getValue(channel, i);
+            min[channel] = getMin(sourceLevel).getValue(channel, i);
+            max[channel] = getMax(sourceLevel).getValue(channel, i);
+        }
+        aggregate(sourceLevel, mean, min, max);
+    }
+}
+
+void TimelinePyramid::pushIntoLevel(int level, std::span<double const> mean, std::span<double const> min, std::span<double const> max)
+{
+    if (_levels[level].mean.isFull() && level == getNumLevels() - 1) {
+        addLevel();
+    }
+    auto& target = _levels[level];
+    target.mean.push(mean);
+    if (level > 0) {
+        target.min.push(min);
+        target.max.push(max);
+    }
+    ++target.numPushed;
+
+    if (level < getNumLevels() - 1) {
+        aggregate(level, mean, min, max);
+    }
+}
+
+void TimelinePyramid::aggregate(int level, std::span<double const> mean, std::span<double const> min, std::span<double const> max)
+{
+    auto& source = _levels[level];
+    if (source.numPending == 0) {
+        std::ranges::copy(mean, source.pendingSum.begin());
+        std::ranges::copy(min, source.pendingMin.begin());
+        std::ranges::copy(max, source.pendingMax.begin());
+    } else {
+        for (int channel = 0; channel < _numChannels; ++channel) {
+            source.pendingSum[channel] += mean[channel];
+            source.pendingMin[channel] = std::min(source.pendingMin[channel], min[channel]);
+            source.pendingMax[channel] = std::max(source.pendingMax[channel], max[channel]);
+        }
+    }
+    if (++source.numPending < ReductionFactor) {
+        return;
+    }
+    source.numPending = 0;
+    for (auto& value : source.pendingSum) {
+        value /= ReductionFactor;
+    }
+    pushIntoLevel(level + 1, source.pendingSum, source.pendingMin, source.pendingMax);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <deque>
+
+#include "TimelineBuffer.h"
+
+/**
+ * Multi-resolution history of a set of time series with bounded size per level. Level 0 holds the pushed entries and
+ * each further level holds the mean, minimum and maximum of ReductionFactor consecutive entries of the level below.
+ * A level is created from the level below when that level is about to evict its first entry, so the coarsest level
+ * always covers the whole history while the memory grows only logarithmically with the number of entries.
+ */
+class TimelinePyramid
+{
+public:
+    static int constexpr ReductionFactor = 4;
+
+    TimelinePyramid(int numChannels, int capacity);  //capacity per level, must be a multiple of ReductionFactor
+
+    void clear();
+    void push(std::span<double const> values);
+
+    int getNumLevels() const { return toInt(_levels.size()); }
+    int getCompleteLevel() const;  //finest level which still contains the whole history
+
+    TimelineBuffer const& getMean(int level) const { return _levels[level].mean; }
+    TimelineBuffer const& getMin(int level) const { return level == 0 ? _levels[0].mean : _levels[level].min; }
+    TimelineBuffer const& getMax(int level) const { return level == 0 ? _levels[0].mean : _levels[level].max; }
+
+private:
+    struct Level
+    {
+        TimelineBuffer mean;
+        TimelineBuffer min;
+        TimelineBuffer max;
+        uint64_t numPushed = 0;
+
+        //aggregation of the latest entries which are not yet part of the next level
+        int numPending = 0;
+        std::vector<double> pendingSum;  //divided in place when passed to the next level
+        std::vector<double> pendingMin;
+        std::vector<double> pendingMax;
+    };
+
+    Level createLevel(bool withBounds) const;
+    void addLevel();
+    void pushIntoLevel(int level, std::span<double const> mean, std::span<double const> min, std::span<double const> max);
+    void aggregate(int level, std::span<double const> mean, std::span<double const> min, std::span<double const> max);
+
+    int _numChannels = 0;
+    int _capacity = 0;
+    std::deque<Level> _levels;  //references stay valid when levels are added during a push
+};
@@ -0,0 +1,130 @@
+#include <filesystem>
+#include <future>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/AsyncSimulationWriter.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Serializer.h"
+
+class AsyncSimulationWriterTests : public ::testing::Test
+{
+public:
+    AsyncSimulationWriterTests()
+    {
+        _directory = std::filesystem::temp_directory_path() / "alien_async_writer_tests";
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+    ~AsyncSimulationWriterTests() { std::filesystem::remove_all(_directory); }
+
+protected:
+    DeserializedSimulation createSimulation(uint64_t timestep) const
+    {
+        DeserializedSimulation result;
+        result.auxiliaryData.timestep = timestep;
+        result.auxiliaryData.generalSettings.worldSizeX = 100;
+        result.auxiliaryData.generalSettings.worldSizeY = 100;
+        result.mainData.addCluster(
+            ClusterDescription().addCells(DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(3).center({50.0f, 50.0f})).cells));
+        return result;
+    }
+
+    std::string getFilename(std::string const& name) const { return (_directory / name).string(); }
+
+    std::filesystem::path _directory;
+};
+
+TEST_F(AsyncSimulationWriterTests, save)
+{
+    auto filename = getFilename("test.sim");
+    {
+        AsyncSimulationWriter writer;
+        EXPECT_TRUE(writer.trySubmit(filename, [&] { return createSimulation(42); }));
+        writer.waitUntilIdle();
+
+        auto progress = writer.getProgress();
+        EXPECT_EQ(0, progress.numInFlightSaves);
+        EXPECT_EQ(SaveStage_Idle, progress.stage);
+        EXPECT_EQ(1, progress.numSucceededSaves);
+        EXPECT_EQ(0, progress.numFailedSaves);
+    }
+
+    DeserializedSimulation simulation;
+    ASSERT_TRUE(Serializer::deserializeSimulationFromFiles(simulation, filename));
+    EXPECT_EQ(42, simulation.auxiliaryData.timestep);
+    EXPECT_EQ(createSimulation(42).mainData.clusters.front().cells.size(), simulation.mainData.clusters.front().cells.size());
+
+    //only the target files remain
+    EXPECT_EQ(2, std::distance(std::filesystem::directory_iterator(_directory), std::filesystem::directory_iterator()));
+}
+
+TEST_F(AsyncSimulationWriterTests, save_replacesExistingFiles)
+{
+    auto filename = getFilename("test.sim");
+    AsyncSimulationWriter writer;
+    for (uint64_t timestep = 1; timestep <= 3; ++timestep) {
+        EXPECT_TRUE(writer.trySubmit(filename, [&, timestep] { return createSimulation(timestep); }));
+        writer.waitUntilIdle();
+    }
+
+    DeserializedSimulation simulation;
+    ASSERT_TRUE(Serializer::deserializeSimulationFromFiles(simulation, filename));
+    EXPECT_EQ(3, simulation.auxiliaryData.timestep);
+}
+
+TEST_F(AsyncSimulationWriterTests, maxInFlightSaves)
+{
+    AsyncSimulationWriter writer(2);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto blockedProvider = [&] {
+        released.wait();
+        return createSimulation(1);
+    };
+
+    EXPECT_TRUE(writer.trySubmit(getFilename("test1.sim"), blockedProvider));
+    EXPECT_TRUE(writer.trySubmit(getFilename("test2.sim"), blockedProvider));
+    EXPECT_FALSE(writer.canSubmit());
+    EXPECT_FALSE(writer.trySubmit(getFilename("test3.sim"), blockedProvider));
+    EXPECT_EQ(2, writer.getProgress().numInFlightSaves);
+
+    release.set_value();
+    writer.waitUntilIdle();
+
+    EXPECT_TRUE(writer.canSubmit());
+    EXPECT_EQ(2, writer.getProgress().numSucceededSaves);
+    EXPECT_TRUE(std::filesystem::exists(getFilename("test2.sim")));
+    EXPECT_FALSE(std::filesystem::exists(getFilename("test3.sim")));
+}
+
+TEST_F(AsyncSimulationWriterTests, failedSave_keepsExistingFiles)
+{
+    auto filename = getFilename("test.sim");
+    AsyncSimulationWriter writer(3);
+    EXPECT_TRUE(writer.trySubmit(filename, [&] { return createSimulation(1); }));
+    EXPECT_TRUE(writer.trySubmit(filename, [&]() -> DeserializedSimulation { throw std::runtime_error("conversion failed"); }));
+    EXPECT_TRUE(writer.trySubmit(getFilename("missing/test.sim"), [&] { return createSimulation(2); }));
+    writer.waitUntilIdle();
+
+    EXPECT_EQ(1, writer.getProgress().numSucceededSaves);
+    EXPECT_EQ(2, writer.getProgress().numFailedSaves);
+
+    DeserializedSimulation simulation;
+    ASSERT_TRUE(Serializer::deserializeSimulationFromFiles(simulation, filename));
+    EXPECT_EQ(1, simulation.auxiliaryData.timestep);
+    EXPECT_EQ(2, std::distance(std::filesystem::directory_iterator(_directory), std::filesystem::directory_iterator()));
+}
+
+TEST_F(AsyncSimulationWriterTests, destructorCompletesSaves)
+{
+    {
+        AsyncSimulationWriter writer(3);
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_TRUE(writer.trySubmit(getFilename("test" + std::to_string(i) + ".sim"), [&] { return createSimulation(1); }));
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(std::filesystem::exists(getFilename("test" + std::to_string(i) + ".sim")));
+    }
+}
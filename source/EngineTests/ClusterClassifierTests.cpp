@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Base/IdAllocator.h"
+#include "EngineInterface/ClusterClassifier.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+
+class ClusterClassifierTests : public ::testing::Test
+{
+public:
+    ClusterClassifierTests() = default;
+    ~ClusterClassifierTests() = default;
+
+protected:
+    ClusterDescription toCluster(DataDescription const& data) const { return ClusterDescription().addCells(data.cells); }
+
+    //cells connected along the given pairs of indices
+    ClusterDescription createGraph(int numCells, std::vector<std::pair<int, int>> const& bonds) const
+    {
+        DataDescription data;
+        for (int i = 0; i < numCells; ++i) {
+            data.addCell(CellDescription().setId(IdAllocator::getInstance().getId()).setPos({toFloat(i), 0.0f}).setMaxConnections(6));
+        }
+        for (auto const& [index1, index2] : bonds) {
+            data.addConnection(data.cells.at(index1).id, data.cells.at(index2).id);
+        }
+        return toCluster(data);
+    }
+
+    ClusterDescription createHex(int layers, RealVector2D const& center) const
+    {
+        return toCluster(DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(layers).center(center)));
+    }
+};
+
+TEST_F(ClusterClassifierTests, identicalClusters)
+{
+    auto cluster1 = createHex(4, {10.0f, 10.0f});
+    auto cluster2 = createHex(4, {50.0f, 30.0f});
+    std::reverse(cluster2.cells.begin(), cluster2.cells.end());
+
+    EXPECT_EQ(ClusterClassifier::calcStructuralHash(cluster1), ClusterClassifier::calcStructuralHash(cluster2));
+    EXPECT_TRUE(ClusterClassifier::isIdentical(cluster1, cluster2));
+}
+
+TEST_F(ClusterClassifierTests, identicalLargeLattices)
+{
+    //the verification of symmetric lattices must finish within the step budget, since exhausted searches split classes
+    std::mt19937 randomEngine(0);
+    for (auto const& cluster :
+         {createHex(20, {0.0f, 0.0f}), toCluster(DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(60).height(60)))}) {
+        auto shuffledCluster = cluster;
+        std::ranges::shuffle(shuffledCluster.cells, randomEngine);
+        EXPECT_TRUE(ClusterClassifier::isIdentical(cluster, shuffledCluster));
+    }
+}
+
+TEST_F(ClusterClassifierTests, differentCellAttribute)
+{
+    auto cluster1 = createHex(4, {10.0f, 10.0f});
+    auto cluster2 = createHex(4, {10.0f, 10.0f});
+    cluster2.cells.at(5).color = 3;
+
+    EXPECT_FALSE(ClusterClassifier::isIdentical(cluster1, cluster2));
+    EXPECT_EQ(2, ClusterClassifier::classify({cluster1, cluster2}).size());
+}
+
+TEST_F(ClusterClassifierTests, differentBondsWithEqualAttributes)
+{
+    //same cells and bond types but bonds at different positions in a chain
+    auto cluster1 = createGraph(5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {1, 3}});
+    auto cluster2 = createGraph(5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {0, 2}});
+
+    EXPECT_FALSE(ClusterClassifier::isIdentical(cluster1, cluster2));
+}
+
+TEST_F(ClusterClassifierTests, equalHashesAreVerified)
+{
+    //a 6-ring and two triangles cannot be distinguished by Weisfeiler-Lehman refinement
+    auto ring = createGraph(6, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 0}});
+    auto triangles = createGraph(6, {{0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3}});
+
+    EXPECT_EQ(ClusterClassifier::calcStructuralHash(ring), ClusterClassifier::calcStructuralHash(triangles));
+    EXPECT_FALSE(ClusterClassifier::isIdentical(ring, triangles));
+    EXPECT_TRUE(ClusterClassifier::isIdentical(ring, createGraph(6, {{0, 2}, {2, 4}, {4, 1}, {1, 3}, {3, 5}, {5, 0}})));
+
+    auto classes = ClusterClassifier::classify({ring, triangles, ring});
+    ASSERT_EQ(2, classes.size());
+    EXPECT_EQ((std::vector<int>{0, 2}), classes.at(0));
+    EXPECT_EQ((std::vector<int>{1}), classes.at(1));
+}
+
+TEST_F(ClusterClassifierTests, classify)
+{
+    std::vector<ClusterDescription> clusters;
+    for (int i = 0; i < 30; ++i) {
+        switch (i % 3) {
+        case 0:
+            clusters.emplace_back(createHex(3, {toFloat(i * 10), 0.0f}));
+            break;
+        case 1:
+            clusters.emplace_back(toCluster(DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(3).height(4))));
+            break;
+        default:
+            //a rotated rectangle is identical as long as the colors match
+            clusters.emplace_back(toCluster(DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(4).height(3).color(i % 2))));
+            break;
+        }
+    }
+
+    auto classes = ClusterClassifier::classify(clusters);
+
+    ASSERT_EQ(3, classes.size());
+    EXPECT_EQ(10, classes.at(0).size());
+    EXPECT_EQ(15, classes.at(1).size());
+    EXPECT_EQ(5, classes.at(2).size());
+    EXPECT_EQ(0, classes.at(0).front());
+    EXPECT_EQ(1, classes.at(1).front());
+    EXPECT_EQ(5, classes.at(2).front());
+}
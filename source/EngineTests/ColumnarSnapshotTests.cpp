@@ -0,0 +1,74 @@
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/ColumnarSnapshot.h"
+#include "EngineInterface/Descriptions.h"
+
+class ColumnarSnapshotTests : public ::testing::Test
+{
+public:
+    ColumnarSnapshotTests() = default;
+    ~ColumnarSnapshotTests() = default;
+
+protected:
+    std::string getTempFilename(std::string const& name) const { return (std::filesystem::temp_directory_path() / name).string(); }
+};
+
+TEST_F(ColumnarSnapshotTests, serializeAndRead)
+{
+    auto filename = getTempFilename("columnar_snapshot_tests.snapshot");
+    std::vector<uint8_t> genome{1, 2, 3, 4};
+
+    ClusteredDataDescription data;
+    data.addCluster(ClusterDescription().addCells({
+        CellDescription().setId(1).setPos({1.0f, 2.0f}).setEnergy(50.0f).setColor(2).setConnectingCells({ConnectionDescription().setCellId(2).setDistance(1.0f)}),
+        CellDescription().setId(2).setPos({2.0f, 2.0f}).setEnergy(60.0f).setColor(3).setCellFunction(ConstructorDescription().setGenome(genome)),
+    }));
+    data.addCluster(ClusterDescription().addCells({CellDescription().setId(3).setPos({10.0f, 10.0f}).setEnergy(70.0f)}));
+    data.addParticle(ParticleDescription().setId(4).setPos({5.0f, 6.0f}).setEnergy(10.0f).setColor(1));
+
+    ASSERT_TRUE(ColumnarSnapshot::serializeToFile(filename, data));
+
+    ColumnarSnapshot snapshot(filename);
+    ASSERT_EQ(2, snapshot.getNumClusters());
+    ASSERT_EQ(3, snapshot.getNumCells());
+    ASSERT_EQ(1, snapshot.getNumParticles());
+
+    auto clusterCellOffsets = snapshot.getClusterCellOffsets();
+    EXPECT_EQ(0, clusterCellOffsets[0]);
+    EXPECT_EQ(2, clusterCellOffsets[1]);
+    EXPECT_EQ(3, clusterCellOffsets[2]);
+
+    auto energies = snapshot.getCellEnergies();
+    EXPECT_EQ(50.0f, energies[0]);
+    EXPECT_EQ(60.0f, energies[1]);
+    EXPECT_EQ(70.0f, energies[2]);
+    EXPECT_EQ(3, snapshot.getCellColors()[1]);
+    EXPECT_EQ(RealVector2D(10.0f, 10.0f), snapshot.getCellPositions()[2]);
+    EXPECT_EQ(CellFunction_Constructor, snapshot.getCellFunctionTypes()[1]);
+
+    auto connectionOffsets = snapshot.getCellConnectionOffsets();
+    ASSERT_EQ(1, connectionOffsets[1] - connectionOffsets[0]);
+    EXPECT_EQ(2, snapshot.getConnectionCellIds()[connectionOffsets[0]]);
+    EXPECT_EQ(0, connectionOffsets[3] - connectionOffsets[2]);
+
+    EXPECT_TRUE(snapshot.getGenome(0).empty());
+    auto actualGenome = snapshot.getGenome(1);
+    EXPECT_EQ(genome, std::vector<uint8_t>(actualGenome.begin(), actualGenome.end()));
+
+    EXPECT_EQ(4, snapshot.getParticleIds()[0]);
+    EXPECT_EQ(RealVector2D(5.0f, 6.0f), snapshot.getParticlePositions()[0]);
+    EXPECT_EQ(1, snapshot.getParticleColors()[0]);
+}
+
+TEST_F(ColumnarSnapshotTests, readInvalidFile)
+{
+    auto filename = getTempFilename("columnar_snapshot_tests_invalid.snapshot");
+    {
+        std::ofstream stream(filename, std::ios::binary);
+        stream << "no snapshot";
+    }
+    EXPECT_THROW(ColumnarSnapshot snapshot(filename), std::runtime_error);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "Base/IdAllocator.h"
 #include "Base/NumberGenerator.h"
 #include "EngineInterface/DescriptionHelper.h"
 #include "EngineInterface/Descriptions.h"
@@ -107,7 +108,7 @@ TEST_F(DataTransferTests, largeData)
     auto& numberGen = NumberGenerator::getInstance();
     auto addCellAndParticles = [&](DataDescription& data) {
         data.addCell(CellDescription()
-                         .setId(numberGen.getId())
+                         .setId(IdAllocator::getInstance().getId())
                 .setPos({numberGen.getRandomFloat(0.0f, 100.0f), numberGen.getRandomFloat(0.0f, 100.0f)})
                          .setVel({numberGen.getRandomFloat(-1.0f, 1.0f), numberGen.getRandomFloat(-1.0f, 1.0f)})
                         .setEnergy(numberGen.getRandomFloat(0.0f, 100.0f))
@@ -119,7 +120,7 @@ TEST_F(DataTransferTests, largeData)
                          .setLivingState(false)
                          .setOutputBlocked(false));
         data.addParticle(ParticleDescription()
-                             .setId(numberGen.getId())
+                             .setId(IdAllocator::getInstance().getId())
                              .setPos({numberGen.getRandomFloat(0.0f, 100.0f), numberGen.getRandomFloat(0.0f, 100.0f)})
                              .setVel({numberGen.getRandomFloat(-1.0f, 1.0f), numberGen.getRandomFloat(-1.0f, 1.0f)})
                              .setEnergy(numberGen.getRandomFloat(0.0f, 100.0f)));
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include "Base/IdAllocator.h"
+#include "Base/NumberGenerator.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineImpl/DescriptionConverter.h"
+
+class DescriptionConverterTests : public ::testing::Test
+{
+public:
+    DescriptionConverterTests()
+        : _converter(SimulationParameters())
+    {}
+    ~DescriptionConverterTests() = default;
+
+protected:
+    //DataTO with arrays in host memory
+    struct HostDataTO
+    {
+        uint64_t numCells = 0;
+        uint64_t numParticles = 0;
+        uint64_t numAuxiliaryData = 0;
+        std::vector<CellTO> cells;
+        std::vector<ParticleTO> particles;
+        std::vector<uint8_t> auxiliaryData;
+        DataTO dataTO;
+    };
+
+    std::unique_ptr<HostDataTO> convertToTO(ClusteredDataDescription const& data) const
+    {
+        auto arraySizes = _converter.getArraySizes(data);
+        auto result = std::make_unique<HostDataTO>();
+        result->cells.resize(arraySizes.cellArraySize);
+        result->particles.resize(arraySizes.particleArraySize);
+        result->auxiliaryData.resize(arraySizes.auxiliaryDataSize);
+        result->dataTO.numCells = &result->numCells;
+        result->dataTO.numParticles = &result->numParticles;
+        result->dataTO.numAuxiliaryData = &result->numAuxiliaryData;
+        result->dataTO.cells = result->cells.data();
+        result->dataTO.particles = result->particles.data();
+        result->dataTO.auxiliaryData = result->auxiliaryData.data();
+        _converter.convertDescriptionToTO(result->dataTO, data);
+        return result;
+    }
+
+    ClusteredDataDescription createDataWithAuxiliaryData(int numClusters) const
+    {
+        auto result = createData(numClusters);
+        auto& numberGen = NumberGenerator::getInstance();
+        for (auto& cluster : result.clusters) {
+            for (auto& cell : cluster.cells) {
+                switch (numberGen.getRandomInt(3)) {
+                case 0: {
+                    NeuronDescription neuron;
+                    neuron.weights[0][1] = numberGen.getRandomFloat(-1.0f, 1.0f);
+                    neuron.biases[2] = numberGen.getRandomFloat(-1.0f, 1.0f);
+                    cell.setCellFunction(neuron);
+                } break;
+                case 1: {
+                    std::vector<uint8_t> genome(numberGen.getRandomInt(1, 50), static_cast<uint8_t>(cell.id));
+                    cell.setCellFunction(ConstructorDescription().setGenome(genome));
+                } break;
+                default:
+                    cell.metadata.name = "cell" + std::to_string(cell.id);
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    ClusteredDataDescription createData(int numClusters) const
+    {
+        auto& numberGen = NumberGenerator::getInstance();
+        ClusteredDataDescription result;
+        for (int i = 0; i < numClusters; ++i) {
+            auto size = toInt(numberGen.getRandomInt(1, 10));
+            auto rect = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(size).height(size).center(
+                {numberGen.getRandomFloat(0.0f, 1000.0f), numberGen.getRandomFloat(0.0f, 1000.0f)}));
+            result.addCluster(ClusterDescription().addCells(rect.cells));
+        }
+        result.addParticle(ParticleDescription().setId(IdAllocator::getInstance().getId()).setPos({1.0f, 2.0f}));
+        return result;
+    }
+
+    //clusters sorted by smallest cell id and cells sorted by id
+    ClusteredDataDescription getCanonicalForm(ClusteredDataDescription data) const
+    {
+        for (auto& cluster : data.clusters) {
+            std::sort(cluster.cells.begin(), cluster.cells.end(), [](auto const& cell1, auto const& cell2) { return cell1.id < cell2.id; });
+        }
+        std::sort(data.clusters.begin(), data.clusters.end(), [](auto const& cluster1, auto const& cluster2) {
+            return cluster1.cells.front().id < cluster2.cells.front().id;
+        });
+        return data;
+    }
+
+    DescriptionConverter _converter;
+};
+
+TEST_F(DescriptionConverterTests, unionFindEqualsBreadthFirstSearch)
+{
+    auto data = createData(500);
+    auto dataTO = convertToTO(data);
+
+    auto actualData = _converter.convertTOtoClusteredDataDescription(dataTO->dataTO, ClusteringAlgorithm_ParallelUnionFind);
+    auto expectedData = _converter.convertTOtoClusteredDataDescription(dataTO->dataTO, ClusteringAlgorithm_BreadthFirstSearch);
+
+    ASSERT_EQ(500, actualData.clusters.size());
+    EXPECT_TRUE(getCanonicalForm(expectedData) == getCanonicalForm(actualData));
+}
+
+TEST_F(DescriptionConverterTests, unionFindPreservesOrder)
+{
+    auto data = createData(100);
+    auto dataTO = convertToTO(data);
+
+    auto actualData = _converter.convertTOtoClusteredDataDescription(dataTO->dataTO, ClusteringAlgorithm_ParallelUnionFind);
+
+    ASSERT_EQ(data.clusters.size(), actualData.clusters.size());
+    for (size_t i = 0; i < data.clusters.size(); ++i) {
+        ASSERT_EQ(data.clusters.at(i).cells.size(), actualData.clusters.at(i).cells.size());
+        for (size_t j = 0; j < data.clusters.at(i).cells.size(); ++j) {
+            EXPECT_EQ(data.clusters.at(i).cells.at(j).id, actualData.clusters.at(i).cells.at(j).id);
+        }
+    }
+}
+
+TEST_F(DescriptionConverterTests, convertDescriptionToTO_withAuxiliaryData)
+{
+    auto data = createDataWithAuxiliaryData(500);
+    auto dataTO = convertToTO(data);
+
+    EXPECT_EQ(dataTO->auxiliaryData.size(), dataTO->numAuxiliaryData);
+    auto actualData = _converter.convertTOtoClusteredDataDescription(dataTO->dataTO);
+    EXPECT_TRUE(data == actualData);
+}
+
+TEST_F(DescriptionConverterTests, convertDescriptionToTO_appendToExistingData)
+{
+    auto data1 = createDataWithAuxiliaryData(50);
+    auto data2 = createDataWithAuxiliaryData(50);
+    auto data = data1;
+    data.addClusters(data2.clusters);
+    data.addParticles(data2.particles);
+
+    auto dataTO = convertToTO(data);
+    auto combinedDataTO = convertToTO(data1);
+    auto arraySizes = _converter.getArraySizes(data2);
+    combinedDataTO->cells.resize(combinedDataTO->cells.size() + arraySizes.cellArraySize);
+    combinedDataTO->particles.resize(combinedDataTO->particles.size() + arraySizes.particleArraySize);
+    combinedDataTO->auxiliaryData.resize(combinedDataTO->auxiliaryData.size() + arraySizes.auxiliaryDataSize);
+    combinedDataTO->dataTO.cells = combinedDataTO->cells.data();
+    combinedDataTO->dataTO.particles = combinedDataTO->particles.data();
+    combinedDataTO->dataTO.auxiliaryData = combinedDataTO->auxiliaryData.data();
+    _converter.convertDescriptionToTO(combinedDataTO->dataTO, data2);
+
+    ASSERT_EQ(dataTO->numCells, combinedDataTO->numCells);
+    ASSERT_EQ(dataTO->numParticles, combinedDataTO->numParticles);
+    ASSERT_EQ(dataTO->numAuxiliaryData, combinedDataTO->numAuxiliaryData);
+    EXPECT_EQ(dataTO->auxiliaryData, combinedDataTO->auxiliaryData);
+    EXPECT_TRUE(
+        _converter.convertTOtoClusteredDataDescription(dataTO->dataTO) == _converter.convertTOtoClusteredDataDescription(combinedDataTO->dataTO));
+}
+
+TEST_F(DescriptionConverterTests, convertTOtoClusteredDataDescription_sharesEqualGenomes)
+{
+    auto data = createData(20);
+    std::vector<uint8_t> genome(300, 7);
+    for (auto& cluster : data.clusters) {
+        for (auto& cell : cluster.cells) {
+            cell.setCellFunction(ConstructorDescription().setGenome(genome));
+        }
+    }
+    auto dataTO = convertToTO(data);
+
+    auto actualData = _converter.convertTOtoClusteredDataDescription(dataTO->dataTO);
+
+    auto const& firstGenome = std::get<ConstructorDescription>(*actualData.clusters.front().cells.front().cellFunction).genome;
+    EXPECT_EQ(genome, firstGenome);
+    for (auto const& cluster : actualData.clusters) {
+        for (auto const& cell : cluster.cells) {
+            EXPECT_TRUE(std::get<ConstructorDescription>(*cell.cellFunction).genome.isSharedWith(firstGenome));
+        }
+    }
+}
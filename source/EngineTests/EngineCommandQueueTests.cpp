@@ -0,0 +1,138 @@
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "EngineImpl/EngineCommandQueue.h"
+
+class EngineCommandQueueTests : public ::testing::Test
+{
+public:
+    EngineCommandQueueTests() = default;
+    ~EngineCommandQueueTests() = default;
+
+protected:
+    static ApplyForceCommand createForce(float radius) { return ApplyForceCommand{{0, 0}, {1, 1}, {1, 0}, radius}; }
+
+    static SetSimulationParametersCommand createParameters(float timestepSize)
+    {
+        auto parameters = std::make_shared<SimulationParameters>();
+        parameters->timestepSize = timestepSize;
+        return SetSimulationParametersCommand{parameters};
+    }
+
+    static ShallowUpdateSelectedObjectsCommand createShallowUpdate(float posDeltaX, bool considerClusters = true)
+    {
+        ShallowUpdateSelectionData updateData;
+        updateData.considerClusters = considerClusters;
+        updateData.posDeltaX = posDeltaX;
+        return ShallowUpdateSelectedObjectsCommand{updateData};
+    }
+};
+
+TEST_F(EngineCommandQueueTests, popInOrderOfPush)
+{
+    EngineCommandQueue queue;
+    EXPECT_TRUE(queue.isEmpty());
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(queue.tryPush(createForce(toFloat(i))));
+    }
+    EXPECT_FALSE(queue.isEmpty());
+
+    auto commands = queue.popAll();
+    ASSERT_EQ(10, commands.size());
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(toFloat(i), std::get<ApplyForceCommand>(commands[i]).radius);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(EngineCommandQueueTests, fullQueue)
+{
+    EngineCommandQueue queue(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(createForce(toFloat(i))));
+    }
+    EngineCommand command = AddAndSelectDataCommand{DataDescription().addCell(CellDescription().setId(1))};
+    EXPECT_FALSE(queue.tryPush(std::move(command)));
+    EXPECT_EQ(1, std::get<AddAndSelectDataCommand>(command).data.cells.size());
+
+    EXPECT_EQ(4, queue.popAll().size());
+    EXPECT_TRUE(queue.tryPush(std::move(command)));
+    EXPECT_EQ(1, queue.popAll().size());
+}
+
+TEST_F(EngineCommandQueueTests, coalesceParameterUpdates)
+{
+    EngineCommandQueue queue;
+    queue.tryPush(createParameters(1.0f));
+    queue.tryPush(SetGpuSettingsCommand{GpuSettings{.numBlocks = 1}});
+    queue.tryPush(createForce(1.0f));
+    queue.tryPush(createParameters(2.0f));
+    queue.tryPush(createForce(2.0f));
+    queue.tryPush(SetGpuSettingsCommand{GpuSettings{.numBlocks = 2}});
+
+    auto commands = queue.popAll();
+    ASSERT_EQ(4, commands.size());
+    EXPECT_EQ(1.0f, std::get<ApplyForceCommand>(commands[0]).radius);
+    EXPECT_EQ(2.0f, std::get<SetSimulationParametersCommand>(commands[1]).parameters->timestepSize);
+    EXPECT_EQ(2.0f, std::get<ApplyForceCommand>(commands[2]).radius);
+    EXPECT_EQ(2, std::get<SetGpuSettingsCommand>(commands[3]).gpuSettings.numBlocks);
+}
+
+TEST_F(EngineCommandQueueTests, coalesceAdjacentSelectionEdits)
+{
+    EngineCommandQueue queue;
+    queue.tryPush(createShallowUpdate(1.0f));
+    queue.tryPush(createShallowUpdate(2.0f));
+    queue.tryPush(createShallowUpdate(4.0f, false));
+    queue.tryPush(SetSelectionCommand{{0, 0}, {1, 1}});
+    queue.tryPush(SetSelectionCommand{{0, 0}, {2, 2}});
+    queue.tryPush(createShallowUpdate(8.0f));
+    queue.tryPush(RemoveSelectedObjectsCommand{true});
+    queue.tryPush(createShallowUpdate(16.0f));
+
+    auto commands = queue.popAll();
+    ASSERT_EQ(6, commands.size());
+    EXPECT_EQ(3.0f, std::get<ShallowUpdateSelectedObjectsCommand>(commands[0]).updateData.posDeltaX);
+    EXPECT_EQ(4.0f, std::get<ShallowUpdateSelectedObjectsCommand>(commands[1]).updateData.posDeltaX);
+    EXPECT_EQ(2.0f, std::get<SetSelectionCommand>(commands[2]).endPos.x);
+    EXPECT_EQ(8.0f, std::get<ShallowUpdateSelectedObjectsCommand>(commands[3]).updateData.posDeltaX);
+    EXPECT_TRUE(std::holds_alternative<RemoveSelectedObjectsCommand>(commands[4]));
+    EXPECT_EQ(16.0f, std::get<ShallowUpdateSelectedObjectsCommand>(commands[5]).updateData.posDeltaX);
+}
+
+TEST_F(EngineCommandQueueTests, concurrentProducers)
+{
+    EngineCommandQueue queue(64);
+    int const numProducers = 4;
+    int const numCommandsPerProducer = 10000;
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < numProducers; ++producer) {
+        producers.emplace_back([&, producer] {
+            for (int i = 0; i < numCommandsPerProducer; ++i) {
+                EngineCommand command = createForce(toFloat(producer * numCommandsPerProducer + i));
+                while (!queue.tryPush(std::move(command))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    //commands of each producer arrive in order
+    std::vector<int> nextIndices(numProducers, 0);
+    int numReceived = 0;
+    while (numReceived < numProducers * numCommandsPerProducer) {
+        for (auto const& command : queue.popAll()) {
+            auto value = toInt(std::get<ApplyForceCommand>(command).radius);
+            auto producer = value / numCommandsPerProducer;
+            ASSERT_EQ(nextIndices[producer], value % numCommandsPerProducer);
+            ++nextIndices[producer];
+            ++numReceived;
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
@@ -0,0 +1,141 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "EngineImpl/EngineQueryQueue.h"
+#include "EngineImpl/EngineWorkerAccess.h"
+
+class EngineQueryQueueTests : public ::testing::Test
+{
+public:
+    EngineQueryQueueTests() = default;
+    ~EngineQueryQueueTests() { stopWorker(); }
+
+protected:
+    //same loop structure as EngineWorker::runThreadLoop with a stub in place of the CUDA simulation
+    void runThreadLoop()
+    {
+        _workerThreadId = std::this_thread::get_id();
+        while (!_isShutdown.load()) {
+            if (_access.isWorkerAccess() && _isSimulationRunning.load()) {
+                ++_timestep;
+            }
+            _numCaptures += _queries.process();
+            _access.waitForWorkAndGrantAccess([this] { return _isShutdown.load() || _isSimulationRunning.load() || !_queries.isEmpty(); });
+        }
+    }
+
+    void startWorker(bool running)
+    {
+        _isSimulationRunning = running;
+        _thread = std::thread(&EngineQueryQueueTests::runThreadLoop, this);
+    }
+
+    void stopWorker()
+    {
+        if (_thread.joinable()) {
+            _isShutdown = true;
+            _access.notifyWorker();
+            _thread.join();
+        }
+    }
+
+    //captures the time step on the worker thread and returns it from the conversion
+    std::shared_future<uint64_t> queryTimestep(EngineQueryKey const& key)
+    {
+        auto result = _queries.enqueue<uint64_t>(key, [this] {
+            EXPECT_EQ(_workerThreadId, std::this_thread::get_id());
+            auto timestep = _timestep.load();
+            return [this, timestep] {
+                EXPECT_NE(_workerThreadId, std::this_thread::get_id());
+                return timestep;
+            };
+        });
+        _access.notifyWorker();
+        return result;
+    }
+
+    EngineWorkerAccess _access;
+    EngineQueryQueue _queries;
+    std::atomic<uint64_t> _timestep{0};
+    std::atomic<int> _numCaptures{0};
+    std::atomic<bool> _isSimulationRunning{false};
+    std::atomic<bool> _isShutdown{false};
+    std::thread::id _workerThreadId;
+    std::thread _thread;
+};
+
+TEST_F(EngineQueryQueueTests, queryWhilePaused)
+{
+    startWorker(false);
+    _timestep = 5;
+    EXPECT_EQ(5, queryTimestep({EngineQueryType_Statistics}).get());
+    stopWorker();
+    EXPECT_EQ(1, _numCaptures.load());
+}
+
+TEST_F(EngineQueryQueueTests, queryWhileRunning)
+{
+    startWorker(true);
+    auto timestep1 = queryTimestep({EngineQueryType_Statistics}).get();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto timestep2 = queryTimestep({EngineQueryType_Statistics}).get();
+    EXPECT_LT(timestep1, timestep2);
+}
+
+TEST_F(EngineQueryQueueTests, equalQueriesAreCoalesced)
+{
+    std::vector<std::shared_future<uint64_t>> results;
+    for (int i = 0; i < 10; ++i) {
+        results.emplace_back(queryTimestep({EngineQueryType_InspectedSimulationData, {1, 2}}));
+        results.emplace_back(queryTimestep({EngineQueryType_InspectedSimulationData, {2, 1}}));
+        results.emplace_back(queryTimestep({EngineQueryType_Statistics}));
+    }
+    startWorker(true);
+    for (auto const& result : results) {
+        result.wait();
+    }
+    stopWorker();
+    EXPECT_EQ(3, _numCaptures.load());
+}
+
+TEST_F(EngineQueryQueueTests, queriesDuringProcessingBelongToNextBatch)
+{
+    std::shared_future<uint64_t> nestedResult;
+    auto result = _queries.enqueue<uint64_t>({EngineQueryType_Statistics}, [&] {
+        nestedResult = _queries.enqueue<uint64_t>({EngineQueryType_Statistics}, [] { return [] { return uint64_t(2); }; });
+        return [] { return uint64_t(1); };
+    });
+
+    EXPECT_EQ(1, _queries.process());
+    EXPECT_FALSE(_queries.isEmpty());
+    EXPECT_EQ(1, _queries.process());
+    EXPECT_TRUE(_queries.isEmpty());
+    EXPECT_EQ(1, result.get());
+    EXPECT_EQ(2, nestedResult.get());
+}
+
+TEST_F(EngineQueryQueueTests, exceptionsArePropagated)
+{
+    auto captureFailure = _queries.enqueue<int>({EngineQueryType_SimulationData}, []() -> EngineQueryQueue::Conversion<int> {
+        throw std::runtime_error("capture failed");
+    });
+    auto conversionFailure = _queries.enqueue<int>({EngineQueryType_Statistics}, [] {
+        return []() -> int { throw std::runtime_error("conversion failed"); };
+    });
+    _queries.process();
+
+    EXPECT_THROW(captureFailure.get(), std::runtime_error);
+    EXPECT_THROW(conversionFailure.get(), std::runtime_error);
+}
+
+TEST_F(EngineQueryQueueTests, clear)
+{
+    auto result = queryTimestep({EngineQueryType_Statistics});
+    _queries.clear();
+
+    EXPECT_TRUE(_queries.isEmpty());
+    EXPECT_THROW(result.get(), std::future_error);
+}
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "EngineImpl/EngineWorkerAccess.h"
+
+class EngineWorkerAccessTests : public ::testing::Test
+{
+public:
+    EngineWorkerAccessTests() = default;
+    ~EngineWorkerAccessTests() = default;
+
+protected:
+    //stub in place of the CUDA simulation
+    struct StubSimulation
+    {
+        std::atomic<uint64_t> timestep{0};
+
+        void calcTimestep() { ++timestep; }
+    };
+
+    //same loop structure as EngineWorker::runThreadLoop
+    void runThreadLoop()
+    {
+        while (!_isShutdown.load()) {
+            if (_access.isWorkerAccess() && _isSimulationRunning.load()) {
+                _simulation.calcTimestep();
+            }
+            ++_numLoopIterations;
+            _access.waitForWorkAndGrantAccess([this] { return _isShutdown.load() || _isSimulationRunning.load(); });
+        }
+    }
+
+    void startWorker(bool running)
+    {
+        _isSimulationRunning = running;
+        _thread = std::thread(&EngineWorkerAccessTests::runThreadLoop, this);
+    }
+
+    void stopWorker()
+    {
+        _isShutdown = true;
+        _access.notifyWorker();
+        _thread.join();
+    }
+
+    void setSimulationRunning(bool value)
+    {
+        _isSimulationRunning = value;
+        _access.notifyWorker();
+    }
+
+    EngineWorkerAccess _access;
+    StubSimulation _simulation;
+    std::atomic<bool> _isSimulationRunning{false};
+    std::atomic<bool> _isShutdown{false};
+    std::atomic<uint64_t> _numLoopIterations{0};
+    std::thread _thread;
+};
+
+TEST_F(EngineWorkerAccessTests, exclusiveAccessWhileRunning)
+{
+    startWorker(true);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(_access.acquire(std::chrono::seconds(5)));
+        auto timestep = _simulation.timestep.load();
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        EXPECT_EQ(timestep, _simulation.timestep.load());
+        _access.release();
+    }
+    stopWorker();
+}
+
+TEST_F(EngineWorkerAccessTests, accessWhilePaused)
+{
+    startWorker(false);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(_access.acquire(std::chrono::seconds(5)));
+        _access.release();
+    }
+    stopWorker();
+    EXPECT_EQ(0, _simulation.timestep.load());
+}
+
+TEST_F(EngineWorkerAccessTests, timeoutWithoutWorker)
+{
+    EXPECT_FALSE(_access.acquire(std::chrono::milliseconds(10)));
+    EXPECT_TRUE(_access.isWorkerAccess());
+}
+
+TEST_F(EngineWorkerAccessTests, grantAccessDuringWait)
+{
+    std::thread waitingThread([this] { _access.waitAndGrantAccess(std::chrono::milliseconds(500)); });
+    EXPECT_TRUE(_access.acquire(std::chrono::seconds(5)));
+    _access.release();
+    waitingThread.join();
+}
+
+TEST_F(EngineWorkerAccessTests, idleWorkerSleeps)
+{
+    startWorker(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    setSimulationRunning(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    auto numLoopIterations = _numLoopIterations.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_GE(numLoopIterations + 1, _numLoopIterations.load());
+
+    setSimulationRunning(true);
+    auto timestep = _simulation.timestep.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_LT(timestep, _simulation.timestep.load());
+    stopWorker();
+}
+
+TEST_F(EngineWorkerAccessTests, exclusiveAccessForConcurrentRequesters)
+{
+    startWorker(true);
+    std::atomic<int> numAccessHolders{0};
+    std::atomic<int> maxNumAccessHolders{0};
+    std::atomic<bool> isTimestepChangedDuringAccess{false};
+    auto requestAccess = [&] {
+        for (int i = 0; i < 200; ++i) {
+            ASSERT_TRUE(_access.acquire(std::chrono::seconds(5)));
+            auto numHolders = ++numAccessHolders;
+            maxNumAccessHolders = std::max(maxNumAccessHolders.load(), numHolders);
+            auto timestep = _simulation.timestep.load();
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+            if (timestep != _simulation.timestep.load()) {
+                isTimestepChangedDuringAccess = true;
+            }
+            --numAccessHolders;
+            _access.release();
+        }
+    };
+    std::thread requester1(requestAccess);
+    std::thread requester2(requestAccess);
+    requester1.join();
+    requester2.join();
+    stopWorker();
+
+    EXPECT_EQ(1, maxNumAccessHolders.load());
+    EXPECT_FALSE(isTimestepChangedDuringAccess.load());
+}
+
+TEST_F(EngineWorkerAccessTests, timeoutWhileOtherRequesterHasAccess)
+{
+    startWorker(true);
+    ASSERT_TRUE(_access.acquire(std::chrono::seconds(5)));
+    std::thread otherRequester([this] {
+        EXPECT_FALSE(_access.acquire(std::chrono::milliseconds(10)));
+    });
+    otherRequester.join();
+    EXPECT_FALSE(_access.isWorkerAccess());
+    _access.release();
+
+    EXPECT_TRUE(_access.acquire(std::chrono::seconds(5)));
+    _access.release();
+    stopWorker();
+}
@@ -0,0 +1,140 @@
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineImpl/EngineWorker.h"
+#include "EngineImpl/HostSimulationBackend.h"
+
+class EngineWorkerTests : public ::testing::Test
+{
+public:
+    EngineWorkerTests()
+    {
+        GeneralSettings generalSettings{100, 100};
+        _worker.newSimulation(0, generalSettings, SimulationParameters(), [](uint64_t timestep, Settings const& settings) {
+            return std::make_shared<_HostSimulationBackend>(timestep, settings, std::chrono::microseconds(100));
+        });
+        _thread = std::thread(&EngineWorker::runThreadLoop, &_worker);
+    }
+
+    ~EngineWorkerTests()
+    {
+        _worker.beginShutdown();
+        _thread.join();
+        _worker.endShutdown();
+    }
+
+protected:
+    std::vector<uint64_t> getSortedCellIds(DataDescription const& data) const
+    {
+        std::vector<uint64_t> result;
+        for (auto const& cell : data.cells) {
+            result.emplace_back(cell.id);
+        }
+        std::ranges::sort(result);
+        return result;
+    }
+
+    EngineWorker _worker;
+    std::thread _thread;
+};
+
+TEST_F(EngineWorkerTests, runAndPause)
+{
+    _worker.runSimulation();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    _worker.pauseSimulation();
+
+    auto timestep = _worker.getCurrentTimestep();
+    EXPECT_GT(timestep, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(timestep, _worker.getCurrentTimestep());
+}
+
+TEST_F(EngineWorkerTests, tpsAfterPause)
+{
+    _worker.runSimulation();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_GT(_worker.getTps(), 0.0f);
+
+    _worker.pauseSimulation();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(0.0f, _worker.getTps());
+}
+
+TEST_F(EngineWorkerTests, drawWithSyncSimulationWithRendering)
+{
+    _worker.setSyncSimulationWithRendering(true);
+    _worker.runSimulation();
+
+    auto timestep = _worker.getCurrentTimestep();
+    EXPECT_NO_THROW(_worker.tryDrawVectorGraphics({0.0f, 0.0f}, {100.0f, 100.0f}, {100, 100}, 1.0));
+    EXPECT_EQ(timestep + _worker.getSyncSimulationWithRenderingRatio(), _worker.getCurrentTimestep());
+    _worker.pauseSimulation();
+}
+
+TEST_F(EngineWorkerTests, setAndGetSimulationData)
+{
+    auto data = DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(3).center({50.0f, 50.0f}));
+    _worker.setSimulationData(data);
+
+    auto actualData = _worker.getSimulationData({0, 0}, {100, 100});
+    EXPECT_EQ(getSortedCellIds(data), getSortedCellIds(actualData));
+}
+
+TEST_F(EngineWorkerTests, asyncCommandsPrecedeAccess)
+{
+    _worker.runSimulation();
+    auto data = DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(3).center({50.0f, 50.0f}));
+    _worker.addAndSelectSimulationData_async(data);
+    for (int i = 0; i < 10; ++i) {
+        ShallowUpdateSelectionData updateData;
+        updateData.velDeltaX = 0.01f;
+        _worker.shallowUpdateSelectedObjects_async(updateData);
+    }
+
+    auto selection = _worker.getSelectionShallowData();
+    EXPECT_EQ(toInt(data.cells.size()), selection.numCells);
+    EXPECT_NEAR(0.1f, selection.centerVelX, 1e-5f);
+}
+
+TEST_F(EngineWorkerTests, asyncCommandsFromConcurrentThreads)
+{
+    auto data = DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(3).center({50.0f, 50.0f}));
+    _worker.addAndSelectSimulationData(data);
+    _worker.runSimulation();
+
+    //exceeds the queue capacity, so that commands are also executed synchronously by the pushing threads
+    auto pushCommands = [this] {
+        for (int i = 0; i < 3000; ++i) {
+            ShallowUpdateSelectionData updateData;
+            updateData.velDeltaX = 0.0001f;
+            _worker.shallowUpdateSelectedObjects_async(updateData);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back(pushCommands);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto selection = _worker.getSelectionShallowData();
+    EXPECT_NEAR(1.2f, selection.centerVelX, 1e-3f);
+}
+
+TEST_F(EngineWorkerTests, publishedFrames)
+{
+    _worker.setInspectedEntityIdsForPublishing({});
+    _worker.runSimulation();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    _worker.pauseSimulation();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto const& frame = _worker.getPublishedFrame();
+    EXPECT_GT(frame.version, 0);
+    EXPECT_EQ(_worker.getCurrentTimestep(), frame.timestep);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "Base/ThreadPool.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeBuffer.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+
+class GenomeBufferTests : public ::testing::Test
+{
+public:
+    GenomeBufferTests() = default;
+    ~GenomeBufferTests() = default;
+
+protected:
+    std::vector<uint8_t> createGenome(int size, uint8_t seed) const
+    {
+        std::vector<uint8_t> result(size);
+        for (int i = 0; i < size; ++i) {
+            result[i] = static_cast<uint8_t>(seed + i * 31);
+        }
+        return result;
+    }
+};
+
+TEST_F(GenomeBufferTests, equalContentIsShared)
+{
+    GenomeBuffer genome1(createGenome(200, 1));
+    GenomeBuffer genome2(createGenome(200, 1));
+    GenomeBuffer genome3(createGenome(200, 2));
+    GenomeBuffer genome4(std::span<uint8_t const>(createGenome(200, 1)));
+
+    EXPECT_TRUE(genome1.isSharedWith(genome2));
+    EXPECT_TRUE(genome1.isSharedWith(genome4));
+    EXPECT_FALSE(genome1.isSharedWith(genome3));
+    EXPECT_EQ(genome1, genome2);
+    EXPECT_NE(genome1, genome3);
+    EXPECT_EQ(createGenome(200, 1), genome1.getData());
+    EXPECT_TRUE(GenomeBuffer().isSharedWith(GenomeBuffer(std::vector<uint8_t>())));
+}
+
+TEST_F(GenomeBufferTests, orderingEqualsByteOrdering)
+{
+    std::vector<std::vector<uint8_t>> genomes = {{}, {1}, {1, 2}, {1, 3}, {2}, {0, 5, 5}};
+    for (auto const& genome1 : genomes) {
+        for (auto const& genome2 : genomes) {
+            EXPECT_EQ(genome1 <=> genome2, GenomeBuffer(genome1) <=> GenomeBuffer(genome2));
+        }
+    }
+}
+
+TEST_F(GenomeBufferTests, copyOnWrite)
+{
+    GenomeBuffer genome(createGenome(100, 3));
+    auto copiedGenome = genome;
+    EXPECT_TRUE(copiedGenome.isSharedWith(genome));
+
+    auto bytes = copiedGenome.getData();
+    bytes.at(10) = 0xff;
+    copiedGenome = std::move(bytes);
+
+    EXPECT_FALSE(copiedGenome.isSharedWith(genome));
+    EXPECT_EQ(createGenome(100, 3), genome.getData());
+    EXPECT_EQ(0xff, copiedGenome[10]);
+}
+
+TEST_F(GenomeBufferTests, unusedBuffersAreReleased)
+{
+    auto numBuffersBefore = GenomeBuffer::getNumDistinctBuffers();
+    {
+        std::vector<GenomeBuffer> genomes;
+        for (int i = 0; i < 100; ++i) {
+            genomes.emplace_back(createGenome(50, static_cast<uint8_t>(i)));
+            genomes.emplace_back(createGenome(50, static_cast<uint8_t>(i)));
+        }
+        EXPECT_EQ(numBuffersBefore + 100, GenomeBuffer::getNumDistinctBuffers());
+    }
+    EXPECT_EQ(numBuffersBefore, GenomeBuffer::getNumDistinctBuffers());
+}
+
+TEST_F(GenomeBufferTests, concurrentCreation)
+{
+    auto numGenomes = 10000;
+    std::vector<GenomeBuffer> genomes(numGenomes);
+    ThreadPool::getInstance().parallelFor(
+        numGenomes,
+        [&](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                genomes[i] = createGenome(64, static_cast<uint8_t>(i % 10));
+            }
+        },
+        16);
+
+    for (int i = 0; i < numGenomes; ++i) {
+        EXPECT_TRUE(genomes[i].isSharedWith(genomes[i % 10]));
+        EXPECT_EQ(createGenome(64, static_cast<uint8_t>(i % 10)), genomes[i].getData());
+    }
+}
+
+TEST_F(GenomeBufferTests, randomizeGenomeColors_keepsClonesShared)
+{
+    GenomeDescription genomeDesc;
+    genomeDesc.cells = std::vector<CellGenomeDescription>(5, CellGenomeDescription().setColor(0));
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(genomeDesc);
+
+    auto rect = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(5).height(5));
+    for (auto& cell : rect.cells) {
+        cell.setCellFunction(ConstructorDescription().setGenome(genome));
+    }
+    ClusteredDataDescription data;
+    data.addCluster(ClusterDescription().addCells(rect.cells));
+
+    DescriptionHelper::randomizeGenomeColors(data, {3}, 0);
+
+    auto const& firstGenome = std::get<ConstructorDescription>(*data.clusters.front().cells.front().cellFunction).genome;
+    for (auto const& node : GenomeDescriptionConverter::convertBytesToDescription(firstGenome).cells) {
+        EXPECT_EQ(3, node.color);
+    }
+    for (auto const& cell : data.clusters.front().cells) {
+        EXPECT_TRUE(std::get<ConstructorDescription>(*cell.cellFunction).genome.isSharedWith(firstGenome));
+    }
+}
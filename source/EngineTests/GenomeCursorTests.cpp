@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include "Base/NumberGenerator.h"
+#include "EngineInterface/GenomeBuffer.h"
+#include "EngineInterface/GenomeConstants.h"
+#include "EngineInterface/GenomeCursor.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/GenomeNodeIndex.h"
+
+class GenomeCursorTests : public ::testing::Test
+{
+public:
+    GenomeCursorTests() = default;
+    ~GenomeCursorTests() = default;
+
+protected:
+    std::vector<uint8_t> createNestedGenome() const
+    {
+        auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells(
+            {CellGenomeDescription().setCellFunction(NerveGenomeDescription()), CellGenomeDescription().setCellFunction(SensorGenomeDescription())}));
+        return GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({
+            CellGenomeDescription().setCellFunction(NeuronGenomeDescription()),
+            CellGenomeDescription().setCellFunction(ConstructorGenomeDescription().setGenome(subGenome)),
+            CellGenomeDescription().setCellFunction(InjectorGenomeDescription().setMakeGenomeCopy()),
+            CellGenomeDescription(),
+        }));
+    }
+
+    std::vector<uint8_t> createRandomBytes(int size) const
+    {
+        auto& numberGen = NumberGenerator::getInstance();
+        std::vector<uint8_t> result(size);
+        for (auto& byte : result) {
+            byte = static_cast<uint8_t>(numberGen.getRandomInt(256));
+        }
+        return result;
+    }
+};
+
+TEST_F(GenomeCursorTests, nodes)
+{
+    auto genome = createNestedGenome();
+
+    std::vector<GenomeNode> nodes;
+    for (GenomeCursor cursor(genome); !cursor.isAtEnd(); cursor.next()) {
+        nodes.emplace_back(cursor.getNode());
+    }
+
+    ASSERT_EQ(4, nodes.size());
+    EXPECT_EQ(CellFunction_Neuron, nodes.at(0).cellFunction);
+    EXPECT_EQ(CellFunction_Constructor, nodes.at(1).cellFunction);
+    EXPECT_EQ(CellFunction_Injector, nodes.at(2).cellFunction);
+    EXPECT_EQ(CellFunction_None, nodes.at(3).cellFunction);
+    EXPECT_EQ(Const::GenomeHeaderSize, nodes.at(0).address);
+    EXPECT_EQ(Const::CellBasicBytes + Const::NeuronBytes, nodes.at(0).size);
+    EXPECT_EQ(Const::CellBasicBytes + Const::InjectorFixedBytes + 1, nodes.at(2).size);
+    EXPECT_EQ(Const::CellBasicBytes, nodes.at(3).size);
+    for (int i = 1; i < 4; ++i) {
+        EXPECT_EQ(nodes.at(i - 1).address + nodes.at(i - 1).size, nodes.at(i).address);
+        EXPECT_EQ(i, nodes.at(i).nodeIndex);
+    }
+    EXPECT_EQ(genome.size(), nodes.back().address + nodes.back().size);
+
+    EXPECT_TRUE(nodes.at(1).hasSubGenome);
+    EXPECT_FALSE(nodes.at(2).hasSubGenome);
+    auto subGenome = std::get<std::vector<uint8_t>>(
+        std::get<ConstructorGenomeDescription>(*GenomeDescriptionConverter::convertBytesToDescription(genome).cells.at(1).cellFunction).genome);
+    EXPECT_TRUE(std::ranges::equal(subGenome, nodes.at(1).subGenome));
+}
+
+TEST_F(GenomeCursorTests, forEachNodeRecursively)
+{
+    auto genome = createNestedGenome();
+
+    std::vector<std::pair<CellFunction, int>> functionsAndDepths;
+    GenomeCursor::forEachNodeRecursively(genome, [&](GenomeNode const& node, int depth) { functionsAndDepths.emplace_back(node.cellFunction, depth); });
+
+    std::vector<std::pair<CellFunction, int>> expected{
+        {CellFunction_Neuron, 0}, {CellFunction_Constructor, 0}, {CellFunction_Nerve, 1}, {CellFunction_Sensor, 1}, {CellFunction_Injector, 0}, {CellFunction_None, 0}};
+    EXPECT_EQ(expected, functionsAndDepths);
+    EXPECT_EQ(6, GenomeDescriptionConverter::getNumNodesRecursively(genome));
+}
+
+TEST_F(GenomeCursorTests, truncatedGenome)
+{
+    auto genome = createNestedGenome();
+    for (int size = 0; size <= toInt(genome.size()); ++size) {
+        std::vector<uint8_t> truncatedGenome(genome.begin(), genome.begin() + size);
+        auto numNodes = 0;
+        for (GenomeCursor cursor(truncatedGenome); !cursor.isAtEnd(); cursor.next()) {
+            EXPECT_LE(cursor.getNode().address + cursor.getNode().size, size);
+            ++numNodes;
+        }
+        EXPECT_EQ(GenomeDescriptionConverter::convertBytesToDescription(truncatedGenome).cells.size(), numNodes);
+    }
+}
+
+TEST_F(GenomeCursorTests, nodeIndex_randomBytes)
+{
+    for (int i = 0; i < 100; ++i) {
+        auto genome = createRandomBytes(NumberGenerator::getInstance().getRandomInt(0, 500));
+        GenomeNodeIndex nodeIndex(genome);
+
+        auto description = GenomeDescriptionConverter::convertBytesToDescription(genome);
+        EXPECT_EQ(description.cells.size(), nodeIndex.getNumNodes());
+        EXPECT_EQ(GenomeDescriptionConverter::getNumNodesRecursively(genome), nodeIndex.getNumNodesRecursively());
+        for (int address = 0; address <= toInt(genome.size()) + 1; ++address) {
+            EXPECT_EQ(GenomeDescriptionConverter::convertNodeAddressToNodeIndex(genome, address), nodeIndex.convertNodeAddressToNodeIndex(address));
+        }
+        for (int index = 0; index <= nodeIndex.getNumNodes() + 1; ++index) {
+            EXPECT_EQ(GenomeDescriptionConverter::convertNodeIndexToNodeAddress(genome, index), nodeIndex.convertNodeIndexToNodeAddress(index));
+        }
+    }
+}
+
+TEST_F(GenomeCursorTests, nodeIndex_sharedByGenomeBuffers)
+{
+    GenomeBuffer genome1(createNestedGenome());
+    GenomeBuffer genome2(createNestedGenome());
+
+    EXPECT_EQ(&genome1.getNodeIndex(), &genome2.getNodeIndex());
+    EXPECT_EQ(4, GenomeDescriptionConverter::convertNodeAddressToNodeIndex(genome1, toInt(genome1.size())));
+    EXPECT_EQ(Const::GenomeHeaderSize, GenomeDescriptionConverter::convertNodeIndexToNodeAddress(genome1, 0));
+    EXPECT_EQ(6, GenomeDescriptionConverter::getNumNodesRecursively(genome1));
+}
@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Base/IdAllocator.h"
+
+class IdAllocatorTests : public ::testing::Test
+{
+public:
+    IdAllocatorTests() = default;
+    ~IdAllocatorTests() = default;
+
+protected:
+    IdAllocator _idAllocator;
+};
+
+TEST_F(IdAllocatorTests, uniqueIdsAcrossThreads)
+{
+    auto constexpr NumThreads = 8;
+    auto constexpr NumIdsPerThread = 10000;
+
+    std::vector<std::vector<uint64_t>> idsByThread(NumThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < NumIdsPerThread; ++j) {
+                idsByThread[i].emplace_back(_idAllocator.getId());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<uint64_t> ids;
+    for (auto const& threadIds : idsByThread) {
+        EXPECT_TRUE(std::is_sorted(threadIds.begin(), threadIds.end()));
+        ids.insert(ids.end(), threadIds.begin(), threadIds.end());
+    }
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids.end(), std::adjacent_find(ids.begin(), ids.end()));
+    for (auto const& id : ids) {
+        EXPECT_TRUE(IdAllocator::isHostId(id));
+    }
+}
+
+TEST_F(IdAllocatorTests, reserveIds)
+{
+    auto id = _idAllocator.getId();
+    auto firstId = _idAllocator.reserveIds(100);
+    auto nextId = _idAllocator.reserveIds(1);
+
+    EXPECT_NE(id, firstId);
+    EXPECT_EQ(firstId + 100, nextId);
+}
+
+TEST_F(IdAllocatorTests, resync)
+{
+    auto id = _idAllocator.getId();
+    auto loadedId = id + 5000;
+
+    _idAllocator.resync(loadedId);
+    EXPECT_LT(loadedId, _idAllocator.getId());
+    EXPECT_LT(loadedId, _idAllocator.reserveIds(10));
+}
+
+TEST_F(IdAllocatorTests, resync_idInsideReservedBlock)
+{
+    auto id = _idAllocator.getId();
+    auto loadedId = id + 5;
+
+    _idAllocator.resync(loadedId);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_LT(loadedId, _idAllocator.getId());
+    }
+}
+
+TEST_F(IdAllocatorTests, resync_idInsideReservedBlockOfOtherThread)
+{
+    std::promise<uint64_t> idOfOtherThread;
+    std::promise<void> resynced;
+    std::vector<uint64_t> idsAfterResync;
+    std::thread otherThread([&] {
+        idOfOtherThread.set_value(_idAllocator.getId());
+        resynced.get_future().wait();
+        for (int i = 0; i < 10; ++i) {
+            idsAfterResync.emplace_back(_idAllocator.getId());
+        }
+    });
+    auto loadedId = idOfOtherThread.get_future().get() + 5;
+    _idAllocator.resync(loadedId);
+    resynced.set_value();
+    otherThread.join();
+
+    for (auto const& id : idsAfterResync) {
+        EXPECT_LT(loadedId, id);
+    }
+}
+
+TEST_F(IdAllocatorTests, resync_ignoresSmallerAndGpuIds)
+{
+    auto id = _idAllocator.getId();
+    _idAllocator.resync(id - 1);
+    _idAllocator.resync(1000000);
+    EXPECT_EQ(id + 1, _idAllocator.getId());
+}
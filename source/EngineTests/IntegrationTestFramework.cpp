@@ -119,13 +119,13 @@ bool IntegrationTestFramework::approxCompare(RealVector2D const& expected, RealV
     return approxCompare(expected.x, expected.x) && approxCompare(expected.y, expected.y);
 }
 
-bool IntegrationTestFramework::approxCompare(std::vector<float> const& expected, std::vector<float> const& actual) const
+bool IntegrationTestFramework::approxCompare(std::vector<float> const& expected, std::span<float const> actual) const
 {
     if (expected.size() != actual.size()) {
         return false;
     }
-    for (auto const& [expectedElement, actualElement] : boost::combine(expected, actual)) {
-        if (!approxCompare(expectedElement, actualElement)) {
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (!approxCompare(expected[i], actual[i])) {
             return false;
         }
     }
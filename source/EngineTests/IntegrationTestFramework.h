@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include <gtest/gtest.h>
 
 #include "Base/Definitions.h"
@@ -26,7 +28,7 @@ protected:
     bool approxCompare(double expected, double actual, float precision = 0.001f) const;
     bool approxCompare(float expected, float actual, float precision = 0.001f) const;
     bool approxCompare(RealVector2D const& expected, RealVector2D const& actual) const;
-    bool approxCompare(std::vector<float> const& expected, std::vector<float> const& actual) const;
+    bool approxCompare(std::vector<float> const& expected, std::span<float const> actual) const;
 
     bool compare(DataDescription left, DataDescription right) const;
     bool compare(CellDescription left, CellDescription right) const;
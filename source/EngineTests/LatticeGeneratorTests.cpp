@@ -0,0 +1,198 @@
+#include <unordered_map>
+
+#include <boost/range/adaptor/indexed.hpp>
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/LatticeGenerator.h"
+
+class LatticeGeneratorTests : public ::testing::Test
+{
+public:
+    LatticeGeneratorTests() = default;
+    ~LatticeGeneratorTests() = default;
+
+protected:
+    std::vector<IntVector2D> getRectSites(int width, int height) const
+    {
+        std::vector<IntVector2D> result;
+        for (int i = 0; i < width; ++i) {
+            for (int j = 0; j < height; ++j) {
+                result.emplace_back(IntVector2D{i, j});
+            }
+        }
+        return result;
+    }
+
+    std::vector<IntVector2D> getHexSites(int layers) const
+    {
+        std::vector<IntVector2D> result;
+        for (int j = 0; j < layers; ++j) {
+            for (int i = -(layers - 1); i < layers - j; ++i) {
+                result.emplace_back(IntVector2D{i + j, -j});
+                if (j > 0) {
+                    result.emplace_back(IntVector2D{i, j});
+                }
+            }
+        }
+        return result;
+    }
+
+    //generic path: cells at the lattice positions connected by the distance-based reconnection
+    DataDescription generateGeneric(std::vector<IntVector2D> const& sites, LatticeParameters const& parameters, float reconnectionDistance) const
+    {
+        auto result = LatticeGenerator::generate(sites, LatticeParameters(parameters).connectCells(false), CellDescription().setMaxConnections(6));
+        DescriptionHelper::reconnectCells(result, parameters._cellDistance * reconnectionDistance);
+        return result;
+    }
+
+    //compares positions and bonds with equal cyclic order; returns number of cells whose bonds start with a different neighbor
+    int checkEquivalence(DataDescription const& expected, DataDescription const& actual) const
+    {
+        EXPECT_EQ(expected.cells.size(), actual.cells.size());
+        if (expected.cells.size() != actual.cells.size()) {
+            return 0;
+        }
+        auto getIndexById = [](DataDescription const& data) {
+            std::unordered_map<uint64_t, int> result;
+            for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
+                result.emplace(cell.id, toInt(index));
+            }
+            return result;
+        };
+        auto expectedIndexById = getIndexById(expected);
+        auto actualIndexById = getIndexById(actual);
+
+        int result = 0;
+        for (int i = 0; i < toInt(expected.cells.size()); ++i) {
+            auto const& expectedCell = expected.cells.at(i);
+            auto const& actualCell = actual.cells.at(i);
+            EXPECT_NEAR(expectedCell.pos.x, actualCell.pos.x, NEAR_ZERO);
+            EXPECT_NEAR(expectedCell.pos.y, actualCell.pos.y, NEAR_ZERO);
+
+            auto numConnections = toInt(expectedCell.connections.size());
+            EXPECT_EQ(numConnections, actualCell.connections.size());
+            if (numConnections != actualCell.connections.size() || numConnections == 0) {
+                continue;
+            }
+            auto rotation = 0;
+            while (rotation < numConnections
+                   && actualIndexById.at(actualCell.connections.at(rotation).cellId)
+                       != expectedIndexById.at(expectedCell.connections.front().cellId)) {
+                ++rotation;
+            }
+            EXPECT_LT(rotation, numConnections);
+            if (rotation == numConnections) {
+                continue;
+            }
+            if (rotation != 0) {
+                ++result;
+            }
+            for (int j = 0; j < numConnections; ++j) {
+                auto const& expectedConnection = expectedCell.connections.at(j);
+                auto const& actualConnection = actualCell.connections.at((j + rotation) % numConnections);
+                EXPECT_EQ(expectedIndexById.at(expectedConnection.cellId), actualIndexById.at(actualConnection.cellId));
+                EXPECT_NEAR(expectedConnection.distance, actualConnection.distance, NEAR_ZERO);
+                EXPECT_NEAR(expectedConnection.angleFromPrevious, actualConnection.angleFromPrevious, 0.01f);
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(LatticeGeneratorTests, square)
+{
+    auto sites = getRectSites(20, 15);
+    auto parameters = LatticeParameters().type(LatticeType_Square);
+    auto data = LatticeGenerator::generate(sites, parameters, CellDescription().setMaxConnections(6));
+
+    EXPECT_EQ(0, checkEquivalence(generateGeneric(sites, parameters, 1.1f), data));
+}
+
+TEST_F(LatticeGeneratorTests, square_singleRow)
+{
+    auto sites = getRectSites(1, 7);
+    auto parameters = LatticeParameters().type(LatticeType_Square);
+    auto data = LatticeGenerator::generate(sites, parameters, CellDescription().setMaxConnections(4));
+
+    EXPECT_EQ(0, checkEquivalence(generateGeneric(sites, parameters, 1.1f), data));
+    EXPECT_EQ(360.0f, data.cells.front().connections.front().angleFromPrevious);
+}
+
+TEST_F(LatticeGeneratorTests, square_withHolesAndSpacing)
+{
+    auto sites = getRectSites(30, 30);
+    std::erase_if(sites, [](auto const& site) { return (site.x - 10) * (site.x - 10) + (site.y - 12) * (site.y - 12) < 25 || (site.x + site.y) % 7 == 0; });
+    auto parameters = LatticeParameters().type(LatticeType_Square).cellDistance(1.7f);
+    auto data = LatticeGenerator::generate(sites, parameters, CellDescription().setMaxConnections(6));
+
+    checkEquivalence(generateGeneric(sites, parameters, 1.1f), data);
+}
+
+TEST_F(LatticeGeneratorTests, hexagonal)
+{
+    for (auto cellDistance : {1.0f, 0.8f, 2.5f}) {
+        auto sites = getHexSites(12);
+        auto parameters = LatticeParameters().type(LatticeType_Hexagonal).cellDistance(cellDistance);
+        auto data = LatticeGenerator::generate(sites, parameters, CellDescription().setMaxConnections(6));
+
+        checkEquivalence(generateGeneric(sites, parameters, 1.5f), data);
+    }
+}
+
+TEST_F(LatticeGeneratorTests, hexagonal_withHoles)
+{
+    auto sites = getHexSites(15);
+    std::erase_if(sites, [](auto const& site) { return (site.x * 3 + site.y * 5) % 11 == 0; });
+    auto parameters = LatticeParameters().type(LatticeType_Hexagonal);
+    auto data = LatticeGenerator::generate(sites, parameters, CellDescription().setMaxConnections(6));
+
+    checkEquivalence(generateGeneric(sites, parameters, 1.5f), data);
+}
+
+TEST_F(LatticeGeneratorTests, createRect_restrictedMaxConnections)
+{
+    auto data = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(10).height(10).maxConnections(2));
+    for (auto const& cell : data.cells) {
+        EXPECT_GE(2, cell.connections.size());
+    }
+}
+
+TEST_F(LatticeGeneratorTests, createHex)
+{
+    auto data = DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(10).center({30.0f, 40.0f}));
+    EXPECT_EQ(3 * 10 * 9 + 1, data.cells.size());
+
+    auto genericData = data;
+    DescriptionHelper::reconnectCells(genericData, 1.5f);
+    checkEquivalence(genericData, data);
+}
+
+TEST_F(LatticeGeneratorTests, createUnconnectedCircle)
+{
+    auto parameters = DescriptionHelper::CreateUnconnectedCircleParameters().radius(10.0f).cellDistance(0.7f).center({20.0f, 15.0f});
+    auto data = DescriptionHelper::createUnconnectedCircle(parameters);
+
+    //positions of the previous implementation with accumulated offsets
+    std::vector<RealVector2D> expectedPositions;
+    auto startYRow = toInt(parameters._center.y / parameters._cellDistance) - toInt(parameters._radius / parameters._cellDistance);
+    auto radiusRounded = toInt(parameters._radius / parameters._cellDistance) * parameters._cellDistance;
+    for (float dx = -radiusRounded; dx <= radiusRounded + NEAR_ZERO; dx += parameters._cellDistance) {
+        int row = 0;
+        for (float dy = -radiusRounded; dy <= radiusRounded + NEAR_ZERO; dy += parameters._cellDistance, ++row) {
+            float evenRowIncrement = (startYRow + row) % 2 == 0 ? parameters._cellDistance / 2 : 0.0f;
+            auto dxMod = dx + evenRowIncrement;
+            if (dxMod * dxMod + dy * dy <= radiusRounded * radiusRounded + NEAR_ZERO) {
+                expectedPositions.emplace_back(RealVector2D{parameters._center.x + dxMod, parameters._center.y + dy});
+            }
+        }
+    }
+
+    ASSERT_EQ(expectedPositions.size(), data.cells.size());
+    for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
+        EXPECT_NEAR(expectedPositions.at(index).x, cell.pos.x, 0.001f);
+        EXPECT_NEAR(expectedPositions.at(index).y, cell.pos.y, 0.001f);
+        EXPECT_TRUE(cell.connections.empty());
+    }
+}
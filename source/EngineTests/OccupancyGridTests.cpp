@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/OccupancyGrid.h"
+#include "EngineInterface/SpaceCalculator.h"
+
+class OccupancyGridTests : public ::testing::Test
+{
+public:
+    OccupancyGridTests() = default;
+    ~OccupancyGridTests() = default;
+
+protected:
+    std::vector<RealVector2D> getCellPositions(DataDescription const& data) const
+    {
+        std::vector<RealVector2D> result;
+        for (auto const& cell : data.cells) {
+            result.emplace_back(cell.pos);
+        }
+        return result;
+    }
+
+    float getMinDistanceBetweenCopies(DataDescription const& data, int cellsPerCopy, IntVector2D const& worldSize) const
+    {
+        SpaceCalculator spaceCalculator(worldSize);
+        auto result = std::numeric_limits<float>::max();
+        for (int i = 0; i < toInt(data.cells.size()); ++i) {
+            for (int j = 0; j < toInt(data.cells.size()); ++j) {
+                if (i / cellsPerCopy != j / cellsPerCopy) {
+                    result = std::min(result, spaceCalculator.distance(data.cells.at(i).pos, data.cells.at(j).pos));
+                }
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(OccupancyGridTests, isOccupied)
+{
+    OccupancyGrid occupancy({100, 50}, 2.0f);
+    EXPECT_FALSE(occupancy.isOccupied({10.0f, 10.0f}));
+
+    occupancy.add({10.0f, 10.0f});
+    EXPECT_TRUE(occupancy.isOccupied({10.0f, 10.0f}));
+    EXPECT_TRUE(occupancy.isOccupied({11.9f, 10.0f}));
+    EXPECT_FALSE(occupancy.isOccupied({12.1f, 10.0f}));
+    EXPECT_FALSE(occupancy.isOccupied({10.0f, 7.9f}));
+}
+
+TEST_F(OccupancyGridTests, isOccupied_acrossWorldBoundary)
+{
+    OccupancyGrid occupancy({101, 51}, 2.0f);
+    occupancy.add({0.5f, 50.5f});
+    EXPECT_TRUE(occupancy.isOccupied({100.0f, 50.5f}));
+    EXPECT_TRUE(occupancy.isOccupied({0.5f, 0.5f}));
+    EXPECT_TRUE(occupancy.isOccupied({101.5f, 50.5f}));
+    EXPECT_FALSE(occupancy.isOccupied({98.0f, 50.5f}));
+}
+
+TEST_F(OccupancyGridTests, randomMultiply_reproducible)
+{
+    auto input = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(3).height(3).center({10.0f, 10.0f}));
+    auto parameters = DescriptionHelper::RandomMultiplyParameters().number(50).overlappingCheck(true).maxVelX(1.0f).maxAngularVel(2.0f).seed(7);
+
+    bool success1 = false;
+    bool success2 = false;
+    bool success3 = false;
+    auto result1 = DescriptionHelper::randomMultiply(input, parameters, {200, 200}, DataDescription(input), success1);
+    auto result2 = DescriptionHelper::randomMultiply(input, parameters, {200, 200}, DataDescription(input), success2);
+    auto result3 = DescriptionHelper::randomMultiply(input, parameters.seed(8), {200, 200}, DataDescription(input), success3);
+
+    EXPECT_TRUE(success1);
+    EXPECT_TRUE(success2);
+    EXPECT_TRUE(success3);
+    EXPECT_EQ(51 * 9, result1.cells.size());
+    EXPECT_EQ(getCellPositions(result1), getCellPositions(result2));
+    EXPECT_NE(getCellPositions(result1), getCellPositions(result3));
+}
+
+TEST_F(OccupancyGridTests, randomMultiply_noOverlapping)
+{
+    auto input = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(4).height(4).center({10.0f, 10.0f}));
+    auto parameters = DescriptionHelper::RandomMultiplyParameters().number(100).overlappingCheck(true).seed(1);
+
+    bool success = false;
+    auto result = DescriptionHelper::randomMultiply(input, parameters, {150, 150}, DataDescription(input), success);
+
+    EXPECT_TRUE(success);
+    EXPECT_LE(2.0f, getMinDistanceBetweenCopies(result, 16, {150, 150}));
+}
+
+TEST_F(OccupancyGridTests, randomMultiply_worldTooSmall)
+{
+    auto input = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(5).height(5).center({10.0f, 10.0f}));
+    auto parameters = DescriptionHelper::RandomMultiplyParameters().number(20).overlappingCheck(true);
+
+    bool success = true;
+    auto result = DescriptionHelper::randomMultiply(input, parameters, {20, 20}, DataDescription(input), success);
+
+    EXPECT_FALSE(success);
+    EXPECT_EQ(21 * 25, result.cells.size());
+}
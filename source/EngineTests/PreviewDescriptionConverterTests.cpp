@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/PreviewDescriptionConverter.h"
+
+class PreviewDescriptionConverterTests : public ::testing::Test
+{
+public:
+    PreviewDescriptionConverterTests() = default;
+    ~PreviewDescriptionConverterTests() = default;
+
+protected:
+    GenomeDescription createGenome(int numNodes, int numSubGenomes) const
+    {
+        auto subGenome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setInfo(GenomeHeaderDescription().setSeparateConstruction(false)).setCells({
+            CellGenomeDescription(),
+            CellGenomeDescription().setReferenceAngle(90.0f),
+            CellGenomeDescription().setColor(1),
+        }));
+        GenomeDescription result;
+        for (int i = 0; i < numNodes; ++i) {
+            auto node = CellGenomeDescription().setReferenceAngle(toFloat(i * 10 % 90));
+            if (i < numSubGenomes) {
+                node.setCellFunction(ConstructorGenomeDescription().setGenome(subGenome));
+            }
+            result.cells.emplace_back(node);
+        }
+        return result;
+    }
+};
+
+TEST_F(PreviewDescriptionConverterTests, cachedEqualsUncached)
+{
+    SimulationParameters parameters;
+    auto genome = createGenome(20, 5);
+    PreviewDescriptionCache cache;
+
+    auto expected = PreviewDescriptionConverter::convert(genome, std::nullopt, parameters);
+    EXPECT_EQ(20 + 5 * 3, expected.cells.size());
+    EXPECT_TRUE(expected == cache.getPreviewDescription(genome, parameters));
+    EXPECT_TRUE(expected == cache.getPreviewDescription(genome, parameters));
+    EXPECT_TRUE(expected == cache.getPreviewDescription(GenomeDescriptionConverter::convertDescriptionToBytes(genome), parameters));
+}
+
+TEST_F(PreviewDescriptionConverterTests, changedNode)
+{
+    SimulationParameters parameters;
+    auto genome = createGenome(20, 5);
+    PreviewDescriptionCache cache;
+    cache.getPreviewDescription(genome, parameters);
+
+    genome.cells.at(3).setReferenceAngle(45.0f);
+    genome.cells.at(10).setColor(2);
+    auto expected = PreviewDescriptionConverter::convert(genome, std::nullopt, parameters);
+    EXPECT_TRUE(expected == cache.getPreviewDescription(genome, parameters));
+}
+
+TEST_F(PreviewDescriptionConverterTests, changedParameters)
+{
+    SimulationParameters parameters;
+    auto genome = createGenome(20, 5);
+    PreviewDescriptionCache cache;
+    cache.getPreviewDescription(genome, parameters);
+
+    for (int i = 0; i < MAX_COLORS; ++i) {
+        parameters.cellFunctionConstructorConnectingCellMaxDistance[i] = 3.0f;
+    }
+    auto expected = PreviewDescriptionConverter::convert(genome, std::nullopt, parameters);
+    EXPECT_TRUE(expected == cache.getPreviewDescription(genome, parameters));
+}
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Base/RandomStream.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+
+class RandomStreamTests : public ::testing::Test
+{
+public:
+    RandomStreamTests() = default;
+    ~RandomStreamTests() = default;
+
+protected:
+    std::vector<uint64_t> getNumbers(RandomStream& randomStream, int count) const
+    {
+        std::vector<uint64_t> result;
+        for (int i = 0; i < count; ++i) {
+            result.emplace_back(randomStream.getNext());
+        }
+        return result;
+    }
+
+    ClusteredDataDescription createClusters(int numClusters) const
+    {
+        ClusteredDataDescription result;
+        for (int i = 0; i < numClusters; ++i) {
+            result.addCluster(ClusterDescription().addCells({CellDescription().setId(i * 2 + 1), CellDescription().setId(i * 2 + 2)}));
+        }
+        return result;
+    }
+};
+
+TEST_F(RandomStreamTests, reproducible)
+{
+    RandomStream randomStream1(42);
+    RandomStream randomStream2(42);
+    EXPECT_EQ(getNumbers(randomStream1, 100), getNumbers(randomStream2, 100));
+}
+
+TEST_F(RandomStreamTests, independentStreams)
+{
+    RandomStream randomStream1(42, 0);
+    RandomStream randomStream2(42, 1);
+    RandomStream randomStream3(43, 0);
+    auto numbers1 = getNumbers(randomStream1, 100);
+    EXPECT_NE(numbers1, getNumbers(randomStream2, 100));
+    EXPECT_NE(numbers1, getNumbers(randomStream3, 100));
+}
+
+TEST_F(RandomStreamTests, ranges)
+{
+    RandomStream randomStream(1);
+    std::vector<int> counts(7, 0);
+    for (int i = 0; i < 70000; ++i) {
+        auto value = randomStream.getRandomInt(-3, 3);
+        ASSERT_LE(-3, value);
+        ASSERT_GE(3, value);
+        ++counts[value + 3];
+
+        auto floatValue = randomStream.getRandomFloat(2.0f, 5.0f);
+        ASSERT_LE(2.0f, floatValue);
+        ASSERT_GT(5.0f, floatValue);
+
+        ASSERT_GT(10u, randomStream.getRandomInt(10u));
+    }
+    for (auto const& count : counts) {
+        EXPECT_NEAR(10000, count, 500);
+    }
+}
+
+TEST_F(RandomStreamTests, fill)
+{
+    RandomStream randomStream1(7);
+    RandomStream randomStream2(7);
+
+    std::vector<int> values(1001);
+    randomStream1.fill(values, 0, 100);
+    for (auto const& value : values) {
+        EXPECT_LE(0, value);
+        EXPECT_GE(100, value);
+    }
+    std::vector<int> expectedValues(1001);
+    for (auto& value : expectedValues) {
+        value = randomStream2.getRandomInt(0, 100);
+    }
+    EXPECT_EQ(expectedValues, values);
+
+    std::vector<uint32_t> bits(1001, 0);
+    randomStream1.fill(bits);
+    EXPECT_LT(900, std::ranges::count_if(bits, [](auto const& value) { return value != 0; }));
+
+    std::vector<float> floats(1000);
+    randomStream1.fill(floats, -1.0f, 1.0f);
+    EXPECT_NEAR(0.0f, std::accumulate(floats.begin(), floats.end(), 0.0f) / 1000, 0.1f);
+}
+
+TEST_F(RandomStreamTests, randomizeEnergies_reproducible)
+{
+    auto data1 = createClusters(1000);
+    auto data2 = createClusters(1000);
+    DescriptionHelper::randomizeEnergies(data1, 10.0f, 200.0f, 5);
+    DescriptionHelper::randomizeEnergies(data2, 10.0f, 200.0f, 5);
+    EXPECT_EQ(data1, data2);
+
+    for (auto const& cluster : data1.clusters) {
+        EXPECT_EQ(cluster.cells.at(0).energy, cluster.cells.at(1).energy);
+        EXPECT_LE(10.0f, cluster.cells.at(0).energy);
+        EXPECT_GT(200.0f, cluster.cells.at(0).energy);
+    }
+
+    auto data3 = createClusters(1000);
+    DescriptionHelper::randomizeEnergies(data3, 10.0f, 200.0f, 6);
+    EXPECT_NE(data1, data3);
+}
+
+TEST_F(RandomStreamTests, randomizeCellColors_reproducible)
+{
+    auto data1 = createClusters(1000);
+    auto data2 = createClusters(1000);
+    DescriptionHelper::randomizeCellColors(data1, {1, 3, 5}, 9);
+    DescriptionHelper::randomizeCellColors(data2, {1, 3, 5}, 9);
+    EXPECT_EQ(data1, data2);
+
+    std::vector<int> counts(MAX_COLORS, 0);
+    for (auto const& cluster : data1.clusters) {
+        ++counts[cluster.cells.at(0).color];
+    }
+    EXPECT_EQ(0, counts[0] + counts[2] + counts[4] + counts[6]);
+    EXPECT_LT(250, counts[1]);
+    EXPECT_LT(250, counts[3]);
+    EXPECT_LT(250, counts[5]);
+}
@@ -0,0 +1,222 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "Base/IdAllocator.h"
+#include "Base/NumberGenerator.h"
+#include "Base/Resources.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/GenomeDescriptionConverter.h"
+#include "EngineInterface/SchemaSerializer.h"
+#include "EngineInterface/Serializer.h"
+
+class SerializerTests : public ::testing::Test
+{
+public:
+    SerializerTests() = default;
+    ~SerializerTests() = default;
+
+protected:
+    std::string getTempFilename(std::string const& name) const { return (std::filesystem::temp_directory_path() / name).string(); }
+
+    DeserializedSimulation createSimulation(int numClusters, int numParticles) const
+    {
+        auto& numberGen = NumberGenerator::getInstance();
+
+        DeserializedSimulation result;
+        result.auxiliaryData.generalSettings.worldSizeX = 1000;
+        result.auxiliaryData.generalSettings.worldSizeY = 1000;
+        for (int i = 0; i < numClusters; ++i) {
+            auto rect = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(8).height(8).center(
+                {numberGen.getRandomFloat(0.0f, 1000.0f), numberGen.getRandomFloat(0.0f, 1000.0f)}));
+            result.mainData.addCluster(ClusterDescription().addCells(rect.cells));
+        }
+        for (int i = 0; i < numParticles; ++i) {
+            result.mainData.addParticle(ParticleDescription()
+                                            .setId(IdAllocator::getInstance().getId())
+                                            .setPos({numberGen.getRandomFloat(0.0f, 1000.0f), numberGen.getRandomFloat(0.0f, 1000.0f)})
+                                            .setEnergy(numberGen.getRandomFloat(0.0f, 100.0f)));
+        }
+        return result;
+    }
+};
+
+TEST_F(SerializerTests, serializeAndDeserializeSimulation_singleChunk)
+{
+    auto filename = getTempFilename("serializer_tests_single_chunk.sim");
+    auto sim = createSimulation(10, 100);
+
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(filename, sim));
+
+    DeserializedSimulation actualSim;
+    ASSERT_TRUE(Serializer::deserializeSimulationFromFiles(actualSim, filename));
+    EXPECT_TRUE(sim.mainData == actualSim.mainData);
+}
+
+TEST_F(SerializerTests, serializeAndDeserializeSimulation_multipleChunks)
+{
+    auto filename = getTempFilename("serializer_tests_multiple_chunks.sim");
+    auto sim = createSimulation(2000, 500000);
+
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(filename, sim));
+
+    DeserializedSimulation actualSim;
+    ASSERT_TRUE(Serializer::deserializeSimulationFromFiles(actualSim, filename));
+    EXPECT_TRUE(sim.mainData == actualSim.mainData);
+}
+
+TEST_F(SerializerTests, deserializeContent_legacyFormat)
+{
+    auto filename = getTempFilename("serializer_tests_legacy.sim");
+    auto sim = createSimulation(10, 100);
+
+    ASSERT_TRUE(Serializer::serializeContentToFile(filename, sim.mainData));
+
+    ClusteredDataDescription actualData;
+    ASSERT_TRUE(Serializer::deserializeContentFromFile(actualData, filename));
+    EXPECT_TRUE(sim.mainData == actualData);
+}
+
+TEST_F(SerializerTests, serializeAndDeserializeClusters_withCellFunctions)
+{
+    NeuronDescription neuron;
+    neuron.weights[1][2] = 0.5f;
+    neuron.biases[3] = -1.0f;
+    auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(GenomeDescription().setCells({CellGenomeDescription()}));
+
+    std::vector<ClusterDescription> clusters{ClusterDescription().addCells({
+        CellDescription().setId(1).setPos({1.0f, 2.0f}).setCellFunction(neuron).setMetadata(CellMetadataDescription().setName("test")),
+        CellDescription().setId(2).setPos({2.0f, 2.0f}).setCellFunction(ConstructorDescription().setGenome(genome)),
+        CellDescription().setId(3).setPos({3.0f, 2.0f}).setCellFunction(SensorDescription().setFixedAngle(30.0f)).setInputExecutionOrderNumber(2),
+        CellDescription().setId(4).setPos({4.0f, 2.0f}).setCellFunction(InjectorDescription().setGenome(genome)),
+        CellDescription().setId(5).setPos({5.0f, 2.0f}),
+    })};
+
+    std::string data;
+    SchemaSerializer::serializeClusters(data, clusters, std::vector<uint64_t>{0});
+    auto actualClusters = SchemaSerializer::deserializeClusters(data, SchemaSerializer::getSchema());
+
+    ASSERT_EQ(clusters.size(), actualClusters.size());
+    EXPECT_TRUE(clusters.front().cells == actualClusters.front().cells);
+}
+
+TEST_F(SerializerTests, deserializeParticles_unknownField)
+{
+    std::vector<ParticleDescription> particles{ParticleDescription().setId(1).setPos({1.0f, 2.0f}).setEnergy(10.0f)};
+
+    //simulate a file written by a newer version with an additional field
+    auto schema = SchemaSerializer::getSchema();
+    schema[SchemaObjectType_Particle].emplace_back(SchemaField{100, SchemaFieldType_Float});
+    std::string data;
+    SchemaSerializer::serializeParticles(data, particles, std::vector<uint64_t>{0});
+    data.append(4, '\0');
+
+    auto actualParticles = SchemaSerializer::deserializeParticles(data, schema);
+
+    ASSERT_EQ(1, actualParticles.size());
+    EXPECT_TRUE(particles.front() == actualParticles.front());
+}
+
+TEST_F(SerializerTests, deserializeClustersAndParticles_corruptCount)
+{
+    std::vector<ClusterDescription> clusters{ClusterDescription().addCells({CellDescription().setId(1).setPos({1.0f, 2.0f})})};
+    std::vector<ParticleDescription> particles{ParticleDescription().setId(2).setPos({1.0f, 2.0f})};
+    std::string clusterData;
+    std::string particleData;
+    SchemaSerializer::serializeClusters(clusterData, clusters, std::vector<uint64_t>{0});
+    SchemaSerializer::serializeParticles(particleData, particles, std::vector<uint64_t>{0});
+
+    auto const& schema = SchemaSerializer::getSchema();
+    auto corruptClusterData = clusterData;
+    auto corruptCellData = clusterData;
+    auto corruptParticleData = particleData;
+    std::memset(corruptClusterData.data(), 0xff, sizeof(uint64_t));
+    std::memset(corruptCellData.data() + sizeof(uint64_t), 0xff, sizeof(uint32_t));
+    std::memset(corruptParticleData.data(), 0xff, sizeof(uint64_t));
+
+    EXPECT_THROW(SchemaSerializer::deserializeClusters(corruptClusterData, schema), std::runtime_error);
+    EXPECT_THROW(SchemaSerializer::deserializeClusters(corruptCellData, schema), std::runtime_error);
+    EXPECT_THROW(SchemaSerializer::deserializeParticles(corruptParticleData, schema), std::runtime_error);
+}
+
+TEST_F(SerializerTests, deserializeSimulationRegion)
+{
+    auto filename = getTempFilename("serializer_tests_region.sim");
+    auto sim = createSimulation(2000, 500000);
+
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(filename, sim));
+
+    RealRect region{{100.0f, 200.0f}, {300.0f, 350.0f}};
+    DeserializedSimulation actualSim;
+    ASSERT_TRUE(Serializer::deserializeSimulationRegionFromFiles(actualSim, filename, region));
+
+    auto isInside = [&](RealVector2D const& pos) {
+        return pos.x >= region.topLeft.x && pos.x <= region.bottomRight.x && pos.y >= region.topLeft.y && pos.y <= region.bottomRight.y;
+    };
+    ClusteredDataDescription expectedData;
+    for (auto const& cluster : sim.mainData.clusters) {
+        if (std::any_of(cluster.cells.begin(), cluster.cells.end(), [&](auto const& cell) { return isInside(cell.pos); })) {
+            expectedData.addCluster(cluster);
+        }
+    }
+    for (auto const& particle : sim.mainData.particles) {
+        if (isInside(particle.pos)) {
+            expectedData.addParticle(particle);
+        }
+    }
+    ASSERT_FALSE(expectedData.clusters.empty());
+    EXPECT_TRUE(expectedData == actualSim.mainData);
+}
+
+TEST_F(SerializerTests, peekSimulationSummary)
+{
+    auto filename = getTempFilename("serializer_tests_summary.sim");
+    auto sim = createSimulation(10, 100);
+    sim.auxiliaryData.timestep = 1234;
+    sim.mainData.particles.front().color = 3;
+
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(filename, sim));
+
+    SimulationSummary summary;
+    ASSERT_TRUE(Serializer::peekSimulationSummary(summary, filename));
+    EXPECT_EQ(Const::ProgramVersion, summary.programVersion);
+    EXPECT_EQ(IntVector2D({1000, 1000}), summary.worldSize);
+    EXPECT_EQ(1234, summary.timestep);
+    EXPECT_EQ(10 * 8 * 8, summary.numCellsPerColor[0]);
+    EXPECT_EQ(99, summary.numParticlesPerColor[0]);
+    EXPECT_EQ(1, summary.numParticlesPerColor[3]);
+    EXPECT_EQ(summary.thumbnailSize.x * summary.thumbnailSize.y * 3, toInt(summary.thumbnail.size()));
+
+    auto otherFilename = getTempFilename("serializer_tests_summary_other.sim");
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(otherFilename, sim));
+    SimulationSummary otherSummary;
+    ASSERT_TRUE(Serializer::peekSimulationSummary(otherSummary, otherFilename));
+    EXPECT_EQ(summary.contentHash, otherSummary.contentHash);
+
+    sim.mainData.particles.front().energy += 1.0f;
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(otherFilename, sim));
+    ASSERT_TRUE(Serializer::peekSimulationSummary(otherSummary, otherFilename));
+    EXPECT_NE(summary.contentHash, otherSummary.contentHash);
+}
+
+TEST_F(SerializerTests, unsupportedFormatVersion)
+{
+    auto filename = getTempFilename("serializer_tests_unsupported_version.sim");
+    ASSERT_TRUE(Serializer::serializeSimulationToFiles(filename, createSimulation(10, 100)));
+
+    //format version follows the magic bytes
+    {
+        std::fstream stream(filename, std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(8);
+        uint32_t unsupportedVersion = 2;
+        stream.write(reinterpret_cast<char const*>(&unsupportedVersion), sizeof(unsupportedVersion));
+    }
+
+    DeserializedSimulation actualSim;
+    EXPECT_FALSE(Serializer::deserializeSimulationFromFiles(actualSim, filename));
+    SimulationSummary summary;
+    EXPECT_FALSE(Serializer::peekSimulationSummary(summary, filename));
+}
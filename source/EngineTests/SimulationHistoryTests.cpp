@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "Base/IdAllocator.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationHistory.h"
+
+class SimulationHistoryTests : public ::testing::Test
+{
+public:
+    SimulationHistoryTests() = default;
+    ~SimulationHistoryTests() = default;
+
+protected:
+    DataDescription createData() const
+    {
+        auto result = DescriptionHelper::createHex(DescriptionHelper::CreateHexParameters().layers(5).center({50.0f, 50.0f}));
+        for (int i = 0; i < toInt(result.cells.size()); i += 7) {
+            result.cells[i].setCellFunction(ConstructorDescription().setGenome(std::vector<uint8_t>(100, static_cast<uint8_t>(i))));
+        }
+        for (int i = 0; i < 20; ++i) {
+            result.addParticle(ParticleDescription().setId(IdAllocator::getInstance().getId()).setPos({toFloat(i), 10.0f}).setEnergy(1.0f));
+        }
+        return result;
+    }
+
+    //simulates a time step: cells move and age, one cell and one particle are replaced and one genome changes
+    DataDescription calcNextData(DataDescription data, int step) const
+    {
+        for (auto& cell : data.cells) {
+            cell.pos.x += 0.1f;
+            ++cell.age;
+        }
+        data.cells.erase(data.cells.begin() + step);
+        data.addCell(CellDescription().setId(IdAllocator::getInstance().getId()).setPos({toFloat(step), 0.0f}));
+        data.particles.front().energy += 1.0f;
+        data.particles.erase(data.particles.begin() + 1);
+        data.addParticle(ParticleDescription().setId(IdAllocator::getInstance().getId()).setPos({0.0f, toFloat(step)}));
+
+        for (auto& cell : data.cells) {
+            if (cell.getCellFunctionType() == CellFunction_Constructor) {
+                std::get<ConstructorDescription>(*cell.cellFunction).setGenome(std::vector<uint8_t>(100 + step, 0));
+                break;
+            }
+        }
+        return data;
+    }
+
+    DataDescription sortById(DataDescription data) const
+    {
+        std::ranges::sort(data.cells, [](auto const& cell1, auto const& cell2) { return cell1.id < cell2.id; });
+        std::ranges::sort(data.particles, [](auto const& particle1, auto const& particle2) { return particle1.id < particle2.id; });
+        return data;
+    }
+
+    //returns the pushed states
+    std::vector<DataDescription> pushStates(SimulationHistory& history, int numStates) const
+    {
+        std::vector<DataDescription> result{createData()};
+        for (int i = 1; i < numStates; ++i) {
+            result.emplace_back(calcNextData(result.back(), i));
+        }
+        for (int i = 0; i < numStates; ++i) {
+            history.push(i, result[i]);
+        }
+        return result;
+    }
+};
+
+TEST_F(SimulationHistoryTests, pushPop)
+{
+    SimulationHistory history;
+    auto states = pushStates(history, 10);
+    EXPECT_EQ(10, history.size());
+
+    for (int i = 9; i >= 0; --i) {
+        auto state = history.pop();
+        EXPECT_EQ(i, state.timestep);
+        EXPECT_EQ(sortById(states[i]), sortById(state.data));
+    }
+    EXPECT_TRUE(history.empty());
+}
+
+TEST_F(SimulationHistoryTests, pushAfterPop)
+{
+    SimulationHistory history;
+    auto states = pushStates(history, 5);
+    history.pop();
+    history.pop();
+    history.push(3, states[3]);
+
+    EXPECT_EQ(4, history.size());
+    EXPECT_EQ(sortById(states[3]), sortById(history.pop().data));
+    EXPECT_EQ(sortById(states[2]), sortById(history.pop().data));
+}
+
+TEST_F(SimulationHistoryTests, compressedDeltas)
+{
+    SimulationHistory history;
+    auto states = pushStates(history, 20);
+    history.waitForCompressions();
+
+    EXPECT_EQ(20 - 1 - SimulationHistory::NumUncompressedDeltas, history.getNumCompressedDeltas());
+    for (int i = 19; i >= 0; --i) {
+        EXPECT_EQ(sortById(states[i]), sortById(history.pop().data));
+    }
+}
+
+TEST_F(SimulationHistoryTests, deltasAreSmallerThanStates)
+{
+    SimulationHistory history;
+    pushStates(history, 1);
+    auto keyframeMemoryUsage = history.getMemoryUsage();
+
+    history.clear();
+    pushStates(history, 11);
+    history.waitForCompressions();
+    EXPECT_LT(history.getMemoryUsage() - keyframeMemoryUsage, keyframeMemoryUsage * 10 / 2);
+}
+
+TEST_F(SimulationHistoryTests, genomesAreShared)
+{
+    SimulationHistory history;
+    auto states = pushStates(history, 3);
+    history.pop();
+    auto state = history.pop();
+
+    for (auto const& cell : state.data.cells) {
+        if (cell.getCellFunctionType() == CellFunction_Constructor) {
+            auto originalCell = std::ranges::find_if(states[1].cells, [&](auto const& otherCell) { return otherCell.id == cell.id; });
+            ASSERT_NE(states[1].cells.end(), originalCell);
+            EXPECT_TRUE(std::get<ConstructorDescription>(*cell.cellFunction).genome.isSharedWith(std::get<ConstructorDescription>(*originalCell->cellFunction).genome));
+        }
+    }
+}
+
+TEST_F(SimulationHistoryTests, memoryBudget_evictsOldestStates)
+{
+    SimulationHistory history;
+    auto states = pushStates(history, 20);
+    history.waitForCompressions();
+    auto memoryUsage = history.getMemoryUsage();
+
+    history.setMemoryBudget(memoryUsage / 2);
+    EXPECT_LE(history.getMemoryUsage(), memoryUsage / 2);
+    EXPECT_LT(history.size(), 20);
+    EXPECT_GT(history.size(), 1);
+
+    auto size = history.size();
+    for (int i = 19; i > 19 - size; --i) {
+        EXPECT_EQ(sortById(states[i]), sortById(history.pop().data));
+    }
+    EXPECT_TRUE(history.empty());
+}
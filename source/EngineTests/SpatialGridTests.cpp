@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <random>
+#include <ranges>
+#include <unordered_map>
+
+#include <boost/range/adaptor/indexed.hpp>
+#include <gtest/gtest.h>
+
+#include "Base/Math.h"
+#include "Base/IdAllocator.h"
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SpatialGrid.h"
+
+class SpatialGridTests : public ::testing::Test
+{
+public:
+    SpatialGridTests() = default;
+    ~SpatialGridTests() = default;
+
+protected:
+    std::vector<RealVector2D> createRandomPositions(int numPositions, float size)
+    {
+        std::uniform_real_distribution<float> distribution(0, size);
+        std::vector<RealVector2D> result;
+        for (int i = 0; i < numPositions; ++i) {
+            result.emplace_back(RealVector2D{distribution(_randomEngine), distribution(_randomEngine)});
+        }
+        return result;
+    }
+
+    std::vector<int> getSortedIndicesByDistance(std::vector<RealVector2D> const& positions, RealVector2D const& pos) const
+    {
+        std::vector<int> result(positions.size());
+        for (int i = 0; i < toInt(positions.size()); ++i) {
+            result[i] = i;
+        }
+        std::sort(result.begin(), result.end(), [&](int index1, int index2) {
+            auto distance1 = Math::length(positions[index1] - pos);
+            auto distance2 = Math::length(positions[index2] - pos);
+            return distance1 < distance2 || (distance1 == distance2 && index1 < index2);
+        });
+        return result;
+    }
+
+    std::vector<int> getIndicesWithinRadiusBruteForce(std::vector<RealVector2D> const& positions, RealVector2D const& pos, float radius) const
+    {
+        auto result = getSortedIndicesByDistance(positions, pos);
+        std::erase_if(result, [&](int index) { return Math::length(positions[index] - pos) > radius; });
+        return result;
+    }
+
+    DataDescription createRandomCells(int numCells, float size)
+    {
+        DataDescription result;
+        for (auto const& pos : createRandomPositions(numCells, size)) {
+            result.addCell(CellDescription().setId(IdAllocator::getInstance().getId()).setPos(pos).setMaxConnections(MAX_CELL_BONDS));
+        }
+        return result;
+    }
+
+    //reconnection via the nested slot map (previous implementation) serving as reference
+    void reconnectCellsReference(DataDescription& data, float maxDistance)
+    {
+        std::unordered_map<int, std::unordered_map<int, std::vector<int>>> cellIndicesBySlot;
+        for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
+            cell.connections.clear();
+            cellIndicesBySlot[toInt(cell.pos.x)][toInt(cell.pos.y)].emplace_back(toInt(index));
+        }
+        std::unordered_map<uint64_t, int> cache;
+        for (auto const& [index, cell] : data.cells | boost::adaptors::indexed(0)) {
+            cache.emplace(cell.id, toInt(index));
+        }
+        for (auto& cell : data.cells) {
+            std::vector<int> nearbyCellIndices;
+            for (int x = toInt(cell.pos.x - maxDistance - 0.5f); x <= toInt(cell.pos.x + maxDistance + 0.5f); ++x) {
+                for (int y = toInt(cell.pos.y - maxDistance - 0.5f); y <= toInt(cell.pos.y + maxDistance + 0.5f); ++y) {
+                    if (cellIndicesBySlot.contains(x) && cellIndicesBySlot.at(x).contains(y)) {
+                        for (auto const& index : cellIndicesBySlot.at(x).at(y)) {
+                            if (Math::length(data.cells.at(index).pos - cell.pos) <= maxDistance) {
+                                nearbyCellIndices.emplace_back(index);
+                            }
+                        }
+                    }
+                }
+            }
+            std::sort(nearbyCellIndices.begin(), nearbyCellIndices.end(), [&](int index1, int index2) {
+                auto distance1 = Math::length(data.cells.at(index1).pos - cell.pos);
+                auto distance2 = Math::length(data.cells.at(index2).pos - cell.pos);
+                return distance1 < distance2 || (distance1 == distance2 && index1 < index2);
+            });
+            for (auto const& index : nearbyCellIndices) {
+                auto const& nearbyCell = data.cells.at(index);
+                if (cell.id != nearbyCell.id && cell.connections.size() < cell.maxConnections && nearbyCell.connections.size() < nearbyCell.maxConnections
+                    && !cell.isConnectedTo(nearbyCell.id)) {
+                    data.addConnection(cell.id, nearbyCell.id, &cache);
+                }
+            }
+        }
+    }
+
+    std::mt19937 _randomEngine{42};
+};
+
+TEST_F(SpatialGridTests, emptyGrid)
+{
+    SpatialGrid grid({}, 1.0f);
+    EXPECT_TRUE(grid.getIndicesWithinRadius({0, 0}, 10.0f).empty());
+    EXPECT_TRUE(grid.getNearestIndices({0, 0}, 5).empty());
+}
+
+TEST_F(SpatialGridTests, indicesWithinRadius)
+{
+    auto positions = createRandomPositions(2000, 100.0f);
+    SpatialGrid grid(positions, 2.0f);
+    for (auto radius : {0.5f, 2.0f, 7.5f}) {
+        for (auto const& pos : createRandomPositions(100, 100.0f)) {
+            EXPECT_EQ(getIndicesWithinRadiusBruteForce(positions, pos, radius), grid.getIndicesWithinRadius(pos, radius));
+        }
+    }
+}
+
+TEST_F(SpatialGridTests, indicesWithinRadius_queryOutsideGrid)
+{
+    auto positions = createRandomPositions(500, 10.0f);
+    SpatialGrid grid(positions, 1.0f);
+    for (auto const& pos : std::vector<RealVector2D>{{-3.0f, 5.0f}, {12.0f, 12.0f}, {5.0f, -1000.0f}}) {
+        EXPECT_EQ(getIndicesWithinRadiusBruteForce(positions, pos, 4.0f), grid.getIndicesWithinRadius(pos, 4.0f));
+    }
+}
+
+TEST_F(SpatialGridTests, nearestIndices)
+{
+    auto positions = createRandomPositions(2000, 100.0f);
+    SpatialGrid grid(positions, 1.0f);
+    auto queryPositions = createRandomPositions(100, 100.0f);
+    queryPositions.emplace_back(RealVector2D{-50.0f, 300.0f});
+    for (auto k : {1, 7, 50}) {
+        for (auto const& pos : queryPositions) {
+            auto expected = getSortedIndicesByDistance(positions, pos);
+            expected.resize(k);
+            EXPECT_EQ(expected, grid.getNearestIndices(pos, k));
+        }
+    }
+    EXPECT_EQ(2000, grid.getNearestIndices({50.0f, 50.0f}, 5000).size());
+}
+
+TEST_F(SpatialGridTests, sparsePositions)
+{
+    auto positions = createRandomPositions(100, 1.0e6f);
+    positions.emplace_back(RealVector2D{0, 0});
+    positions.emplace_back(RealVector2D{0.5f, 0});
+    SpatialGrid grid(positions, 1.0f);
+    EXPECT_EQ(getIndicesWithinRadiusBruteForce(positions, {0, 0}, 1.0f), grid.getIndicesWithinRadius({0, 0}, 1.0f));
+    auto expected = getSortedIndicesByDistance(positions, {1.0e6f, 0});
+    expected.resize(3);
+    EXPECT_EQ(expected, grid.getNearestIndices({1.0e6f, 0}, 3));
+}
+
+TEST_F(SpatialGridTests, reconnectCells_equivalentToReference)
+{
+    for (auto maxDistance : {1.0f, 1.5f, 3.0f}) {
+        auto data = createRandomCells(3000, 50.0f);
+        auto referenceData = data;
+
+        DescriptionHelper::reconnectCells(data, maxDistance);
+        reconnectCellsReference(referenceData, maxDistance);
+
+        EXPECT_EQ(referenceData, data);
+    }
+}
+
+TEST_F(SpatialGridTests, reconnectCells_rect)
+{
+    auto data = DescriptionHelper::createRect(DescriptionHelper::CreateRectParameters().width(30).height(20));
+    auto referenceData = data;
+
+    DescriptionHelper::reconnectCells(data, 1.1f);
+    reconnectCellsReference(referenceData, 1.1f);
+
+    EXPECT_EQ(referenceData, data);
+    auto [minX, maxX] = std::ranges::minmax(data.cells | std::views::transform([](auto const& cell) { return cell.pos.x; }));
+    auto [minY, maxY] = std::ranges::minmax(data.cells | std::views::transform([](auto const& cell) { return cell.pos.y; }));
+    for (auto const& cell : data.cells) {
+        auto numNeighbors = (cell.pos.x > minX && cell.pos.x < maxX ? 2 : 1) + (cell.pos.y > minY && cell.pos.y < maxY ? 2 : 1);
+        EXPECT_EQ(numNeighbors, cell.connections.size());
+    }
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include "EngineInterface/TimelineBuffer.h"
+#include "EngineInterface/TimelinePyramid.h"
+
+class TimelineBufferTests : public ::testing::Test
+{
+public:
+    TimelineBufferTests() = default;
+    ~TimelineBufferTests() = default;
+
+protected:
+    //entry with time point t and values t * 10, -t
+    std::vector<double> createValues(double t) const { return {t, t * 10, -t}; }
+};
+
+TEST_F(TimelineBufferTests, push)
+{
+    TimelineBuffer buffer(3, 5);
+    for (int i = 0; i < 3; ++i) {
+        buffer.push(createValues(toDouble(i)));
+    }
+
+    EXPECT_EQ(3, buffer.size());
+    EXPECT_FALSE(buffer.isFull());
+    EXPECT_EQ((std::vector<double>{0, 1, 2}), std::vector<double>(buffer.getTimePoints().begin(), buffer.getTimePoints().end()));
+    EXPECT_EQ(20.0, buffer.getLastValue(1));
+    EXPECT_EQ(-1.0, buffer.getValue(2, 1));
+}
+
+TEST_F(TimelineBufferTests, push_wrapAround)
+{
+    TimelineBuffer buffer(3, 5);
+    for (int i = 0; i < 23; ++i) {
+        buffer.push(createValues(toDouble(i)));
+
+        auto timePoints = buffer.getTimePoints();
+        auto values = buffer.getChannel(1);
+        ASSERT_EQ(std::min(i + 1, 5), toInt(timePoints.size()));
+        for (int j = 0; j < toInt(timePoints.size()); ++j) {
+            EXPECT_EQ(toDouble(i - toInt(timePoints.size()) + 1 + j), timePoints[j]);
+            EXPECT_EQ(timePoints[j] * 10, values[j]);
+        }
+    }
+    EXPECT_TRUE(buffer.isFull());
+    EXPECT_EQ(2, buffer.getLowerBound(20.0));
+    EXPECT_EQ(5, buffer.getLowerBound(100.0));
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(buffer.getChannel(2).empty());
+}
+
+TEST_F(TimelineBufferTests, pyramid_levels)
+{
+    TimelinePyramid pyramid(3, 8);
+    for (int i = 0; i < 8; ++i) {
+        pyramid.push(createValues(toDouble(i)));
+    }
+    EXPECT_EQ(1, pyramid.getNumLevels());
+    EXPECT_EQ(0, pyramid.getCompleteLevel());
+
+    pyramid.push(createValues(8.0));
+    ASSERT_EQ(2, pyramid.getNumLevels());
+    EXPECT_EQ(1, pyramid.getCompleteLevel());
+
+    auto const& means = pyramid.getMean(1);
+    ASSERT_EQ(2, means.size());
+    EXPECT_EQ(1.5, means.getValue(0, 0));
+    EXPECT_EQ(15.0, means.getValue(1, 0));
+    EXPECT_EQ(55.0, means.getValue(1, 1));
+    EXPECT_EQ(0.0, pyramid.getMin(1).getValue(1, 0));
+    EXPECT_EQ(30.0, pyramid.getMax(1).getValue(1, 0));
+    EXPECT_EQ(-3.0, pyramid.getMin(1).getValue(2, 0));
+    EXPECT_EQ(0.0, pyramid.getMax(1).getValue(2, 0));
+}
+
+TEST_F(TimelineBufferTests, pyramid_coversWholeHistory)
+{
+    auto constexpr Capacity = 16;
+    TimelinePyramid pyramid(3, Capacity);
+    for (int i = 0; i < 100000; ++i) {
+        pyramid.push(createValues(toDouble(i)));
+
+        auto level = pyramid.getCompleteLevel();
+        auto const& means = pyramid.getMean(level);
+        ASSERT_LE(means.size(), Capacity);
+        ASSERT_LE(pyramid.getMin(level).getValue(0, 0), 0.0);
+        ASSERT_EQ(toDouble(i), pyramid.getMean(0).getLastValue(0));
+    }
+    EXPECT_EQ(8, pyramid.getNumLevels());
+
+    //extremes are preserved on coarse levels
+    auto level = pyramid.getNumLevels() - 1;
+    EXPECT_EQ(0.0, pyramid.getMin(level).getValue(1, 0));
+    EXPECT_EQ(-0.0, pyramid.getMax(level).getValue(2, 0));
+
+    pyramid.clear();
+    EXPECT_EQ(1, pyramid.getNumLevels());
+    EXPECT_TRUE(pyramid.getMean(0).empty());
+}
@@ -0,0 +1,123 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "EngineImpl/TripleBuffer.h"
+
+class TripleBufferTests : public ::testing::Test
+{
+public:
+    TripleBufferTests() = default;
+    ~TripleBufferTests() = default;
+
+protected:
+    //all fields are derived from the version so that torn frames can be detected
+    struct Frame
+    {
+        uint64_t version = 0;
+        std::vector<uint64_t> values;
+    };
+
+    static void fillFrame(Frame& frame, uint64_t version)
+    {
+        frame.version = version;
+        frame.values.assign(version % 50 + 1, version);
+    }
+
+    static bool isConsistent(Frame const& frame)
+    {
+        if (frame.version == 0) {
+            return frame.values.empty();
+        }
+        if (frame.values.size() != frame.version % 50 + 1) {
+            return false;
+        }
+        for (auto const& value : frame.values) {
+            if (value != frame.version) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(TripleBufferTests, nothingPublished)
+{
+    TripleBuffer<Frame> buffer;
+    EXPECT_EQ(0, buffer.getFrontBuffer().version);
+}
+
+TEST_F(TripleBufferTests, readerSeesLatestPublished)
+{
+    TripleBuffer<Frame> buffer;
+    for (uint64_t version = 1; version <= 3; ++version) {
+        fillFrame(buffer.getBackBuffer(), version);
+        buffer.publish();
+    }
+    EXPECT_EQ(3, buffer.getFrontBuffer().version);
+    EXPECT_EQ(3, buffer.getFrontBuffer().version);
+
+    fillFrame(buffer.getBackBuffer(), 4);
+    EXPECT_EQ(3, buffer.getFrontBuffer().version);
+    buffer.publish();
+    EXPECT_EQ(4, buffer.getFrontBuffer().version);
+}
+
+TEST_F(TripleBufferTests, concurrentReadsAreConsistentAndMonotonic)
+{
+    TripleBuffer<Frame> buffer;
+    uint64_t const numFrames = 100000;
+    std::thread writer([&] {
+        for (uint64_t version = 1; version <= numFrames; ++version) {
+            fillFrame(buffer.getBackBuffer(), version);
+            buffer.publish();
+        }
+    });
+
+    uint64_t lastVersion = 0;
+    while (lastVersion < numFrames) {
+        auto const& frame = buffer.getFrontBuffer();
+        ASSERT_TRUE(isConsistent(frame));
+        ASSERT_GE(frame.version, lastVersion);
+        lastVersion = frame.version;
+    }
+    writer.join();
+}
+
+TEST_F(TripleBufferTests, readerDoesNotWaitForStalledWriter)
+{
+    TripleBuffer<Frame> buffer;
+    fillFrame(buffer.getBackBuffer(), 1);
+    buffer.publish();
+
+    std::atomic<bool> isWriting{false};
+    std::atomic<bool> isStallOver{false};
+    std::thread writer([&] {
+        auto& frame = buffer.getBackBuffer();
+        frame.version = 2;
+        isWriting = true;
+        while (!isStallOver.load()) {
+            std::this_thread::yield();
+        }
+        fillFrame(frame, 2);
+        buffer.publish();
+    });
+    while (!isWriting.load()) {
+        std::this_thread::yield();
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        auto const& frame = buffer.getFrontBuffer();
+        EXPECT_EQ(1, frame.version);
+        EXPECT_TRUE(isConsistent(frame));
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - startTime, std::chrono::seconds(1));
+
+    isStallOver = true;
+    writer.join();
+    EXPECT_EQ(2, buffer.getFrontBuffer().version);
+}
@@ -1018,8 +1018,8 @@ bool AlienImGui::AngleAlignmentCombo(AngleAlignmentComboParameters& parameters,
 
 void AlienImGui::NeuronSelection(
     NeuronSelectionParameters const& parameters,
-    std::vector<std::vector<float>> const& weights,
-    std::vector<float> const& biases,
+    std::array<std::array<float, MAX_CHANNELS>, MAX_CHANNELS> const& weights,
+    std::array<float, MAX_CHANNELS> const& biases,
     int& selectedInput,
     int& selectedOutput)
 {
@@ -2,9 +2,11 @@
 
 #include <imgui.h>
 
+#include "Base/LoggingService.h"
 #include "Base/Resources.h"
 #include "EngineInterface/Serializer.h"
 #include "EngineInterface/SimulationController.h"
+#include "EngineInterface/SimulationDataSnapshot.h"
 
 #include "GlobalSettings.h"
 #include "Viewport.h"
@@ -17,19 +19,23 @@ _AutosaveController::_AutosaveController(SimulationController const& simControll
 {
     _startTimePoint = std::chrono::steady_clock::now();
     _on = GlobalSettings::getInstance().getBoolState("controllers.auto save.active", true);
+    _writer.setMaxInFlightSaves(GlobalSettings::getInstance().getIntState("controllers.auto save.max in-flight saves", 1));
 }
 
 _AutosaveController::~_AutosaveController()
 {
     GlobalSettings::getInstance().setBoolState("controllers.auto save.active", _on);
+    GlobalSettings::getInstance().setIntState("controllers.auto save.max in-flight saves", _writer.getMaxInFlightSaves());
 }
 
 void _AutosaveController::shutdown()
 {
-    if (!_on) {
-        return;
+    //running periodic saves would otherwise cause the final save to be skipped
+    _writer.waitUntilIdle();
+    if (_on) {
+        onSave();
     }
-    onSave();
+    _writer.waitUntilIdle();
 }
 
 bool _AutosaveController::isOn() const
@@ -42,8 +48,28 @@ void _AutosaveController::setOn(bool value)
     _on = value;
 }
 
+int _AutosaveController::getMaxInFlightSaves() const
+{
+    return _writer.getMaxInFlightSaves();
+}
+
+void _AutosaveController::setMaxInFlightSaves(int value)
+{
+    _writer.setMaxInFlightSaves(value);
+}
+
+AsyncSaveProgress _AutosaveController::getProgress() const
+{
+    return _writer.getProgress();
+}
+
 void _AutosaveController::process()
 {
+    auto numFailedSaves = _writer.getProgress().numFailedSaves;
+    if (numFailedSaves > _numReportedFailures) {
+        printOverlayMessage("Auto saving failed");
+        _numReportedFailures = numFailedSaves;
+    }
     if (!_on) {
         return;
     }
@@ -61,12 +87,23 @@ void _AutosaveController::process()
 
 void _AutosaveController::onSave()
 {
-    DeserializedSimulation sim;
-    sim.auxiliaryData.timestep = _simController->getCurrentTimestep();
-    sim.auxiliaryData.zoom = _viewport->getZoomFactor();
-    sim.auxiliaryData.center = _viewport->getCenterInWorldPos();
-    sim.auxiliaryData.generalSettings = _simController->getGeneralSettings();
-    sim.auxiliaryData.simulationParameters = _simController->getSimulationParameters();
-    sim.mainData = _simController->getClusteredSimulationData();
-    Serializer::serializeSimulationToFiles(Const::AutosaveFile, sim);
+    if (!_writer.canSubmit()) {
+        log(Priority::Important, "auto save skipped since previous saves are still in progress");
+        return;
+    }
+
+    //only the copy of the raw data blocks the simulation, conversion and writing is done by the background writer
+    AuxiliaryData auxiliaryData;
+    auxiliaryData.timestep = _simController->getCurrentTimestep();
+    auxiliaryData.zoom = _viewport->getZoomFactor();
+    auxiliaryData.center = _viewport->getCenterInWorldPos();
+    auxiliaryData.generalSettings = _simController->getGeneralSettings();
+    auxiliaryData.simulationParameters = _simController->getSimulationParameters();
+    auto snapshot = _simController->getSimulationDataSnapshot();
+    _writer.trySubmit(Const::AutosaveFile, [auxiliaryData, snapshot] {
+        DeserializedSimulation result;
+        result.auxiliaryData = auxiliaryData;
+        result.mainData = snapshot->convertToClusteredDataDescription();
+        return result;
+    });
 }
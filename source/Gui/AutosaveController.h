@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "EngineInterface/AsyncSimulationWriter.h"
 #include "EngineInterface/Definitions.h"
 #include "Definitions.h"
 
@@ -16,6 +17,10 @@ public:
     bool isOn() const;
     void setOn(bool value);
 
+    int getMaxInFlightSaves() const;
+    void setMaxInFlightSaves(int value);
+    AsyncSaveProgress getProgress() const;
+
     void process();
 
 private:
@@ -23,8 +28,10 @@ private:
 
     SimulationController _simController;
     Viewport _viewport;
+    AsyncSimulationWriter _writer;
 
     bool _on = true;
+    uint64_t _numReportedFailures = 0;
     std::optional<std::chrono::steady_clock::time_point> _startTimePoint;
     bool _alreadySaved = false;
 };
\ No newline at end of file
@@ -5,97 +5,34 @@
 
 #include "EngineInterface/StatisticsData.h"
 
-DataPoint DataPoint::operator+(DataPoint const& other) const
-{
-    DataPoint result;
-    result.time = time + other.time;
-    for (int i = 0; i < MAX_COLORS; ++i) {
-        result.numCells[i] = numCells[i] + other.numCells[i];
-        result.numSelfReplicators[i] = numSelfReplicators[i] + other.numSelfReplicators[i];
-        result.numViruses[i] = numViruses[i] + other.numViruses[i];
-        result.numConnections[i] = numConnections[i] + other.numConnections[i];
-        result.numParticles[i] = numParticles[i] + other.numParticles[i];
-        result.averageGenomeNodes[i] = averageGenomeNodes[i] + other.averageGenomeNodes[i];
-        result.totalEnergy[i] = totalEnergy[i] + other.totalEnergy[i];
-        result.numCreatedCells[i] = numCreatedCells[i] + other.numCreatedCells[i];
-        result.numAttacks[i] = numAttacks[i] + other.numAttacks[i];
-        result.numMuscleActivities[i] = numMuscleActivities[i] + other.numMuscleActivities[i];
-        result.numDefenderActivities[i] = numDefenderActivities[i] + other.numDefenderActivities[i];
-        result.numTransmitterActivities[i] = numTransmitterActivities[i] + other.numTransmitterActivities[i];
-        result.numInjectionActivities[i] = numInjectionActivities[i] + other.numInjectionActivities[i];
-        result.numCompletedInjections[i] = numCompletedInjections[i] + other.numCompletedInjections[i];
-        result.numNervePulses[i] = numNervePulses[i] + other.numNervePulses[i];
-        result.numNeuronActivities[i] = numNeuronActivities[i] + other.numNeuronActivities[i];
-        result.numSensorActivities[i] = numSensorActivities[i] + other.numSensorActivities[i];
-        result.numSensorMatches[i] = numSensorMatches[i] + other.numSensorMatches[i];
-    }
-    result.sumAverageGenomeNodes = sumAverageGenomeNodes + other.sumAverageGenomeNodes;
-    return result;
-}
-
-DataPoint DataPoint::operator/(double divisor) const
-{
-    DataPoint result;
-    result.time = time / divisor;
-    for (int i = 0; i < MAX_COLORS; ++i) {
-        result.numCells[i] = numCells[i] / divisor;
-        result.numSelfReplicators[i] = numSelfReplicators[i] / divisor;
-        result.numViruses[i] = numViruses[i] / divisor;
-        result.numConnections[i] = numConnections[i] / divisor;
-        result.numParticles[i] = numParticles[i] / divisor;
-        result.averageGenomeNodes[i] = averageGenomeNodes[i] / divisor;
-        result.totalEnergy[i] = totalEnergy[i] / divisor;
-        result.numCreatedCells[i] = numCreatedCells[i] / divisor;
-        result.numAttacks[i] = numAttacks[i] / divisor;
-        result.numMuscleActivities[i] = numMuscleActivities[i] / divisor;
-        result.numDefenderActivities[i] = numDefenderActivities[i] / divisor;
-        result.numTransmitterActivities[i] = numTransmitterActivities[i] / divisor;
-        result.numInjectionActivities[i] = numInjectionActivities[i] / divisor;
-        result.numCompletedInjections[i] = numCompletedInjections[i] / divisor;
-        result.numNervePulses[i] = numNervePulses[i] / divisor;
-        result.numNeuronActivities[i] = numNeuronActivities[i] / divisor;
-        result.numSensorActivities[i] = numSensorActivities[i] / divisor;
-        result.numSensorMatches[i] = numSensorMatches[i] / divisor;
-    }
-    result.sumAverageGenomeNodes = sumAverageGenomeNodes / divisor;
-    return result;
-}
-
-void TimelineLiveStatistics::truncate()
-{
-    if (!dataPoints.empty() && dataPoints.back().time - dataPoints.front().time > (MaxLiveHistory + 1.0)) {
-        dataPoints.erase(dataPoints.begin());
-    }
-}
-
 namespace
 {
-    //time on DataPoint will not be set
-    DataPoint convertToDataPoint(
+    //time (channel 0) will not be set
+    std::vector<double> convertToTimelineValues(
         TimelineStatistics const& data,
         uint64_t timestep,
         std::optional<TimelineStatistics> const& lastData,
         std::optional<uint64_t> lastTimestep)
     {
-        DataPoint result;
+        std::vector<double> values(NumTimelineChannels, 0.0);
+        auto setValue = [&](TimelineMetric metric, int colorIndex, double value) { values[getTimelineChannel(metric, colorIndex)] = value; };
+        auto getValue = [&](TimelineMetric metric, int colorIndex) { return values[getTimelineChannel(metric, colorIndex)]; };
+
         auto sumGenomeBytes = 0.0;
         auto sumNumGenomes = 0.0;
         for (int i = 0; i < MAX_COLORS; ++i) {
-            result.numCells[i] = toDouble(data.timestep.numCells[i]);
-            result.numSelfReplicators[i] = toDouble(data.timestep.numSelfReplicators[i]);
-            result.numViruses[i] = toDouble(data.timestep.numViruses[i]);
-            result.numConnections[i] = toDouble(data.timestep.numConnections[i]);
-            result.numParticles[i] = toDouble(data.timestep.numParticles[i]);
-            result.averageGenomeNodes[i] = toDouble(data.timestep.numGenomeNodes[i]);
-            auto numGenomes = result.numSelfReplicators[i];
-            sumGenomeBytes += result.averageGenomeNodes[i];
+            setValue(TimelineMetric_NumCells, i, toDouble(data.timestep.numCells[i]));
+            setValue(TimelineMetric_NumSelfReplicators, i, toDouble(data.timestep.numSelfReplicators[i]));
+            setValue(TimelineMetric_NumViruses, i, toDouble(data.timestep.numViruses[i]));
+            setValue(TimelineMetric_NumConnections, i, toDouble(data.timestep.numConnections[i]));
+            setValue(TimelineMetric_NumParticles, i, toDouble(data.timestep.numParticles[i]));
+            auto genomeNodes = toDouble(data.timestep.numGenomeNodes[i]);
+            auto numGenomes = getValue(TimelineMetric_NumSelfReplicators, i);
+            sumGenomeBytes += genomeNodes;
             sumNumGenomes += numGenomes;
-            if (numGenomes > 0) {
-                result.averageGenomeNodes[i] /= numGenomes;
-            }
-            result.totalEnergy[i] = toDouble(data.timestep.totalEnergy[i]);
+            setValue(TimelineMetric_AverageGenomeNodes, i, numGenomes > 0 ? genomeNodes / numGenomes : genomeNodes);
+            setValue(TimelineMetric_TotalEnergy, i, toDouble(data.timestep.totalEnergy[i]));
         }
-        result.sumAverageGenomeNodes = sumNumGenomes > 0 ? sumGenomeBytes / sumNumGenomes : sumGenomeBytes;
 
         auto deltaTimesteps = lastTimestep ? toDouble(timestep) - toDouble(*lastTimestep) : 1.0;
         if (deltaTimesteps < NEAR_ZERO) {
@@ -104,67 +41,62 @@ namespace
 
         auto lastDataValue = lastData.value_or(data);
         for (int i = 0; i < MAX_COLORS; ++i) {
-            auto numCells = std::max(result.numCells[i], 1.0);
-            auto calcNumProcesses = [&](uint64_t value, uint64_t lastValue) {
-                if (lastValue > value) {
-                    return 0.0;
-                }
-                return toDouble(value - lastValue) / deltaTimesteps / numCells;
+            auto numCells = std::max(getValue(TimelineMetric_NumCells, i), 1.0);
+            auto setNumProcesses = [&](TimelineMetric metric, uint64_t value, uint64_t lastValue) {
+                setValue(metric, i, lastValue > value ? 0.0 : toDouble(value - lastValue) / deltaTimesteps / numCells);
             };
 
-            result.numCreatedCells[i] = calcNumProcesses(data.accumulated.numCreatedCells[i], lastDataValue.accumulated.numCreatedCells[i]);
-            result.numAttacks[i] = calcNumProcesses(data.accumulated.numAttacks[i], lastDataValue.accumulated.numAttacks[i]);
-            result.numMuscleActivities[i] = calcNumProcesses(data.accumulated.numMuscleActivities[i], lastDataValue.accumulated.numMuscleActivities[i]);
-            result.numDefenderActivities[i] = calcNumProcesses(data.accumulated.numDefenderActivities[i], lastDataValue.accumulated.numDefenderActivities[i]);
-            result.numTransmitterActivities[i] =
-                calcNumProcesses(data.accumulated.numTransmitterActivities[i], lastDataValue.accumulated.numTransmitterActivities[i]);
-            result.numInjectionActivities[i] =
-                calcNumProcesses(data.accumulated.numInjectionActivities[i], lastDataValue.accumulated.numInjectionActivities[i]);
-            result.numCompletedInjections[i] =
-                calcNumProcesses(data.accumulated.numCompletedInjections[i], lastDataValue.accumulated.numCompletedInjections[i]);
-            result.numNervePulses[i] = calcNumProcesses(data.accumulated.numNervePulses[i], lastDataValue.accumulated.numNervePulses[i]);
-            result.numNeuronActivities[i] = calcNumProcesses(data.accumulated.numNeuronActivities[i], lastDataValue.accumulated.numNeuronActivities[i]);
-            result.numSensorActivities[i] = calcNumProcesses(data.accumulated.numSensorActivities[i], lastDataValue.accumulated.numSensorActivities[i]);
-            result.numSensorMatches[i] = calcNumProcesses(data.accumulated.numSensorMatches[i], lastDataValue.accumulated.numSensorMatches[i]);
+            setNumProcesses(TimelineMetric_NumCreatedCells, data.accumulated.numCreatedCells[i], lastDataValue.accumulated.numCreatedCells[i]);
+            setNumProcesses(TimelineMetric_NumAttacks, data.accumulated.numAttacks[i], lastDataValue.accumulated.numAttacks[i]);
+            setNumProcesses(TimelineMetric_NumMuscleActivities, data.accumulated.numMuscleActivities[i], lastDataValue.accumulated.numMuscleActivities[i]);
+            setNumProcesses(
+                TimelineMetric_NumDefenderActivities, data.accumulated.numDefenderActivities[i], lastDataValue.accumulated.numDefenderActivities[i]);
+            setNumProcesses(
+                TimelineMetric_NumTransmitterActivities, data.accumulated.numTransmitterActivities[i], lastDataValue.accumulated.numTransmitterActivities[i]);
+            setNumProcesses(
+                TimelineMetric_NumInjectionActivities, data.accumulated.numInjectionActivities[i], lastDataValue.accumulated.numInjectionActivities[i]);
+            setNumProcesses(
+                TimelineMetric_NumCompletedInjections, data.accumulated.numCompletedInjections[i], lastDataValue.accumulated.numCompletedInjections[i]);
+            setNumProcesses(TimelineMetric_NumNervePulses, data.accumulated.numNervePulses[i], lastDataValue.accumulated.numNervePulses[i]);
+            setNumProcesses(TimelineMetric_NumNeuronActivities, data.accumulated.numNeuronActivities[i], lastDataValue.accumulated.numNeuronActivities[i]);
+            setNumProcesses(TimelineMetric_NumSensorActivities, data.accumulated.numSensorActivities[i], lastDataValue.accumulated.numSensorActivities[i]);
+            setNumProcesses(TimelineMetric_NumSensorMatches, data.accumulated.numSensorMatches[i], lastDataValue.accumulated.numSensorMatches[i]);
+        }
+
+        for (TimelineMetric metric = 0; metric < TimelineMetric_Count; ++metric) {
+            auto sum = 0.0;
+            for (int i = 0; i < MAX_COLORS; ++i) {
+                sum += getValue(metric, i);
+            }
+            setValue(metric, TimelineSumIndex, sum);
         }
-        return result;
+        setValue(TimelineMetric_AverageGenomeNodes, TimelineSumIndex, sumNumGenomes > 0 ? sumGenomeBytes / sumNumGenomes : sumGenomeBytes);
+        return values;
     }
 }
 
 void TimelineLiveStatistics::add(TimelineStatistics const& data, uint64_t timestep)
 {
-    truncate();
-
     timepoint += ImGui::GetIO().DeltaTime;
 
-    auto newDataPoint = convertToDataPoint(data, timestep, lastData, lastTimestep);
-    newDataPoint.time = timepoint;
-    dataPoints.emplace_back(newDataPoint);
+    //frames are sampled at a bounded rate so that the buffer always spans MaxLiveHistory
+    if (!dataPoints.empty() && timepoint - dataPoints.getLastValue(0) < MinSampleInterval) {
+        return;
+    }
+    auto values = convertToTimelineValues(data, timestep, lastData, lastTimestep);
+    values[0] = timepoint;
+    dataPoints.push(values);
     lastData = data;
     lastTimestep = timestep;
 }
 
 void TimelineLongtermStatistics::add(TimelineStatistics const& data, uint64_t timestep)
 {
-    if (!lastData || toDouble(timestep) - dataPoints.back().time > longtermTimestepDelta) {
-        auto newDataPoint = convertToDataPoint(data, timestep, lastData, lastTimestep);
-        newDataPoint.time = toDouble(timestep);
-        dataPoints.emplace_back(newDataPoint);
+    if (!lastTimestep || toDouble(timestep) - toDouble(*lastTimestep) > TimestepDelta) {
+        auto values = convertToTimelineValues(data, timestep, lastData, lastTimestep);
+        values[0] = toDouble(timestep);
+        dataPoints.push(values);
         lastData = data;
         lastTimestep = timestep;
-
-        if (dataPoints.size() > 1000) {
-            std::vector<DataPoint> newDataPoints;
-            newDataPoints.reserve(dataPoints.size() / 2);
-            for (size_t i = 0; i < (dataPoints.size() - 1) / 2; ++i) {
-                DataPoint newDataPoint = (dataPoints.at(i * 2) + dataPoints.at(i * 2 + 1)) / 2.0;
-                newDataPoint.time = dataPoints.at(i * 2).time;
-                newDataPoints.emplace_back(newDataPoint);
-            }
-            newDataPoints.emplace_back(dataPoints.back());
-            dataPoints.swap(newDataPoints);
-
-            longtermTimestepDelta *= 2;
-        }
     }
 }
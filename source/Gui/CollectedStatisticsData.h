@@ -1,60 +1,78 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "EngineInterface/Colors.h"
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/StatisticsData.h"
+#include "EngineInterface/TimelineBuffer.h"
+#include "EngineInterface/TimelinePyramid.h"
 
-struct DataPoint
+using TimelineMetric = int;
+enum TimelineMetric_
 {
-    double time; //could be a time step or real time
-
-    ColorVector<double> numCells = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numSelfReplicators = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numViruses = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numConnections = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numParticles = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> averageGenomeNodes = {0, 0, 0, 0, 0, 0, 0};
-    double sumAverageGenomeNodes = 0;
-    ColorVector<double> totalEnergy = {0, 0, 0, 0, 0, 0, 0};
-
-    ColorVector<double> numCreatedCells = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numAttacks = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numMuscleActivities = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numDefenderActivities = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numTransmitterActivities = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numInjectionActivities = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numCompletedInjections = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numNervePulses = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numNeuronActivities = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numSensorActivities = {0, 0, 0, 0, 0, 0, 0};
-    ColorVector<double> numSensorMatches = {0, 0, 0, 0, 0, 0, 0};
-
-    DataPoint operator+(DataPoint const& other) const;
-    DataPoint operator/(double divisor) const;
+    TimelineMetric_NumCells,
+    TimelineMetric_NumSelfReplicators,
+    TimelineMetric_NumViruses,
+    TimelineMetric_NumConnections,
+    TimelineMetric_NumParticles,
+    TimelineMetric_AverageGenomeNodes,
+    TimelineMetric_TotalEnergy,
+    TimelineMetric_NumCreatedCells,
+    TimelineMetric_NumAttacks,
+    TimelineMetric_NumMuscleActivities,
+    TimelineMetric_NumDefenderActivities,
+    TimelineMetric_NumTransmitterActivities,
+    TimelineMetric_NumInjectionActivities,
+    TimelineMetric_NumCompletedInjections,
+    TimelineMetric_NumNervePulses,
+    TimelineMetric_NumNeuronActivities,
+    TimelineMetric_NumSensorActivities,
+    TimelineMetric_NumSensorMatches,
+    TimelineMetric_Count
+};
+
+//channel 0 holds the time points (time steps or real time), followed by the values of each metric per color and summed over all colors
+int constexpr TimelineSumIndex = MAX_COLORS;
+int constexpr NumTimelineChannels = 1 + TimelineMetric_Count * (MAX_COLORS + 1);
+
+inline int getTimelineChannel(TimelineMetric metric, int colorIndex)
+{
+    return 1 + metric * (MAX_COLORS + 1) + colorIndex;
+}
+
+//entries of one channel ready for plotting; minValues and maxValues are only set for downsampled entries
+struct TimelineSeries
+{
+    std::span<double const> timePoints;
+    std::span<double const> values;
+    std::span<double const> minValues;
+    std::span<double const> maxValues;
 };
 
 struct TimelineLiveStatistics
 {
     static double constexpr MaxLiveHistory = 120.0f;  //in seconds
+    static int constexpr Capacity = 6000;
+    static double constexpr MinSampleInterval = MaxLiveHistory / Capacity;  //in seconds
 
     double timepoint = 0.0f;  //in seconds
     float history = 10.0f;   //in seconds
 
-    std::vector<DataPoint> dataPoints;
+    TimelineBuffer dataPoints = TimelineBuffer(NumTimelineChannels, Capacity);
     std::optional<TimelineStatistics> lastData;
     std::optional<uint64_t> lastTimestep;
 
-    void truncate();
     void add(TimelineStatistics const& statistics, uint64_t timestep);
 };
 
 struct TimelineLongtermStatistics
 {
-    double longtermTimestepDelta = 10.0f;
+    static int constexpr Capacity = 1024;  //per resolution level
+    static double constexpr TimestepDelta = 10.0;
 
-    std::vector<DataPoint> dataPoints;
+    TimelinePyramid dataPoints = TimelinePyramid(NumTimelineChannels, Capacity);
     std::optional<TimelineStatistics> lastData;
     std::optional<uint64_t> lastTimestep;
 
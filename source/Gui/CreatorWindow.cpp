@@ -1,6 +1,5 @@
 #include "CreatorWindow.h"
 
-#include <cstdlib>
 #include <cmath>
 
 #include <imgui.h>
@@ -8,8 +7,9 @@
 #include "Fonts/IconsFontAwesome5.h"
 #include "Fonts/AlienIconFont.h"
 
-#include "Base/NumberGenerator.h"
+#include "Base/IdAllocator.h"
 #include "Base/Math.h"
+#include "Base/RandomStream.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/DescriptionHelper.h"
 #include "EngineInterface/SimulationController.h"
@@ -288,7 +288,7 @@ void _CreatorWindow::createDisc()
             auto relPos = Math::unitVectorOfAngle(angle) * radius;
 
             data.addCell(CellDescription()
-                             .setId(NumberGenerator::getInstance().getId())
+                             .setId(IdAllocator::getInstance().getId())
                              .setEnergy(_energy)
                              .setStiffness(_stiffness)
                              .setPos(relPos)
@@ -321,8 +321,9 @@ void _CreatorWindow::validationAndCorrection()
 RealVector2D _CreatorWindow::getRandomPos() const
 {
     auto result = _viewport->getCenterInWorldPos();
-    result.x += (toFloat(std::rand()) / RAND_MAX - 0.5f) * 8;
-    result.y += (toFloat(std::rand()) / RAND_MAX - 0.5f) * 8;
+    auto& randomStream = RandomStream::getThreadInstance();
+    result.x += randomStream.getRandomFloat(-4.0f, 4.0f);
+    result.y += randomStream.getRandomFloat(-4.0f, 4.0f);
     return result;
 }
 
@@ -319,16 +319,42 @@ void _EditorController::processInspectorWindows()
     _inspectorWindows = inspectorWindows;
     _editorModel->setInspectedEntities(inspectedEntities);
 
-    //update inspected entities from simulation
+    //update inspected entities from the published frames of the simulation
     if (inspectedEntities.empty()) {
+        if (_inspectionRequest) {
+            _simController->setInspectedEntityIdsForPublishing({});
+            _inspectionRequest.reset();
+        }
         return;
     }
     std::vector<uint64_t> entityIds;
+    for (auto const& inspectorWindow : _inspectorWindows) {
+        entityIds.emplace_back(inspectorWindow->getId());
+    }
+    auto numInspectedEntityChanges = _editorModel->getNumInspectedEntityChanges();
+    if (!_inspectionRequest || _inspectionRequest->entityIds != entityIds || _inspectionRequest->numInspectedEntityChanges != numInspectedEntityChanges) {
+        auto request = _simController->setInspectedEntityIdsForPublishing(entityIds);
+        _inspectionRequest = InspectionRequest{entityIds, numInspectedEntityChanges, request};
+    }
+
+    //older frames may have been captured before the last change in an inspector window
+    auto const& frame = _simController->getPublishedFrame();
+    if (frame.inspectionRequest < _inspectionRequest->request || frame.version == _lastInspectedFrameVersion) {
+        return;
+    }
+    _lastInspectedFrameVersion = frame.version;
+
+    std::unordered_map<uint64_t, CellOrParticleDescription> publishedEntityById;
+    for (auto const& entity : DescriptionHelper::getObjects(frame.inspectedData)) {
+        publishedEntityById.emplace(DescriptionHelper::getId(entity), entity);
+    }
+    std::vector<CellOrParticleDescription> newInspectedEntities;
     for (auto const& entity : inspectedEntities) {
-        entityIds.emplace_back(DescriptionHelper::getId(entity));
+        auto findResult = publishedEntityById.find(DescriptionHelper::getId(entity));
+        if (findResult != publishedEntityById.end()) {
+            newInspectedEntities.emplace_back(findResult->second);
+        }
     }
-    auto inspectedData = _simController->getInspectedSimulationData(entityIds);
-    auto newInspectedEntities = DescriptionHelper::getObjects(inspectedData);
     _editorModel->setInspectedEntities(newInspectedEntities);
 
     inspectorWindows.clear();
@@ -366,7 +392,7 @@ void _EditorController::moveSelectedObjects(
     updateData.considerClusters = _editorModel->isRolloutToClusters();
     updateData.posDeltaX = delta.x;
     updateData.posDeltaY = delta.y;
-    _simController->shallowUpdateSelectedObjects(updateData);
+    _simController->shallowUpdateSelectedObjects_async(updateData);
     _editorModel->update();
 }
 
@@ -402,7 +428,7 @@ void _EditorController::accelerateSelectedObjects(RealVector2D const& viewPos, R
     updateData.considerClusters = true;
     updateData.velDeltaX = delta.x / 10;
     updateData.velDeltaY = delta.y / 10;
-    _simController->shallowUpdateSelectedObjects(updateData);
+    _simController->shallowUpdateSelectedObjects_async(updateData);
 }
 
 void _EditorController::applyForces(RealVector2D const& viewPos, RealVector2D const& prevViewPos)
@@ -427,7 +453,7 @@ void _EditorController::resizeSelectionRect(RealVector2D const& viewPos, RealVec
     auto topLeft = RealVector2D{std::min(startPos.x, endPos.x), std::min(startPos.y, endPos.y)};
     auto bottomRight = RealVector2D{std::max(startPos.x, endPos.x), std::max(startPos.y, endPos.y)};
 
-    _simController->setSelection(topLeft, bottomRight);
+    _simController->setSelection_async(topLeft, bottomRight);
     _editorModel->update();
 }
 
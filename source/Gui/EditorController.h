@@ -74,6 +74,15 @@ private:
     };
     std::optional<SelectionRect> _selectionRect;
     std::vector<InspectorWindow> _inspectorWindows;
+
+    struct InspectionRequest
+    {
+        std::vector<uint64_t> entityIds;
+        uint64_t numInspectedEntityChanges = 0;
+        uint64_t request = 0;
+    };
+    std::optional<InspectionRequest> _inspectionRequest;
+    uint64_t _lastInspectedFrameVersion = 0;
     DataDescription _drawing;
     std::optional<RealVector2D> _selectionPositionOnClick;
     std::optional<RealVector2D> _mousePosOnClick;
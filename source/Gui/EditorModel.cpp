@@ -58,6 +58,17 @@ void _EditorModel::setInspectedEntities(std::vector<CellOrParticleDescription> c
     }
 }
 
+void _EditorModel::changeInspectedEntity(CellOrParticleDescription const& entity)
+{
+    _inspectedEntityById.insert_or_assign(DescriptionHelper::getId(entity), entity);
+    ++_numInspectedEntityChanges;
+}
+
+uint64_t _EditorModel::getNumInspectedEntityChanges() const
+{
+    return _numInspectedEntityChanges;
+}
+
 bool _EditorModel::areEntitiesInspected() const
 {
     return !_inspectedEntityById.empty();
@@ -22,6 +22,8 @@ public:
     CellOrParticleDescription getInspectedEntity(uint64_t id) const;
     void addInspectedEntity(CellOrParticleDescription const& entity);
     void setInspectedEntities(std::vector<CellOrParticleDescription> const& inspectedEntities);
+    void changeInspectedEntity(CellOrParticleDescription const& entity);  //after the change has been applied to the simulation
+    uint64_t getNumInspectedEntityChanges() const;
     bool areEntitiesInspected() const;
 
     void setDrawMode(bool value);
@@ -43,6 +45,7 @@ private:
     SelectionShallowData _selectionShallowData;
 
     std::unordered_map<uint64_t, CellOrParticleDescription> _inspectedEntityById;
+    uint64_t _numInspectedEntityChanges = 0;
 
     bool _drawMode = false;
     float _pencilWidth = 3.0f;
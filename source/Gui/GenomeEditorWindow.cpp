@@ -8,6 +8,7 @@
 #include "Fonts/IconsFontAwesome5.h"
 
 
+#include "Base/RandomStream.h"
 #include "Base/StringHelper.h"
 #include "EngineInterface/SimulationController.h"
 #include "EngineInterface/GenomeDescriptionConverter.h"
@@ -765,8 +766,9 @@ void _GenomeEditorWindow::onNodeIncreaseSequenceNumber()
 void _GenomeEditorWindow::onCreateSpore()
 {
     auto pos = _viewport->getCenterInWorldPos();
-    pos.x += (toFloat(std::rand()) / RAND_MAX - 0.5f) * 8;
-    pos.y += (toFloat(std::rand()) / RAND_MAX - 0.5f) * 8;
+    auto& randomStream = RandomStream::getThreadInstance();
+    pos.x += randomStream.getRandomFloat(-4.0f, 4.0f);
+    pos.y += randomStream.getRandomFloat(-4.0f, 4.0f);
 
     auto genomeDesc = getCurrentGenome();
     auto genome = GenomeDescriptionConverter::convertDescriptionToBytes(genomeDesc);
@@ -790,7 +792,7 @@ void _GenomeEditorWindow::onCreateSpore()
 void _GenomeEditorWindow::showPreview(TabData& tab)
 {
     auto const& genome = _tabDatas.at(_selectedTabIndex).genome;
-    auto preview = PreviewDescriptionConverter::convert(genome, tab.selectedNode, _simController->getSimulationParameters());
+    auto const& preview = _previewCache.getPreviewDescription(genome, _simController->getSimulationParameters());
     if (AlienImGui::ShowPreviewDescription(preview, _previewZoom, tab.selectedNode)) {
         _nodeIndexToJump = tab.selectedNode;
     }
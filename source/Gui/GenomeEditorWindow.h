@@ -1,7 +1,7 @@
 #pragma once
 
 #include "EngineInterface/GenomeDescriptions.h"
-#include "EngineInterface/PreviewDescriptions.h"
+#include "EngineInterface/PreviewDescriptionConverter.h"
 
 #include "AlienWindow.h"
 #include "Definitions.h"
@@ -62,6 +62,7 @@ private:
     int _selectedInput = 0;
     int _selectedOutput = 0;
     float _previewZoom = 30.0f;
+    PreviewDescriptionCache _previewCache;
     std::optional<std::vector<uint8_t>> _copiedGenome;
     std::string _startingPath;
 
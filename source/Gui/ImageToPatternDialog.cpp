@@ -6,7 +6,7 @@
 #include <ImFileDialog.h>
 
 #include "Base/Definitions.h"
-#include "Base/NumberGenerator.h"
+#include "Base/IdAllocator.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/DescriptionHelper.h"
 #include "EngineInterface/SimulationController.h"
@@ -101,7 +101,7 @@ void _ImageToPatternDialog::show()
                     float matchedCellIntensity;
                     getMatchedCellColor(ImColor(r, g, b, 255), matchedCellColor, matchedCellIntensity);
                     dataDesc.addCell(CellDescription()
-                                         .setId(NumberGenerator::getInstance().getId())
+                                         .setId(IdAllocator::getInstance().getId())
                                          .setEnergy(matchedCellIntensity * 200)
                                          .setPos({toFloat(x) + xOffset, toFloat(y)})
                                          .setMaxConnections(MAX_CELL_BONDS)
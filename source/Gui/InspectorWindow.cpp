@@ -150,6 +150,7 @@ void _InspectorWindow::processCell(CellDescription cell)
 
         if (cell != origCell) {
             _simController->changeCell(cell);
+            _editorModel->changeInspectedEntity(cell);
         }
     }
 }
@@ -330,8 +331,7 @@ void _InspectorWindow::processCellGenomeTab(Description& desc)
 
             if (ImGui::TreeNodeEx("Data", TreeNodeFlags)) {
                 if (ImGui::BeginChild("##child", ImVec2(0, scale(200)), true, ImGuiWindowFlags_HorizontalScrollbar)) {
-                    auto genomDesc = GenomeDescriptionConverter::convertBytesToDescription(desc.genome);
-                    auto previewDesc = PreviewDescriptionConverter::convert(genomDesc, std::nullopt, parameters);
+                    auto const& previewDesc = _genomePreviewCache.getPreviewDescription(desc.genome, parameters);
                     std::optional<int> selectedNodeDummy;
                     AlienImGui::ShowPreviewDescription(previewDesc, _genomeZoom, selectedNodeDummy);
                 }
@@ -555,6 +555,7 @@ void _InspectorWindow::processParticle(ParticleDescription particle)
     particle.energy = energy;
     if (particle != origParticle) {
         _simController->changeParticle(particle);
+        _editorModel->changeInspectedEntity(particle);
     }
 }
 
@@ -537,7 +537,7 @@ void _MainWindow::processMenubar()
         }
 
         if (AlienImGui::BeginMenuButton(" " ICON_FA_COG "  Settings ", _settingsMenuToggled, "Settings", false)) {
-            if (ImGui::MenuItem("Auto save", "", _autosaveController->isOn())) {
+            if (ImGui::MenuItem("Auto save", _autosaveController->getProgress().numInFlightSaves > 0 ? "saving ..." : "", _autosaveController->isOn())) {
                 _autosaveController->setOn(!_autosaveController->isOn());
             }
             if (ImGui::MenuItem("CUDA settings", "ALT+C")) {
@@ -3,6 +3,7 @@
 #include <imgui.h>
 
 #include "Base/Definitions.h"
+#include "Base/RandomStream.h"
 #include "EngineInterface/Colors.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/DescriptionHelper.h"
@@ -157,17 +158,18 @@ void _MassOperationsDialog::onExecute()
         }
         return result;
     };
+    auto seed = RandomStream::getRandomSeed();
     if (_randomizeCellColors) {
-        DescriptionHelper::randomizeCellColors(content, getColorVector(_checkedCellColors));
+        DescriptionHelper::randomizeCellColors(content, getColorVector(_checkedCellColors), seed);
     }
     if (_randomizeGenomeColors) {
-        DescriptionHelper::randomizeGenomeColors(content, getColorVector(_checkedGenomeColors));
+        DescriptionHelper::randomizeGenomeColors(content, getColorVector(_checkedGenomeColors), seed + 1);
     }
     if (_randomizeEnergies) {
-        DescriptionHelper::randomizeEnergies(content, _minEnergy, _maxEnergy);
+        DescriptionHelper::randomizeEnergies(content, _minEnergy, _maxEnergy, seed + 2);
     }
     if (_randomizeAges) {
-        DescriptionHelper::randomizeAges(content, _minAge, _maxAge);
+        DescriptionHelper::randomizeAges(content, _minAge, _maxAge, seed + 3);
     }
 
     if (_restrictToSelectedClusters) {
@@ -5,6 +5,7 @@
 #include "Fonts/IconsFontAwesome5.h"
 #include "Fonts/AlienIconFont.h"
 
+#include "Base/RandomStream.h"
 #include "EngineInterface/SimulationController.h"
 #include "AlienImGui.h"
 #include "EditorModel.h"
@@ -158,8 +159,10 @@ void _MultiplierWindow::onBuild()
         } else {
             auto data = _simController->getSimulationData();
             auto overlappingCheckSuccessful = true;
+            auto parameters = _randomParameters;
+            parameters._seed = RandomStream::getRandomSeed();
             auto result = DescriptionHelper::randomMultiply(
-                _origSelection, _randomParameters, _simController->getWorldSize(), std::move(data), overlappingCheckSuccessful);
+                _origSelection, parameters, _simController->getWorldSize(), std::move(data), overlappingCheckSuccessful);
             if (!overlappingCheckSuccessful) {
                 MessageDialog::getInstance().show("Random multiplication", "Non-overlapping copies could not be created.");
             }
@@ -7,6 +7,7 @@
 
 #include <ImFileDialog.h>
 
+#include "EngineInterface/ClusterClassifier.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/Serializer.h"
 #include "EngineInterface/SimulationController.h"
@@ -51,7 +52,10 @@ void _PatternAnalysisDialog::show()
 
 void _PatternAnalysisDialog::saveRepetitiveActiveClustersToFiles(std::string const& filename)
 {
-    auto const partitionClassDataByDescription = calcPartitionData();
+    auto data = _simController->getClusteredSimulationData();
+    auto clusterClasses = ClusterClassifier::classify(data.clusters);
+    std::erase_if(clusterClasses, [](auto const& clusterClass) { return clusterClass.size() <= 1; });
+    std::ranges::stable_sort(clusterClasses, [](auto const& class1, auto const& class2) { return class1.size() > class2.size(); });
 
     std::ofstream file;
     file.open(filename, std::ios_base::out);
@@ -60,19 +64,11 @@ void _PatternAnalysisDialog::saveRepetitiveActiveClustersToFiles(std::string con
         return;
     }
 
-    int sum = 0;
-    std::vector<PartitionClassData> partitionData;
-    for (auto const& [analysisDesc, partitionClassData] : partitionClassDataByDescription) {
-        if (partitionClassData.numberOfElements > 1) {
-            partitionData.emplace_back(partitionClassData);
-        }
-    }
-    std::sort(partitionData.begin(), partitionData.end());
-
-    file << "number of repetitive active clusters: " << partitionData.size() << std::endl << std::endl;
-    for (auto const& [index, partitionClassData] : partitionData | boost::adaptors::reversed | boost::adaptors::indexed(1)) {
+    //representatives are written one by one without collecting them
+    file << "number of repetitive active clusters: " << clusterClasses.size() << std::endl << std::endl;
+    for (auto const& [index, clusterClass] : clusterClasses | boost::adaptors::indexed(1)) {
 
-        file << "cluster " << index << ": " << partitionClassData.numberOfElements << " exemplars" << std::endl;
+        file << "cluster " << index << ": " << clusterClass.size() << " exemplars" << std::endl;
 
         std::stringstream clusterNameStream;
         clusterNameStream << "cluster" << std::setfill('0') << std::setw(6) << index << ".sim";
@@ -82,69 +78,17 @@ void _PatternAnalysisDialog::saveRepetitiveActiveClustersToFiles(std::string con
         clusterFilename /= clusterNameStream.str();
 
         ClusteredDataDescription pattern;
-        pattern.clusters = std::vector<ClusterDescription>{partitionClassData.representant};
+        pattern.clusters.emplace_back(std::move(data.clusters.at(clusterClass.front())));
 
         Serializer::serializeContentToFile(clusterFilename.string(), pattern);
     }
     file.close();
 
     std::stringstream messageStream;
-    messageStream << partitionData.size() << " repetitive active clusters found. A summary is saved to " << filename << "." << std::endl;
-    if (!partitionData.empty()) {
-        messageStream << "Representative clusters are save from `cluster" << std::setfill('0') << std::setw(6) << 0 << ".sim` to `cluster" << std::setfill('0')
-                      << std::setw(6) << partitionData.size() - 1 << ".sim`.";
+    messageStream << clusterClasses.size() << " repetitive active clusters found. A summary is saved to " << filename << "." << std::endl;
+    if (!clusterClasses.empty()) {
+        messageStream << "Representative clusters are save from `cluster" << std::setfill('0') << std::setw(6) << 1 << ".sim` to `cluster" << std::setfill('0')
+                      << std::setw(6) << clusterClasses.size() << ".sim`.";
     }
     MessageDialog::getInstance().show("Analysis result", messageStream.str());
 }
-
-auto _PatternAnalysisDialog::calcPartitionData() const -> std::map<ClusterAnalysisDescription, PartitionClassData>
-{
-    auto data = _simController->getClusteredSimulationData();
-
-    std::map<ClusterAnalysisDescription, PartitionClassData> result;
-
-    for (auto const& cluster : data.clusters) {
-        auto const clusterAnalysisData = getAnalysisDescription(cluster);
-        auto& partitionData = result[clusterAnalysisData];
-        if (1 == ++partitionData.numberOfElements) {
-            partitionData.representant = cluster;
-        }
-    }
-    return result;
-}
-
-auto _PatternAnalysisDialog::getAnalysisDescription(ClusterDescription const& cluster) const -> ClusterAnalysisDescription
-{
-    ClusterAnalysisDescription result;
-    std::map<uint64_t, CellAnalysisDescription> cellAnalysisDescById;
-    auto insertCellAnalysisDescription = [&cellAnalysisDescById](CellDescription const& cell) {
-        if (cellAnalysisDescById.find(cell.id) == cellAnalysisDescById.end()) {
-            CellAnalysisDescription result;
-            result.maxConnections = cell.maxConnections;
-            result.numConnections = cell.connections.size();
-            result.constructionState = cell.livingState;
-            result.inputExecutionOrderNumber = cell.inputExecutionOrderNumber;
-            result.outputBlocked = cell.outputBlocked;
-            result.executionOrderNumber = cell.executionOrderNumber;
-            result.color = cell.color;
-            result.cellFunction = cell.getCellFunctionType();
-
-            cellAnalysisDescById.insert_or_assign(cell.id, result);
-        }
-    };
-
-    std::map<uint64_t, int> cellDescIndexById;
-    for (auto const& [index, cell] : cluster.cells | boost::adaptors::indexed(0)) {
-        cellDescIndexById.insert_or_assign(cell.id, toInt(index));
-    }
-
-    for (auto const& cell : cluster.cells) {
-        insertCellAnalysisDescription(cell);
-        for (auto const& connection : cell.connections) {
-            auto connectingCellId = connection.cellId;
-            insertCellAnalysisDescription(cluster.cells.at(cellDescIndexById.at(connectingCellId)));
-            result.connectedCells.insert(std::set<CellAnalysisDescription>{cellAnalysisDescById.at(cell.id), cellAnalysisDescById.at(connectingCellId)});
-        }
-    }
-    return result;
-}
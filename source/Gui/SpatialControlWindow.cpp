@@ -108,9 +108,9 @@ void _SpatialControlWindow::processResizeButton()
 void _SpatialControlWindow::processCenterOnSelection()
 {
     if (_centerSelection && _simController->isSimulationRunning()) {
-        auto shallowData = _simController->getSelectionShallowData();
-        if (shallowData.numCells > 0 || shallowData.numParticles > 0) {
-            _viewport->setCenterInWorldPos({shallowData.centerPosX, shallowData.centerPosY});
+        auto const& selection = _simController->getPublishedFrame().selection;
+        if (selection.numCells > 0 || selection.numParticles > 0) {
+            _viewport->setCenterInWorldPos({selection.centerPosX, selection.centerPosY});
         }
     }
 }
@@ -116,43 +116,43 @@ void _StatisticsWindow::processTimelineStatistics()
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numCells);
+        processPlot(row++, TimelineMetric_NumCells);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Cells");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numConnections);
+        processPlot(row++, TimelineMetric_NumConnections);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Cell connections");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numParticles);
+        processPlot(row++, TimelineMetric_NumParticles);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Energy particles");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::totalEnergy);
+        processPlot(row++, TimelineMetric_TotalEnergy);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Total energy");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numSelfReplicators);
+        processPlot(row++, TimelineMetric_NumSelfReplicators);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Self-replicators");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::averageGenomeNodes, &DataPoint::sumAverageGenomeNodes);
+        processPlot(row++, TimelineMetric_AverageGenomeNodes);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Average genome size");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numViruses);
+        processPlot(row++, TimelineMetric_NumViruses);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Viruses");
 
@@ -172,67 +172,67 @@ void _StatisticsWindow::processTimelineStatistics()
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numCreatedCells, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumCreatedCells, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Created cells");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numAttacks, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumAttacks, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Attacks");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numMuscleActivities, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumMuscleActivities, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Muscle activities");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numTransmitterActivities, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumTransmitterActivities, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Transmitter activities");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numDefenderActivities, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumDefenderActivities, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Defender activities");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numInjectionActivities, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumInjectionActivities, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Injection activities");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numCompletedInjections, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumCompletedInjections, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Completed injections");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numNervePulses, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumNervePulses, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Nerve pulses");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numNeuronActivities, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumNeuronActivities, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Neuron activities");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numSensorActivities, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumSensorActivities, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Sensor activities");
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
-        processPlot(row++, &DataPoint::numSensorMatches, nullptr, 6);
+        processPlot(row++, TimelineMetric_NumSensorMatches, 6);
         ImGui::TableSetColumnIndex(1);
         AlienImGui::Text("Sensor matches");
 
@@ -318,29 +318,41 @@ void _StatisticsWindow::processHistograms()
 
 }
 
-void _StatisticsWindow::processPlot(int row, ColorVector<double> DataPoint::*valuesPtr, double const DataPoint::*summedValuesPtr, int fracPartDecimals)
+void _StatisticsWindow::processPlot(int row, TimelineMetric metric, int fracPartDecimals)
 {
-    auto count = _live ? toInt(_liveStatistics.dataPoints.size()) : toInt(_longtermStatistics.dataPoints.size());
-    auto startTime = _live ? _liveStatistics.dataPoints.back().time - toDouble(_liveStatistics.history) : _longtermStatistics.dataPoints.front().time;
-    auto endTime = _live ? _liveStatistics.dataPoints.back().time : _longtermStatistics.dataPoints.back().time;
-    auto values = _live ? &(_liveStatistics.dataPoints[0].*valuesPtr) : &(_longtermStatistics.dataPoints[0].*valuesPtr);
-    auto summedValues = [&] {
-        if (summedValuesPtr) {
-            return _live ? &(_liveStatistics.dataPoints[0].*summedValuesPtr) : &(_longtermStatistics.dataPoints[0].*summedValuesPtr);
+    auto level = _longtermStatistics.dataPoints.getCompleteLevel();
+    auto const& timeline = _live ? _liveStatistics.dataPoints : _longtermStatistics.dataPoints.getMean(level);
+    if (timeline.empty()) {
+        return;
+    }
+    auto endTime = timeline.getTimePoints().back();
+    auto startTime = _live ? endTime - toDouble(_liveStatistics.history) : timeline.getTimePoints().front();
+
+    //only the visible entries are plotted (including one to the left)
+    auto begin = std::max(0, timeline.getLowerBound(startTime) - 1);
+    auto getSeries = [&](int colorIndex) {
+        auto channel = getTimelineChannel(metric, colorIndex);
+        TimelineSeries result{timeline.getTimePoints().subspan(begin), timeline.getChannel(channel).subspan(begin)};
+        if (!_live && level > 0) {
+            result.minValues = _longtermStatistics.dataPoints.getMin(level).getChannel(channel).subspan(begin);
+            result.maxValues = _longtermStatistics.dataPoints.getMax(level).getChannel(channel).subspan(begin);
         }
-        return static_cast<double const*>(nullptr);
-    }();
-    auto timePoints = _live ? &_liveStatistics.dataPoints[0].time : &_longtermStatistics.dataPoints[0].time;
+        return result;
+    };
 
     switch (_plotType) {
     case 0:
-        plotSumColorsIntern(row, values, summedValues, timePoints, count, startTime, endTime, fracPartDecimals);
-        break;
-    case 1:
-        plotByColorIntern(row, values, timePoints, count, startTime, endTime, fracPartDecimals);
+        plotSumColorsIntern(row, getSeries(TimelineSumIndex), startTime, endTime, fracPartDecimals);
         break;
+    case 1: {
+        std::vector<TimelineSeries> seriesByColor;
+        for (int i = 0; i < MAX_COLORS; ++i) {
+            seriesByColor.emplace_back(getSeries(i));
+        }
+        plotByColorIntern(row, seriesByColor, startTime, endTime, fracPartDecimals);
+    } break;
     default:
-        plotForColorIntern(row, values, _plotType - 2, timePoints, count, startTime, endTime, fracPartDecimals);
+        plotForColorIntern(row, getSeries(_plotType - 2), _plotType - 2, startTime, endTime, fracPartDecimals);
         break;
     }
 }
@@ -356,61 +368,39 @@ void _StatisticsWindow::processBackground()
 
 namespace
 {
-    double getMaxWithDataPointStride(double const* data, int count)
+    //the first entries are ignored for the upper bound
+    double getUpperBound(std::span<double const> values)
     {
         double result = 0;
-        for (int i = count / 20; i < count; ++i) {
-            result = std::max(result, *reinterpret_cast<double const*>(reinterpret_cast<DataPoint const*>(data) + i));
+        for (auto value : values.subspan(values.size() / 20)) {
+            result = std::max(result, value);
         }
         return result;
     }
-}
 
-void _StatisticsWindow::plotSumColorsIntern(
-    int row,
-    ColorVector<double> const* values,
-    double const* summedValues,
-    double const* timePoints,
-    int count,
-    double startTime,
-    double endTime,
-    int fracPartDecimals)
-{
-    double upperBound = 0;
-    double endValue;
-
-    double const* plotDataX;
-    double const* plotDataY;
-    int stride;
-    if (!summedValues) {
-        auto& accumulatedData = _cachedTimelines[0];
-        auto& rearragedTimePoints = _cachedTimelines[1];
-        accumulatedData.resize(count);
-        rearragedTimePoints.resize(count);
-        for (int i = 0; i < count; ++i) {
-            double sum = 0;
-            auto ptr = reinterpret_cast<double const*>(reinterpret_cast<DataPoint const*>(values) + i);
-            for (int color = 0; color < MAX_COLORS; ++color) {
-                sum += *(ptr + color);
-            }
-            accumulatedData[i] = sum;
-            if (i >= count / 20) {
-                upperBound = std::max(upperBound, sum);
-            }
-            rearragedTimePoints[i] = *reinterpret_cast<double const*>(reinterpret_cast<DataPoint const*>(timePoints) + i);
+    void plotSeries(TimelineSeries const& series, ImVec4 const& color)
+    {
+        auto count = toInt(series.values.size());
+        ImPlot::PushStyleColor(ImPlotCol_Line, color);
+        if (!series.minValues.empty()) {
+            ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.25f * ImGui::GetStyle().Alpha);
+            ImPlot::PlotShaded("##", series.timePoints.data(), series.minValues.data(), series.maxValues.data(), count);
+            ImPlot::PopStyleVar();
         }
-        endValue = count > 0 ? accumulatedData.back() : 0.0;
-        plotDataX = rearragedTimePoints.data();
-        plotDataY = accumulatedData.data();
-        stride = toInt(sizeof(double));
-    } else {
-        upperBound = getMaxWithDataPointStride(summedValues, count);
-        endValue = count > 0 ? *reinterpret_cast<double const*>(reinterpret_cast<DataPoint const*>(summedValues) + count - 1) : 0.0;
-        plotDataX = timePoints;
-        plotDataY = summedValues;
-        stride = toInt(sizeof(DataPoint));
+        ImPlot::PlotLine("##", series.timePoints.data(), series.values.data(), count);
+        ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.5f * ImGui::GetStyle().Alpha);
+        ImPlot::PlotShaded("##", series.timePoints.data(), series.values.data(), count);
+        ImPlot::PopStyleVar();
+        ImPlot::PopStyleColor();
     }
-    upperBound *= 1.5;
+}
+
+void _StatisticsWindow::plotSumColorsIntern(int row, TimelineSeries const& series, double startTime, double endTime, int fracPartDecimals)
+{
+    auto count = toInt(series.values.size());
+    auto upperBound = getUpperBound(series.values) * 1.5;
+    auto endValue = count > 0 ? series.values.back() : 0.0;
+
     ImGui::PushID(row);
     ImPlot::PushStyleColor(ImPlotCol_FrameBg, (ImU32)ImColor(0.0f, 0.0f, 0.0f, ImGui::GetStyle().Alpha));
     ImPlot::PushStyleColor(ImPlotCol_PlotBg, (ImU32)ImColor(0.0f, 0.0f, 0.0f, ImGui::GetStyle().Alpha));
@@ -424,12 +414,7 @@ void _StatisticsWindow::plotSumColorsIntern(
                 endTime, endValue, ImVec2(-10.0f, 10.0f), ImPlot::GetLastItemColor(), "%s", StringHelper::format(toFloat(endValue), fracPartDecimals).c_str());
         }
         if (count > 0) {
-            ImPlot::PushStyleColor(ImPlotCol_Line, color);
-            ImPlot::PlotLine("##", plotDataX, plotDataY, count, 0, stride);
-            ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.5f * ImGui::GetStyle().Alpha);
-            ImPlot::PlotShaded("##", plotDataX, plotDataY, count, 0, 0, stride);
-            ImPlot::PopStyleVar();
-            ImPlot::PopStyleColor();
+            plotSeries(series, color);
         }
         ImPlot::EndPlot();
     }
@@ -440,16 +425,14 @@ void _StatisticsWindow::plotSumColorsIntern(
 
 void _StatisticsWindow::plotByColorIntern(
     int row,
-    ColorVector<double> const* values,
-    double const* timePoints,
-    int count,
+    std::vector<TimelineSeries> const& seriesByColor,
     double startTime,
     double endTime,
     int fracPartDecimals)
 {
     auto upperBound = 0.0;
-    for (int i = 0; i < MAX_COLORS; ++i) {
-        upperBound = std::max(upperBound, getMaxWithDataPointStride(reinterpret_cast<double const*>(values) + i, count));
+    for (auto const& series : seriesByColor) {
+        upperBound = std::max(upperBound, getUpperBound(series.values));
     }
     upperBound *= 1.5;
 
@@ -466,10 +449,12 @@ void _StatisticsWindow::plotByColorIntern(
             auto colorRaw = Const::IndividualCellColors[i];
             ImColor color(toInt((colorRaw >> 16) & 0xff), toInt((colorRaw >> 8) & 0xff), toInt(colorRaw & 0xff));
 
+            auto const& series = seriesByColor.at(i);
+            auto count = toInt(series.values.size());
             ImPlot::PushStyleColor(ImPlotCol_Line, (ImU32)color);
-            auto endValue = count > 0 ? *(reinterpret_cast<double const*>(reinterpret_cast<DataPoint const*>(values) + (count - 1)) + i) : 0.0f;
+            auto endValue = count > 0 ? series.values.back() : 0.0;
             auto labelId = StringHelper::format(toFloat(endValue), fracPartDecimals);
-            ImPlot::PlotLine(labelId.c_str(), timePoints, reinterpret_cast<double const*>(values) + i, count, 0, sizeof(DataPoint));
+            ImPlot::PlotLine(labelId.c_str(), series.timePoints.data(), series.values.data(), count);
             ImPlot::PopStyleColor();
             ImGui::PopID();
         }
@@ -481,19 +466,11 @@ void _StatisticsWindow::plotByColorIntern(
     ImGui::PopID();
 }
 
-void _StatisticsWindow::plotForColorIntern(
-    int row,
-    ColorVector<double> const* values,
-    int colorIndex,
-    double const* timePoints,
-    int count,
-    double startTime,
-    double endTime,
-    int fracPartDecimals)
+void _StatisticsWindow::plotForColorIntern(int row, TimelineSeries const& series, int colorIndex, double startTime, double endTime, int fracPartDecimals)
 {
-    auto valuesForColor = reinterpret_cast<double const*>(values) + colorIndex;
-    auto upperBound = getMaxWithDataPointStride(valuesForColor, count) * 1.5;
-    auto endValue = count > 0 ? *reinterpret_cast<double const*>(reinterpret_cast<DataPoint const*>(valuesForColor) + count - 1) : 0.0;
+    auto count = toInt(series.values.size());
+    auto upperBound = getUpperBound(series.values) * 1.5;
+    auto endValue = count > 0 ? series.values.back() : 0.0;
 
     ImGui::PushID(row);
     ImPlot::PushStyleColor(ImPlotCol_FrameBg, (ImU32)ImColor(0.0f, 0.0f, 0.0f, ImGui::GetStyle().Alpha));
@@ -511,12 +488,7 @@ void _StatisticsWindow::plotForColorIntern(
                 endTime, endValue, ImVec2(-10.0f, 10.0f), ImPlot::GetLastItemColor(), "%s", StringHelper::format(toFloat(endValue), fracPartDecimals).c_str());
         }
         if (count > 0) {
-            ImPlot::PushStyleColor(ImPlotCol_Line, color);
-            ImPlot::PlotLine("##", timePoints, valuesForColor, count, 0, sizeof(DataPoint));
-            ImPlot::PushStyleVar(ImPlotStyleVar_FillAlpha, 0.5f * ImGui::GetStyle().Alpha);
-            ImPlot::PlotShaded("##", timePoints, valuesForColor, count, 0, 0, sizeof(DataPoint));
-            ImPlot::PopStyleVar();
-            ImPlot::PopStyleColor();
+            plotSeries(series, color);
         }
         ImPlot::EndPlot();
     }
@@ -562,33 +534,34 @@ void _StatisticsWindow::onSaveStatistics()
             writeLabelAllColors("Sensor matches");
             file << std::endl;
 
-            auto writeIntValueAllColors = [&file](auto const& colorVector) {
+            auto writeIntValueAllColors = [&file](TimelineBuffer const& timeline, TimelineMetric metric, int index) {
                 for (int i = 0; i < MAX_COLORS; ++i) {
-                    file << ", " << static_cast<uint64_t>(colorVector[i]);
+                    file << ", " << static_cast<uint64_t>(timeline.getValue(getTimelineChannel(metric, i), index));
                 }
             };
-            auto writeDoubleValueAllColors = [&file](auto const& colorVector) {
+            auto writeDoubleValueAllColors = [&file](TimelineBuffer const& timeline, TimelineMetric metric, int index) {
                 for (int i = 0; i < MAX_COLORS; ++i) {
-                    file << ", " << StringHelper::format(toFloat(colorVector[i]), 8);
+                    file << ", " << StringHelper::format(toFloat(timeline.getValue(getTimelineChannel(metric, i), index)), 8);
                 }
             };
-            for (auto const& dataPoint : _longtermStatistics.dataPoints) {
-                file << static_cast<uint64_t>(dataPoint.time);
-                writeIntValueAllColors(dataPoint.numCells);
-                writeIntValueAllColors(dataPoint.numConnections);
-                writeIntValueAllColors(dataPoint.numParticles);
-                writeDoubleValueAllColors(dataPoint.totalEnergy);
-                writeDoubleValueAllColors(dataPoint.numCreatedCells);
-                writeDoubleValueAllColors(dataPoint.numAttacks);
-                writeDoubleValueAllColors(dataPoint.numMuscleActivities);
-                writeDoubleValueAllColors(dataPoint.numDefenderActivities);
-                writeDoubleValueAllColors(dataPoint.numTransmitterActivities);
-                writeDoubleValueAllColors(dataPoint.numInjectionActivities);
-                writeDoubleValueAllColors(dataPoint.numCompletedInjections);
-                writeDoubleValueAllColors(dataPoint.numNervePulses);
-                writeDoubleValueAllColors(dataPoint.numNeuronActivities);
-                writeDoubleValueAllColors(dataPoint.numSensorActivities);
-                writeDoubleValueAllColors(dataPoint.numSensorMatches);
+            auto const& timeline = _longtermStatistics.dataPoints.getMean(_longtermStatistics.dataPoints.getCompleteLevel());
+            for (int index = 0; index < timeline.size(); ++index) {
+                file << static_cast<uint64_t>(timeline.getValue(0, index));
+                writeIntValueAllColors(timeline, TimelineMetric_NumCells, index);
+                writeIntValueAllColors(timeline, TimelineMetric_NumConnections, index);
+                writeIntValueAllColors(timeline, TimelineMetric_NumParticles, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_TotalEnergy, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumCreatedCells, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumAttacks, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumMuscleActivities, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumDefenderActivities, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumTransmitterActivities, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumInjectionActivities, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumCompletedInjections, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumNervePulses, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumNeuronActivities, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumSensorActivities, index);
+                writeDoubleValueAllColors(timeline, TimelineMetric_NumSensorMatches, index);
                 file << std::endl;
             }
             file.close();
@@ -24,37 +24,13 @@ private:
 
     void processHistograms();
 
-    void processPlot(int row, ColorVector<double> DataPoint::*valuesPtr, double const DataPoint::*summedValuesPtr = nullptr, int fracPartDecimals = 0);
+    void processPlot(int row, TimelineMetric metric, int fracPartDecimals = 0);
 
     void processBackground() override;
 
-    void plotSumColorsIntern(
-        int row,
-        ColorVector<double> const* values,
-        double const* summedValues,
-        double const* timePoints,
-        int count,
-        double startTime,
-        double endTime,
-        int fracPartDecimals);
-    void
-    plotByColorIntern(
-        int row,
-        ColorVector<double> const* values,
-        double const* timePoints,
-        int count,
-        double startTime,
-        double endTime,
-        int fracPartDecimals);
-    void plotForColorIntern(
-        int row,
-        ColorVector<double> const* values,
-        int colorIndex,
-        double const* timePoints,
-        int count,
-        double startTime,
-        double endTime,
-        int fracPartDecimals);
+    void plotSumColorsIntern(int row, TimelineSeries const& series, double startTime, double endTime, int fracPartDecimals);
+    void plotByColorIntern(int row, std::vector<TimelineSeries> const& seriesByColor, double startTime, double endTime, int fracPartDecimals);
+    void plotForColorIntern(int row, TimelineSeries const& series, int colorIndex, double startTime, double endTime, int fracPartDecimals);
 
     void onSaveStatistics();
 
@@ -66,7 +42,6 @@ private:
 
     std::optional<StatisticsData> _lastStatisticsData;
     std::optional<float> _histogramUpperBound;
-    std::map<int, std::vector<double>> _cachedTimelines;
 
     TimelineLiveStatistics _liveStatistics;
     TimelineLongtermStatistics _longtermStatistics;
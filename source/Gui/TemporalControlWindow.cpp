@@ -25,7 +25,15 @@ _TemporalControlWindow::_TemporalControlWindow(
     : _AlienWindow("Temporal control", "windows.temporal control", true)
     , _simController(simController)
     , _statisticsWindow(statisticsWindow)
-{}
+{
+    _historyMemoryBudget = GlobalSettings::getInstance().getIntState("windows.temporal control.history memory budget", _historyMemoryBudget);
+    _history.setMemoryBudget(uint64_t(_historyMemoryBudget) * 1024 * 1024);
+}
+
+_TemporalControlWindow::~_TemporalControlWindow()
+{
+    GlobalSettings::getInstance().setIntState("windows.temporal control.history memory budget", _historyMemoryBudget);
+}
 
 void _TemporalControlWindow::onSnapshot()
 {
@@ -61,6 +69,9 @@ void _TemporalControlWindow::processIntern()
 
         AlienImGui::Separator();
         processTpsRestriction();
+
+        AlienImGui::Separator();
+        processHistoryInfo();
     }
     ImGui::EndChild();
 }
@@ -116,6 +127,20 @@ void _TemporalControlWindow::processTpsRestriction()
     ImGui::EndDisabled();
 }
 
+void _TemporalControlWindow::processHistoryInfo()
+{
+    ImGui::Text("Step-back history");
+    ImGui::SameLine(scale(LeftColumnWidth) - (ImGui::GetWindowWidth() - ImGui::GetContentRegionAvail().x));
+    ImGui::TextUnformatted(
+        (StringHelper::format(uint64_t(_history.size())) + " steps, " + StringHelper::format(toFloat(_history.getMemoryUsage()) / (1024 * 1024), 1) + " MB").c_str());
+
+    ImGui::Text("Memory budget");
+    ImGui::SameLine(scale(LeftColumnWidth) - (ImGui::GetWindowWidth() - ImGui::GetContentRegionAvail().x));
+    if (AlienImGui::SliderInt(AlienImGui::SliderIntParameters().textWidth(0).min(16).max(16384).logarithmic(true).format("%d MB"), &_historyMemoryBudget)) {
+        _history.setMemoryBudget(uint64_t(_historyMemoryBudget) * 1024 * 1024);
+    }
+}
+
 void _TemporalControlWindow::processRunButton()
 {
     ImGui::BeginDisabled(_simController->isSimulationRunning());
@@ -139,10 +164,9 @@ void _TemporalControlWindow::processStepBackwardButton()
 {
     ImGui::BeginDisabled(_history.empty() || _simController->isSimulationRunning());
     if (AlienImGui::ToolbarButton(ICON_FA_CHEVRON_LEFT)) {
-        auto const& snapshot = _history.back();
-        _simController->setCurrentTimestep(snapshot.timestep);
-        _simController->setSimulationData(snapshot.data);
-        _history.pop_back();
+        auto state = _history.pop();
+        _simController->setCurrentTimestep(state.timestep);
+        _simController->setSimulationData(state.data);
     }
     ImGui::EndDisabled();
 }
@@ -151,10 +175,7 @@ void _TemporalControlWindow::processStepForwardButton()
 {
     ImGui::BeginDisabled(_simController->isSimulationRunning());
     if (AlienImGui::ToolbarButton(ICON_FA_CHEVRON_RIGHT)) {
-        Snapshot newSnapshot;
-        newSnapshot.timestep = _simController->getCurrentTimestep();
-        newSnapshot.data = _simController->getSimulationData();
-        _history.emplace_back(newSnapshot);
+        _history.push(_simController->getCurrentTimestep(), _simController->getSimulationData());
 
         _simController->calcSingleTimestep();
     }
@@ -2,6 +2,7 @@
 
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SimulationHistory.h"
 
 #include "Definitions.h"
 #include "AlienWindow.h"
@@ -10,6 +11,7 @@ class _TemporalControlWindow : public _AlienWindow
 {
 public:
     _TemporalControlWindow(SimulationController const& simController, StatisticsWindow const& statisticsWindow);
+    ~_TemporalControlWindow();
 
     void onSnapshot();
 
@@ -19,6 +21,7 @@ private:
     void processTpsInfo();
     void processTotalTimestepsInfo();
     void processTpsRestriction();
+    void processHistoryInfo();
 
     void processRunButton();
     void processPauseButton();
@@ -37,7 +40,8 @@ private:
     };
     std::optional<Snapshot> _snapshot;
 
-    std::vector<Snapshot> _history;
+    SimulationHistory _history;
+    int _historyMemoryBudget = 1024;  //in MB
 
     bool _slowDown = false;
     int _tpsRestriction = 30;